@@ -16,6 +16,16 @@ namespace thl {
  */
 enum class AudioEncodingFormat { WAV, FLAC };
 
+/**
+ * @enum AudioRecordingMode
+ * @brief Selects which thread runs the encoder.
+ *
+ * - AudioRecordingMode::Direct (default) - process() encodes on the audio thread.
+ * - AudioRecordingMode::Threaded - process() copies each block into a
+ *   preallocated lock-free ring and a writer thread encodes it in large chunks.
+ */
+enum class AudioRecordingMode { Direct, Threaded };
+
 /**
  * @class AudioFileSink
  * @brief Audio callback that records input audio to a file.
@@ -38,9 +48,14 @@ enum class AudioEncodingFormat { WAV, FLAC };
  *
  * - open_file(), close_file(), start_recording(), and stop_recording() are NOT
  *   real-time safe and should only be called from the main thread.
- * - process() writes to the file which involves I/O. While the write itself
- *   may block, this is typically acceptable for recording scenarios. For
- *   strict real-time requirements, consider buffering to a lock-free queue.
+ * - In AudioRecordingMode::Direct, process() writes to the file, which
+ *   involves I/O. The write may block. That is usually acceptable for short
+ *   WAV recordings.
+ * - In AudioRecordingMode::Threaded, process() only copies the block into a
+ *   single-producer/single-consumer ring. A writer thread owned by the sink
+ *   encodes and flushes it. If the ring is full, the block is dropped and
+ *   counted in get_overflow_count(). Use this mode for FLAC, for long takes,
+ *   and for slow storage.
  *
  * @section formats Supported Formats
  *
@@ -91,21 +106,30 @@ public:
      * @param channels Number of audio channels to record.
      * @param sampleRate Sample rate in Hz.
      * @param format Encoding format (default: WAV).
+     * @param mode Which thread runs the encoder (default: Direct).
+     * @param buffer_seconds Ring capacity in seconds of audio. Only used in
+     *                       AudioRecordingMode::Threaded.
      *
      * @return true if the file was opened successfully, false otherwise.
      *
-     * @warning NOT real-time safe - performs file I/O and allocations.
+     * @warning NOT real-time safe - performs file I/O and allocations, and
+     *          starts the writer thread in threaded mode.
      */
     bool open_file(const std::string& file_path,
                    uint32_t channels,
                    uint32_t sample_rate,
-                   AudioEncodingFormat format = AudioEncodingFormat::WAV);
+                   AudioEncodingFormat format = AudioEncodingFormat::WAV,
+                   AudioRecordingMode mode = AudioRecordingMode::Direct,
+                   float buffer_seconds = k_default_buffer_seconds);
 
     /**
      * @brief Closes the currently open file.
      *
      * Stops recording if active and finalises the file. Safe to call
-     * even if no file is open.
+     * even if no file is open, and while the stream is running: it waits
+     * for any process() call already past its recording check to return.
+     * In threaded mode, the writer thread then drains the ring, so every
+     * frame accepted by process() reaches the file.
      *
      * @warning NOT real-time safe - performs file I/O.
      */
@@ -145,17 +169,53 @@ public:
      *
      * @return true if a file is open and ready for recording, false otherwise.
      */
-    bool is_open() const { return m_open; }
+    bool is_open() const { return m_open.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Gets the active recording mode.
+     *
+     * @return The mode passed to the last successful open_file().
+     */
+    AudioRecordingMode get_recording_mode() const { return m_mode; }
 
     /**
      * @brief Gets the total number of frames written to the file.
      *
+     * In threaded mode, this counts frames the writer thread has encoded.
+     * Frames still waiting in the ring are not included.
+     *
      * @return Number of audio frames written since the file was opened.
      *
      * @note Thread-safe - uses atomic operations.
      */
     uint64_t get_frames_written() const { return m_frames_written.load(std::memory_order_acquire); }
 
+    /**
+     * @brief Gets the number of frames dropped because the ring was full.
+     *
+     * Always 0 in direct mode. A non-zero value means the writer thread
+     * cannot keep up, so increase buffer_seconds.
+     *
+     * @return Dropped frames since the file was opened.
+     *
+     * @note Thread-safe - uses atomic operations.
+     */
+    uint64_t get_overflow_count() const { return m_overflow_count.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Gets the number of writer wake-ups that found the ring empty
+     *        while recording.
+     *
+     * Always 0 in direct mode. A steadily rising value means the writer is
+     * starved of input, for example because the device stopped delivering
+     * callbacks.
+     *
+     * @return Empty writer polls since the file was opened.
+     *
+     * @note Thread-safe - uses atomic operations.
+     */
+    uint64_t get_underrun_count() const { return m_underrun_count.load(std::memory_order_acquire); }
+
     /**
      * @brief Gets the peak amplitude of the most recent audio block.
      *
@@ -169,7 +229,8 @@ public:
      * @brief Processes audio input and writes to file if recording.
      *
      * If recording is active and a file is open, writes the input buffer
-     * to the file. The output buffer is not modified.
+     * to the file (direct mode) or to the writer ring (threaded mode). The
+     * output buffer is not modified.
      *
      * @param outputBuffer Ignored - recording does not produce output.
      * @param inputBuffer Audio data to record.
@@ -177,7 +238,8 @@ public:
      * @param numInputChannels Number of input channels.
      * @param numOutputChannels Number of output channels (unused).
      *
-     * @note This method performs file I/O and may block.
+     * @note In direct mode this performs file I/O and may block. In threaded
+     *       mode it is wait-free.
      */
     void process(float* output_buffer,
                  const float* input_buffer,
@@ -195,13 +257,21 @@ public:
      */
     void release_resources() override;
 
+    /// Default ring capacity for AudioRecordingMode::Threaded.
+    static constexpr float k_default_buffer_seconds = 2.0f;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> m_impl;
 
-    bool m_open = false;
+    // Set last by open_file() with release, so process() sees the mode,
+    // channel count and ring it published
+    std::atomic<bool> m_open{false};
+    AudioRecordingMode m_mode = AudioRecordingMode::Direct;
     std::atomic<bool> m_recording{false};
     std::atomic<uint64_t> m_frames_written{0};
+    std::atomic<uint64_t> m_overflow_count{0};
+    std::atomic<uint64_t> m_underrun_count{0};
     std::atomic<float> m_peak_level{0.0f};
 };
 
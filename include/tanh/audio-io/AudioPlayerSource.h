@@ -15,6 +15,23 @@
 
 namespace thl {
 
+namespace audio_io {
+class StreamingDataSource;
+}
+
+/**
+ * @enum AudioPlaybackMode
+ * @brief Selects which thread runs the decoder.
+ *
+ * - AudioPlaybackMode::Direct (default) - process() pulls frames from the data
+ *   source on the audio thread. Resampling, and any decoding the resource
+ *   manager has not done ahead of time, happen inside the callback.
+ * - AudioPlaybackMode::Streaming - a decoder thread keeps a configurable
+ *   number of seconds of decoded PCM in a lock-free ring, and process() only
+ *   copies out of it.
+ */
+enum class AudioPlaybackMode { Direct, Streaming };
+
 /**
  * @class AudioPlayerSource
  * @brief Audio callback that plays back audio from a file using async decoding.
@@ -48,6 +65,11 @@ namespace thl {
  *   from any thread, though stop() also performs a seek operation.
  * - process() reads from pre-decoded buffers managed by the resource manager's
  *   background thread, making it suitable for real-time audio processing.
+ * - In AudioPlaybackMode::Streaming, process() only copies from a ring that
+ *   the player's decoder thread fills. seek_to_frame() and stop() just post
+ *   the target. Seeks that land inside the buffered window are served from
+ *   the ring without touching the decoder. If the decoder falls behind, the
+ *   block is padded with silence and get_starvation_count() is incremented.
  *
  * @section finished_callback Finished Callback
  *
@@ -249,6 +271,42 @@ public:
      */
     void set_finished_callback(FinishedCallback callback);
 
+    /**
+     * @brief Selects direct or streaming playback.
+     *
+     * If a file is loaded, its data source is rebuilt at the current
+     * position. Otherwise the mode applies to the next load_file() or
+     * load_from_memory().
+     *
+     * @param mode Which thread runs the decoder.
+     * @param buffer_seconds Seconds of decoded PCM kept ahead of playback.
+     *                       Only used in AudioPlaybackMode::Streaming.
+     *
+     * @warning NOT real-time safe - may start or join the decoder thread.
+     */
+    void set_playback_mode(AudioPlaybackMode mode,
+                           float buffer_seconds = k_default_buffer_seconds);
+
+    /**
+     * @brief Gets the active playback mode.
+     */
+    AudioPlaybackMode get_playback_mode() const { return m_mode; }
+
+    /**
+     * @brief Gets the number of callbacks that the decoder thread could not
+     *        fully serve.
+     *
+     * Always 0 in direct mode. Each count is one block padded with silence.
+     * Blocks spent waiting on an out-of-range seek are not counted.
+     *
+     * @return Starved callbacks since the last load.
+     *
+     * @note Thread-safe - uses atomic operations.
+     */
+    uint64_t get_starvation_count() const {
+        return m_starvation_count.load(std::memory_order_acquire);
+    }
+
     void prepare_to_play(uint32_t sample_rate, uint32_t buffer_size) override;
 
     /**
@@ -289,13 +347,27 @@ public:
     void set_fade_enabled(bool enabled) { m_fade_enabled = enabled; }
     bool is_fade_enabled() const { return m_fade_enabled; }
 
+    /// Default decode-ahead window for AudioPlaybackMode::Streaming.
+    static constexpr float k_default_buffer_seconds = 2.0f;
+
 private:
     bool rebuild_data_source(uint32_t decoded_channels,
                              uint32_t decoded_sample_rate,
                              uint64_t initial_frame);
 
+    // Drops both data sources, joins the decoder thread, if any, and retires
+    // them to DeferredReclaimer::shared() so no destructor runs in process().
+    void clear_data_sources();
+
     audio_io::AudioFileLoader m_loader;
     AtomicSharedPtr<audio_io::DataSource> m_data_source;
+    // Streaming mode only. Exactly one of m_data_source / m_stream is set
+    // while a file is loaded.
+    AtomicSharedPtr<audio_io::StreamingDataSource> m_stream;
+
+    AudioPlaybackMode m_mode = AudioPlaybackMode::Direct;
+    float m_buffer_seconds = k_default_buffer_seconds;
+    std::atomic<uint64_t> m_starvation_count{0};
 
     std::atomic<bool> m_loaded{false};
     std::atomic<bool> m_playing{false};
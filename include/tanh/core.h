@@ -4,6 +4,9 @@
 
 #include "core/Dispatcher.h"
 #include "core/Logger.h"
+#include "core/ObjectPool.h"
+#include "core/ScratchArena.h"
+#include "core/threading/DeferredReclaimer.h"
 #include "core/threading/RCU.h"
 
 // Core utility functions available to all components
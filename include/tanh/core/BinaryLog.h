@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tanh/core/Exports.h"
+#include "tanh/core/Logger.h"
+
+/// @file BinaryLog.h
+/// @brief Compact binary log segments for the Logger's binary sink.
+///
+/// A segment file starts with a fixed header followed by back-to-back
+/// records.  All integers are little-endian.
+///
+/// @code
+/// header:  "THLBLOG1"  u32 version  u32 header_size  u64 segment_index
+/// record:  u32 size  u64 seq  u64 monotonic_ns  i64 timestamp_ms  u32 level
+///          u16 source_len  u16 group_len  u32 message_len
+///          source bytes  group bytes  message bytes
+/// @endcode
+///
+/// A record size of 0 marks the end of the data; segments are written
+/// through a memory mapping that is zero-filled beyond the last record.
+namespace thl::Logger {
+
+/// @brief Appends LogRecords to size-rotated, memory-mapped segment files.
+///
+/// Segments are named <prefix>-<index>.tlb inside the directory; when the
+/// next record does not fit, the current segment is truncated to its data
+/// and the next one is mapped.  Only the newest m_max_segments are kept.
+/// Not thread-safe: the Logger serializes calls.
+class TANH_API BinaryLogWriter {
+public:
+    struct Options {
+        std::string m_directory;
+        std::string m_prefix = "thl";
+        std::size_t m_segment_size = std::size_t{4} << 20;  ///< Bytes per segment file.
+        std::size_t m_max_segments = 4;                     ///< 0 = keep every segment.
+    };
+
+    explicit BinaryLogWriter(Options options);
+    ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    /// Append @p record; false if no segment could be opened or the record
+    /// is larger than a whole segment.
+    bool write(const LogRecord& record);
+
+    /// Schedule written pages for write-back without blocking.
+    void flush();
+
+    const Options& options() const { return m_options; }
+
+private:
+    bool open_segment();
+    void close_segment();
+
+    Options m_options;
+    std::uint64_t m_next_index = 0;
+    std::vector<std::string> m_segments;  // oldest first
+
+    std::byte* m_map = nullptr;
+    std::size_t m_offset = 0;
+    int m_fd = -1;                  // POSIX: mapped segment file
+    std::vector<std::byte> m_stage;  // Elsewhere: segment staged in memory
+    std::string m_path;
+};
+
+/// Encoded size of @p record, header fields included.
+TANH_API std::size_t binary_record_size(const LogRecord& record);
+
+/// Segment files for @p prefix in @p directory, oldest first.
+TANH_API std::vector<std::string> list_binary_log_segments(const std::string& directory,
+                                                           std::string_view prefix = "thl");
+
+/// @brief Decode every record of one segment file.
+///
+/// Stops at the end marker or at the first truncated record.  Throws
+/// std::runtime_error if the file cannot be read or has no valid header.
+TANH_API std::vector<LogRecord> read_binary_log(const std::string& path);
+
+}  // namespace thl::Logger
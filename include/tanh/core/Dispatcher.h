@@ -1,34 +1,176 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 #include "tanh/core/Exports.h"
+#include "tanh/core/threading/MPMCQueue.h"
+#include "tanh/utils/RealtimeSanitizer.h"
 
 namespace thl {
 
 class TANH_API DispatcherListener {
 public:
-    virtual void on_dispatch(const std::string& event, const std::string& data) = 0;
+    /// Synchronous string events from Dispatcher::dispatch().
+    virtual void on_dispatch([[maybe_unused]] const std::string& event,
+                             [[maybe_unused]] const std::string& data) {}
+
+    /// Posted events, delivered by Dispatcher::pump() or the delivery thread.
+    /// @p payload is only valid for the duration of the call and carries no
+    /// alignment guarantee — std::memcpy it out.
+    virtual void on_event([[maybe_unused]] uint32_t event,
+                          [[maybe_unused]] std::span<const std::byte> payload) {}
+
     virtual ~DispatcherListener() = default;
 };
 
+/**
+ * @brief Event bus with a synchronous string API and a real-time safe post path
+ *
+ * dispatch() delivers string events synchronously under a mutex, on the
+ * calling thread. post() is the path for the audio thread and busy UI
+ * threads: events are identified by interned integer IDs, their payload is
+ * copied into a slot of a preallocated pool, and the slot index travels
+ * through a lock-free queue. Delivery happens later on a single thread —
+ * either the caller of pump() or, with Options::m_delivery_thread, a thread
+ * owned by the Dispatcher that pumps every Options::m_delivery_interval.
+ *
+ * A listener registered with Delivery::Latest sees only the last event of
+ * each ID per pump, so high-rate streams (meters, positions) coalesce
+ * instead of flooding the UI.
+ *
+ * Listener callbacks run with the listener table locked: they must not add
+ * or remove listeners or intern new events.
+ */
 class TANH_API Dispatcher {
 public:
+    using EventId = uint32_t;
+    static constexpr EventId k_invalid_event = UINT32_MAX;
+
+    enum class Delivery : uint8_t {
+        Every,   // every posted event, in posting order
+        Latest,  // only the last event of the ID per pump
+    };
+
+    struct Options {
+        /// Payload slots, and therefore events that can be in flight at once.
+        /// Rounded up to a power of two.
+        size_t m_capacity = 1024;
+        /// Largest payload post() accepts, in bytes.
+        size_t m_max_payload_size = 64;
+        /// Deliver on a Dispatcher-owned thread instead of explicit pump() calls.
+        bool m_delivery_thread = false;
+        /// How often the delivery thread pumps.
+        std::chrono::microseconds m_delivery_interval{1000};
+    };
+
+    Dispatcher();
+    explicit Dispatcher(Options options);
+    ~Dispatcher();
+
+    Dispatcher(const Dispatcher&) = delete;
+    Dispatcher& operator=(const Dispatcher&) = delete;
+
+    // ── Synchronous string events ────────────────────────────────────────
+
     /// Register a listener for a specific event.
     void add_listener(const std::string& event, DispatcherListener* listener);
 
-    /// Remove a listener from all events it is registered on.
+    /// Remove a listener from all events it is registered on, string and posted.
     void remove_listener(DispatcherListener* listener);
 
     /// Dispatch an event with data. Notifies all registered listeners.
     void dispatch(const std::string& event, const std::string& data);
 
+    // ── Posted events ────────────────────────────────────────────────────
+
+    /// ID for @p name, assigning the next one on first use. NOT real-time safe.
+    EventId intern(std::string_view name);
+
+    /// Name an ID was interned from; empty for unknown IDs.
+    std::string event_name(EventId event) const;
+
+    /// Register a listener for posted events with ID @p event.
+    void add_listener(EventId event,
+                      DispatcherListener* listener,
+                      Delivery delivery = Delivery::Every);
+
+    /**
+     * @brief Queue an event for deferred delivery
+     *
+     * Copies @p payload into a pool slot. Lock-free and allocation-free.
+     * Returns false — and counts the event in num_dropped() — when the
+     * payload exceeds Options::m_max_payload_size or every slot is in flight.
+     */
+    bool post(EventId event, std::span<const std::byte> payload = {}) TANH_NONBLOCKING_FUNCTION;
+
+    /// Queue a trivially copyable value as the payload.
+    template <typename T>
+        requires(!std::is_convertible_v<const T&, std::span<const std::byte>>)
+    bool post(EventId event, const T& value) TANH_NONBLOCKING_FUNCTION {
+        static_assert(std::is_trivially_copyable_v<T>, "posted payloads must be trivially copyable");
+        return post(event, std::as_bytes(std::span<const T, 1>(&value, 1)));
+    }
+
+    /**
+     * @brief Deliver every queued event on the calling thread
+     *
+     * Only one thread pumps at a time; do not call while the delivery thread
+     * is running. Returns the number of listener callbacks made.
+     */
+    size_t pump();
+
+    /// Events post() rejected since construction.
+    uint64_t num_dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
 private:
-    std::mutex m_mutex;
+    struct Subscription {
+        DispatcherListener* m_listener;
+        Delivery m_delivery;
+    };
+
+    struct Message {
+        EventId m_event;
+        uint32_t m_slot;
+        uint32_t m_size;
+    };
+
+    void delivery_loop();
+
+    Options m_options;
+
+    mutable std::mutex m_mutex;
     std::unordered_map<std::string, std::vector<DispatcherListener*>> m_listeners;
+
+    // Posted events — tables guarded by m_mutex
+    std::unordered_map<std::string, EventId> m_event_ids;
+    std::vector<std::string> m_event_names;
+    std::vector<std::vector<Subscription>> m_subscriptions;
+
+    // Payload pool: m_free_slots hands out slot indices, m_pending carries
+    // posted messages to the pump
+    std::vector<std::byte> m_payloads;
+    MPMCQueue<uint32_t> m_free_slots;
+    MPMCQueue<Message> m_pending;
+    std::atomic<uint64_t> m_dropped{0};
+
+    // Pump scratch: drained messages, and per event ID the batch index of its
+    // last message (for Delivery::Latest)
+    std::vector<Message> m_batch;
+    std::vector<uint32_t> m_last_index;
+
+    std::atomic<bool> m_stop{false};
+    std::thread m_delivery;
 };
 
 }  // namespace thl
@@ -1,17 +1,22 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 
 #include "tanh/core/Exports.h"
+#include "tanh/utils/RealtimeSanitizer.h"
 
 /// @namespace thl::Logger
 /// @brief Unified logging facade with compile-time filtering, platform sinks,
 ///        file output, and optional callback forwarding.
 ///
-/// All logging is synchronous: sinks run on the caller's thread.  The logger
-/// is not real-time safe -- do not call from the audio thread.
+/// log(), logf() and the shorthands are synchronous: sinks run on the
+/// caller's thread, so they are not real-time safe.  From the audio thread use
+/// rt_log() and friends, which enqueue a fixed-size binary record that a
+/// background thread formats and hands to the same sinks.
 namespace thl::Logger {
 
 /// Severity levels, ordered from most to least severe.
@@ -52,6 +57,18 @@ struct LoggerConfig {
     /// When a callback is set via set_callback(), buffered records are
     /// replayed synchronously.  Set to 0 to disable buffering.
     std::size_t m_early_buffer_capacity = 64;
+
+    /// Capacity of each thread's real-time record ring, in records.  Applies
+    /// to threads that call rt_register_thread() afterwards.
+    std::size_t m_rt_ring_capacity = 256;
+
+    /// Binary sink: records appended to memory-mapped segment files in
+    /// @c m_binary_directory (see BinaryLog.h).  Decode them offline with
+    /// thl_log_decode.
+    bool m_binary_enabled = false;
+    std::string m_binary_directory;                              ///< Empty = no writes.
+    std::size_t m_binary_segment_size = std::size_t{4} << 20;  ///< Bytes per segment.
+    std::size_t m_binary_max_segments = 4;                      ///< 0 = keep every segment.
 };
 
 /// @brief Apply a new sink configuration.
@@ -116,4 +133,118 @@ TANH_API void info(const char* group, const char* message);
 TANH_API void debug(const char* group, const char* message);
 /// @}
 
+/// @name Real-time logging
+///
+/// rt_log() copies level, group, format and up to k_rt_max_args numeric
+/// arguments into a fixed-size RtRecord and pushes it onto the calling
+/// thread's lock-free ring -- no formatting, locking or allocation.  A
+/// background drain thread formats queued records printf-style and
+/// dispatches them to the configured sinks.  Group and format strings are
+/// not copied: they act as IDs and must have static storage duration
+/// (string literals).
+///
+/// The drain thread starts on the first set_config(), rt_register_thread()
+/// or rt_start() call -- never while the library loads.  Call rt_stop()
+/// before unloading the library as a Windows DLL: joining the thread from
+/// static destruction there deadlocks on the loader lock.
+///
+/// Call rt_register_thread() from each real-time thread during setup; it
+/// allocates the thread's ring.  Records from unregistered threads go
+/// through one shared lock-free ring instead.  A full ring drops the record
+/// and counts it in rt_stats().
+/// @{
+
+/// Maximum numeric arguments per real-time record.
+inline constexpr std::size_t k_rt_max_args = 6;
+
+/// Type of one RtRecord argument.
+enum class RtArgType : std::uint8_t { Int, Uint, Float };
+
+/// Value of one RtRecord argument; the active member is given by RtArgType.
+union RtArgValue {
+    std::int64_t m_int;
+    std::uint64_t m_uint;
+    double m_float;
+};
+
+/// A binary log entry produced by rt_log().
+struct RtRecord {
+    std::uint64_t m_monotonic_ns = 0;  ///< Steady-clock epoch (ns) at rt_log().
+    const char* m_group = nullptr;     ///< Static group string (the group ID).
+    const char* m_format = nullptr;    ///< Static printf format (the format ID).
+    std::uint32_t m_level = static_cast<std::uint32_t>(LogLevel::Info);
+    std::uint32_t m_num_args = 0;
+    std::array<RtArgType, k_rt_max_args> m_arg_types{};
+    std::array<RtArgValue, k_rt_max_args> m_args{};
+};
+
+/// Counters of the real-time front end since process start.
+struct RtStats {
+    std::uint64_t m_submitted = 0;  ///< Records accepted onto a ring.
+    std::uint64_t m_dropped = 0;    ///< Records lost to a full ring.
+};
+
+/// Enqueue @p record; false (and counted as dropped) if the ring is full.
+TANH_API bool rt_submit(RtRecord& record) TANH_NONBLOCKING_FUNCTION;
+
+/// Real-time safe printf-style logging with numeric arguments only.
+template <typename... Args>
+bool rt_log(LogLevel level, const char* group, const char* format, Args... args)
+    TANH_NONBLOCKING_FUNCTION {
+    static_assert(sizeof...(Args) <= k_rt_max_args, "too many rt_log arguments");
+    static_assert((std::is_arithmetic_v<Args> && ...), "rt_log arguments must be numeric");
+
+    RtRecord record;
+    record.m_group = group;
+    record.m_format = format;
+    record.m_level = static_cast<std::uint32_t>(level);
+    [[maybe_unused]] auto push = [&record](auto value) {
+        const std::uint32_t i = record.m_num_args++;
+        if constexpr (std::is_floating_point_v<decltype(value)>) {
+            record.m_arg_types[i] = RtArgType::Float;
+            record.m_args[i].m_float = static_cast<double>(value);
+        } else if constexpr (std::is_signed_v<decltype(value)>) {
+            record.m_arg_types[i] = RtArgType::Int;
+            record.m_args[i].m_int = static_cast<std::int64_t>(value);
+        } else {
+            record.m_arg_types[i] = RtArgType::Uint;
+            record.m_args[i].m_uint = static_cast<std::uint64_t>(value);
+        }
+    };
+    (push(args), ...);
+    return rt_submit(record);
+}
+
+template <typename... Args>
+bool rt_error(const char* group, const char* format, Args... args) TANH_NONBLOCKING_FUNCTION {
+    return rt_log(LogLevel::Error, group, format, args...);
+}
+
+template <typename... Args>
+bool rt_warning(const char* group, const char* format, Args... args) TANH_NONBLOCKING_FUNCTION {
+    return rt_log(LogLevel::Warning, group, format, args...);
+}
+
+/// Allocate the calling thread's ring and start the drain thread.
+/// NOT real-time safe; call during setup.  Safe to call repeatedly.
+TANH_API void rt_register_thread();
+
+/// Start the drain thread if it is not running.  NOT real-time safe.
+TANH_API void rt_start();
+
+/// Join the drain thread and dispatch what is still queued.  rt_start()
+/// (or any call that starts it) restarts it.  NOT real-time safe.
+TANH_API void rt_stop();
+
+/// Format and dispatch every queued real-time record on the calling thread.
+TANH_API void rt_flush();
+
+/// Snapshot of the real-time counters.
+TANH_API RtStats rt_stats();
+
+/// Expand @p record's format with its arguments (no sinks involved).
+TANH_API std::string format_rt_message(const RtRecord& record);
+
+/// @}
+
 }  // namespace thl::Logger
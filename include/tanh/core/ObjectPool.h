@@ -0,0 +1,142 @@
+#pragma once
+
+#include <tanh/utils/RealtimeSanitizer.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace thl {
+
+/**
+ * @brief Fixed-capacity pool of recycled objects for voices, grains and the like
+ *
+ * prepare() allocates every slot up front; on the audio thread acquire() and
+ * release() are O(1) and never allocate. Free slots form an intrusive
+ * singly-linked list threaded through the slots themselves, and live slots
+ * are tracked in a dense index array, so for_each() visits live objects only
+ * — no scan over inactive ones.
+ *
+ * Slots are cache-line aligned, so objects owned by different voices never
+ * share a line. Each slot keeps a stable index in [0, capacity()), usable as
+ * an external ID (index_of()).
+ *
+ * Objects are default-constructed by prepare() and then recycled: acquire()
+ * returns an object in whatever state its last user left it. Single-threaded.
+ *
+ * @tparam T Default-constructible object type
+ */
+template <typename T>
+class ObjectPool {
+    static_assert(std::is_default_constructible_v<T>, "ObjectPool objects must be default-constructible");
+
+public:
+    static constexpr size_t k_slot_alignment = 64;
+
+    ObjectPool() = default;
+    explicit ObjectPool(size_t capacity) { prepare(capacity); }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) noexcept = default;
+    ObjectPool& operator=(ObjectPool&&) noexcept = default;
+
+    /// Allocate @p capacity fresh slots, all free. NOT real-time safe.
+    void prepare(size_t capacity) {
+        assert(capacity < k_none && "ObjectPool capacity out of range");
+        m_slots = std::make_unique<Slot[]>(capacity);
+        m_live = std::make_unique<uint32_t[]>(capacity);
+        m_capacity = static_cast<uint32_t>(capacity);
+        release_all();
+    }
+
+    /// A free object, or nullptr if every slot is live.
+    [[nodiscard]] T* acquire() noexcept TANH_NONBLOCKING_FUNCTION {
+        if (m_free_head == k_none) { return nullptr; }
+        const uint32_t index = m_free_head;
+        Slot& slot = m_slots[index];
+        m_free_head = slot.m_next_free;
+        slot.m_live_position = m_num_live;
+        m_live[m_num_live++] = index;
+        return &slot.m_value;
+    }
+
+    /// Return @p object, which must be live and come from this pool.
+    void release(T* object) noexcept TANH_NONBLOCKING_FUNCTION {
+        const uint32_t index = static_cast<uint32_t>(index_of(object));
+        Slot& slot = m_slots[index];
+        assert(slot.m_live_position != k_none && "ObjectPool: release of a free object");
+
+        // Swap-remove from the live array
+        const uint32_t moved = m_live[--m_num_live];
+        m_live[slot.m_live_position] = moved;
+        m_slots[moved].m_live_position = slot.m_live_position;
+
+        slot.m_live_position = k_none;
+        slot.m_next_free = m_free_head;
+        m_free_head = index;
+    }
+
+    /// Release every live object.
+    void release_all() noexcept TANH_NONBLOCKING_FUNCTION {
+        m_num_live = 0;
+        m_free_head = m_capacity > 0 ? 0 : k_none;
+        for (uint32_t i = 0; i < m_capacity; ++i) {
+            m_slots[i].m_next_free = i + 1 < m_capacity ? i + 1 : k_none;
+            m_slots[i].m_live_position = k_none;
+        }
+    }
+
+    /**
+     * @brief Call @p func(T&) on every live object
+     *
+     * @p func may release() the object it is given. Visiting order is
+     * unspecified and changes as objects are released.
+     */
+    template <typename Func>
+    void for_each(Func&& func) TANH_NONBLOCKING_FUNCTION {
+        // Backwards, so a swap-remove only moves an already visited object
+        for (uint32_t i = m_num_live; i-- > 0;) { func(m_slots[m_live[i]].m_value); }
+    }
+
+    template <typename Func>
+    void for_each(Func&& func) const TANH_NONBLOCKING_FUNCTION {
+        for (uint32_t i = m_num_live; i-- > 0;) {
+            func(static_cast<const T&>(m_slots[m_live[i]].m_value));
+        }
+    }
+
+    /// Stable slot index of @p object, in [0, capacity()).
+    [[nodiscard]] size_t index_of(const T* object) const noexcept {
+        const auto offset = reinterpret_cast<std::uintptr_t>(object) -
+                            reinterpret_cast<std::uintptr_t>(&m_slots[0].m_value);
+        assert(offset / sizeof(Slot) < m_capacity && offset % sizeof(Slot) == 0 &&
+               "ObjectPool: object from another pool");
+        return static_cast<size_t>(offset / sizeof(Slot));
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return m_num_live; }
+    [[nodiscard]] size_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_num_live == 0; }
+    [[nodiscard]] bool full() const noexcept { return m_num_live == m_capacity; }
+
+private:
+    static constexpr uint32_t k_none = UINT32_MAX;
+
+    struct alignas(k_slot_alignment) Slot {
+        T m_value{};
+        uint32_t m_next_free = k_none;      // free list link, while free
+        uint32_t m_live_position = k_none;  // index into m_live, while live
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::unique_ptr<uint32_t[]> m_live;
+    uint32_t m_capacity = 0;
+    uint32_t m_num_live = 0;
+    uint32_t m_free_head = k_none;
+};
+
+}  // namespace thl
@@ -0,0 +1,421 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace thl {
+
+/**
+ * @brief Persistent hash map with structural sharing, built for RCU indices
+ *
+ * A compressed hash-array mapped trie (CHAMP): every node covers 5 bits of
+ * the key's hash and stores up to 32 slots, split by two bitmaps into inline
+ * entries and child nodes. Nodes are immutable once built and shared between
+ * versions through std::shared_ptr, so copying the map copies one pointer and
+ * an insert or erase copies only the O(log32 N) nodes on the path to the key.
+ *
+ * That makes RCU<PersistentHashMap<...>>::update() cost O(log N) instead of
+ * a full copy of the index, while readers traverse immutable nodes without
+ * locks, allocations or reference-count traffic (wait-free).
+ *
+ * Iteration order is unspecified. Keys whose full hashes collide end up in a
+ * linear collision node below the last hash level.
+ *
+ * Usage:
+ * ```cpp
+ * thl::RCU<thl::PersistentHashMap<std::string, int>> index;
+ * index.update([](auto& map) { map.insert_or_assign("gain", 1); });
+ * index.read([](const auto& map) {
+ *     if (const int* value = map.find("gain")) { use(*value); }
+ * });
+ * ```
+ *
+ * @tparam Key Key type (copyable)
+ * @tparam Value Mapped type (copyable)
+ * @tparam Hash Hash functor. Make it transparent (accepting e.g.
+ * std::string_view for std::string keys) to enable heterogeneous lookup.
+ * @tparam KeyEqual Equality functor; the transparent default compares any
+ * types with operator==.
+ */
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<>>
+class PersistentHashMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    static constexpr unsigned k_bits_per_level = 5;
+    static constexpr uint64_t k_level_mask = (uint64_t{1} << k_bits_per_level) - 1;
+    // Levels that consume hash bits; nodes at this depth are collision nodes.
+    static constexpr unsigned k_hash_levels = (64 + k_bits_per_level - 1) / k_bits_per_level;
+
+    struct Node {
+        uint32_t m_entry_map = 0;  // slots holding an inline entry
+        uint32_t m_child_map = 0;  // slots holding a child node
+        std::vector<value_type> m_entries;
+        std::vector<NodePtr> m_children;
+    };
+
+public:
+    /**
+     * @brief Forward iterator over all entries
+     *
+     * Walks the trie with a fixed-size stack, so iterating never allocates.
+     * Valid as long as the map version it came from is alive.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = PersistentHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return top().m_node->m_entries[top().m_entry]; }
+        pointer operator->() const { return &**this; }
+
+        const_iterator& operator++() {
+            ++top().m_entry;
+            settle();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            if (a.m_depth != b.m_depth) { return false; }
+            if (a.m_depth == 0) { return true; }
+            return a.top().m_node == b.top().m_node && a.top().m_entry == b.top().m_entry;
+        }
+
+    private:
+        friend class PersistentHashMap;
+
+        struct Frame {
+            const Node* m_node = nullptr;
+            size_t m_entry = 0;
+            size_t m_child = 0;
+        };
+
+        explicit const_iterator(const Node* root) {
+            if (root == nullptr) { return; }
+            m_stack[0] = {root, 0, 0};
+            m_depth = 1;
+            settle();
+        }
+
+        Frame& top() { return m_stack[m_depth - 1]; }
+        const Frame& top() const { return m_stack[m_depth - 1]; }
+
+        // Moves to the next entry at or after the current position: a node's
+        // entries first, then its children depth-first.
+        void settle() {
+            while (m_depth > 0) {
+                Frame& frame = top();
+                if (frame.m_entry < frame.m_node->m_entries.size()) { return; }
+                if (frame.m_child < frame.m_node->m_children.size()) {
+                    const Node* child = frame.m_node->m_children[frame.m_child++].get();
+                    m_stack[m_depth++] = {child, 0, 0};
+                    continue;
+                }
+                --m_depth;
+            }
+        }
+
+        std::array<Frame, k_hash_levels + 1> m_stack{};
+        size_t m_depth = 0;
+    };
+
+    using iterator = const_iterator;
+
+    PersistentHashMap() = default;
+
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+    const_iterator begin() const { return const_iterator(m_root.get()); }
+    const_iterator end() const { return const_iterator(); }
+
+    /**
+     * @brief Look up a key
+     * @return Pointer to the mapped value, or nullptr if absent. Valid as long
+     * as this map version is alive.
+     */
+    template <typename K>
+    [[nodiscard]] const Value* find(const K& key) const {
+        const uint64_t hash = hash_of(key);
+        const Node* node = m_root.get();
+        for (unsigned depth = 0; node != nullptr; ++depth) {
+            if (depth >= k_hash_levels) {
+                for (const auto& entry : node->m_entries) {
+                    if (KeyEqual{}(entry.first, key)) { return &entry.second; }
+                }
+                return nullptr;
+            }
+            const uint32_t bit = slot_bit(hash, depth);
+            if ((node->m_entry_map & bit) != 0) {
+                const auto& entry = node->m_entries[slot_index(node->m_entry_map, bit)];
+                return KeyEqual{}(entry.first, key) ? &entry.second : nullptr;
+            }
+            if ((node->m_child_map & bit) == 0) { return nullptr; }
+            node = node->m_children[slot_index(node->m_child_map, bit)].get();
+        }
+        return nullptr;
+    }
+
+    template <typename K>
+    [[nodiscard]] bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Insert key → value unless the key is already present
+     * @return true if inserted, false if the key existed (map unchanged)
+     */
+    bool insert(Key key, Value value) { return put(std::move(key), std::move(value), false); }
+
+    /**
+     * @brief Insert key → value, replacing the value of an existing key
+     * @return true if a new key was inserted, false if a value was replaced
+     */
+    bool insert_or_assign(Key key, Value value) {
+        return put(std::move(key), std::move(value), true);
+    }
+
+    /**
+     * @brief Remove a key
+     * @return true if the key was present
+     */
+    template <typename K>
+    bool erase(const K& key) {
+        if (m_root == nullptr) { return false; }
+        bool erased = false;
+        NodePtr root = erase_from(*m_root, 0, hash_of(key), key, erased);
+        if (!erased) { return false; }
+        m_root = std::move(root);
+        --m_size;
+        return true;
+    }
+
+    void clear() {
+        m_root.reset();
+        m_size = 0;
+    }
+
+private:
+    template <typename K>
+    static uint64_t hash_of(const K& key) {
+        return static_cast<uint64_t>(Hash{}(key));
+    }
+
+    static uint32_t slot_bit(uint64_t hash, unsigned depth) {
+        return uint32_t{1} << ((hash >> (depth * k_bits_per_level)) & k_level_mask);
+    }
+
+    // Position of `bit`'s slot among the populated slots of `map`.
+    static size_t slot_index(uint32_t map, uint32_t bit) {
+        return static_cast<size_t>(std::popcount(map & (bit - 1)));
+    }
+
+    bool put(Key&& key, Value&& value, bool assign) {
+        const uint64_t hash = hash_of(key);
+        bool inserted = false;
+        NodePtr root = m_root == nullptr
+                           ? leaf(std::move(key), std::move(value), hash, 0, inserted)
+                           : put_into(*m_root, 0, hash, key, value, assign, inserted);
+        if (root == nullptr) { return false; }  // existing key, no assign
+        m_root = std::move(root);
+        if (inserted) { ++m_size; }
+        return inserted;
+    }
+
+    static NodePtr leaf(Key&& key, Value&& value, uint64_t hash, unsigned depth, bool& inserted) {
+        auto node = std::make_shared<Node>();
+        if (depth < k_hash_levels) { node->m_entry_map = slot_bit(hash, depth); }
+        node->m_entries.emplace_back(std::move(key), std::move(value));
+        inserted = true;
+        return node;
+    }
+
+    // Path-copying insert. Returns the replacement for `node`, or nullptr if
+    // the key exists and assign is false.
+    static NodePtr put_into(const Node& node,
+                            unsigned depth,
+                            uint64_t hash,
+                            Key& key,
+                            Value& value,
+                            bool assign,
+                            bool& inserted) {
+        if (depth >= k_hash_levels) {
+            for (size_t i = 0; i < node.m_entries.size(); ++i) {
+                if (KeyEqual{}(node.m_entries[i].first, key)) {
+                    if (!assign) { return nullptr; }
+                    auto copy = std::make_shared<Node>(node);
+                    copy->m_entries[i].second = std::move(value);
+                    return copy;
+                }
+            }
+            auto copy = std::make_shared<Node>(node);
+            copy->m_entries.emplace_back(std::move(key), std::move(value));
+            inserted = true;
+            return copy;
+        }
+
+        const uint32_t bit = slot_bit(hash, depth);
+        if ((node.m_entry_map & bit) != 0) {
+            const size_t index = slot_index(node.m_entry_map, bit);
+            const value_type& existing = node.m_entries[index];
+            if (KeyEqual{}(existing.first, key)) {
+                if (!assign) { return nullptr; }
+                auto copy = std::make_shared<Node>(node);
+                copy->m_entries[index].second = std::move(value);
+                return copy;
+            }
+            // Two keys share this slot: push both one level down.
+            NodePtr child = merge(value_type(existing),
+                                  hash_of(existing.first),
+                                  value_type(std::move(key), std::move(value)),
+                                  hash,
+                                  depth + 1);
+            inserted = true;
+            auto copy = std::make_shared<Node>(node);
+            copy->m_entry_map &= ~bit;
+            copy->m_entries.erase(copy->m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+            copy->m_child_map |= bit;
+            copy->m_children.insert(
+                copy->m_children.begin() +
+                    static_cast<std::ptrdiff_t>(slot_index(copy->m_child_map, bit)),
+                std::move(child));
+            return copy;
+        }
+        if ((node.m_child_map & bit) != 0) {
+            const size_t index = slot_index(node.m_child_map, bit);
+            NodePtr child =
+                put_into(*node.m_children[index], depth + 1, hash, key, value, assign, inserted);
+            if (child == nullptr) { return nullptr; }
+            auto copy = std::make_shared<Node>(node);
+            copy->m_children[index] = std::move(child);
+            return copy;
+        }
+        auto copy = std::make_shared<Node>(node);
+        copy->m_entry_map |= bit;
+        copy->m_entries.emplace(copy->m_entries.begin() +
+                                    static_cast<std::ptrdiff_t>(slot_index(copy->m_entry_map, bit)),
+                                std::move(key),
+                                std::move(value));
+        inserted = true;
+        return copy;
+    }
+
+    // Smallest subtree at `depth` holding two entries with distinct keys.
+    static NodePtr merge(value_type a, uint64_t hash_a, value_type b, uint64_t hash_b,
+                         unsigned depth) {
+        auto node = std::make_shared<Node>();
+        if (depth >= k_hash_levels) {
+            node->m_entries.push_back(std::move(a));
+            node->m_entries.push_back(std::move(b));
+            return node;
+        }
+        const uint32_t bit_a = slot_bit(hash_a, depth);
+        const uint32_t bit_b = slot_bit(hash_b, depth);
+        if (bit_a == bit_b) {
+            node->m_child_map = bit_a;
+            node->m_children.push_back(
+                merge(std::move(a), hash_a, std::move(b), hash_b, depth + 1));
+            return node;
+        }
+        node->m_entry_map = bit_a | bit_b;
+        if (bit_a < bit_b) {
+            node->m_entries.push_back(std::move(a));
+            node->m_entries.push_back(std::move(b));
+        } else {
+            node->m_entries.push_back(std::move(b));
+            node->m_entries.push_back(std::move(a));
+        }
+        return node;
+    }
+
+    // Path-copying erase. Sets `erased` and returns the replacement for
+    // `node` (nullptr once it is empty). Keeps the trie canonical: a child
+    // left with a single entry and no children is inlined into its parent.
+    template <typename K>
+    static NodePtr erase_from(const Node& node,
+                              unsigned depth,
+                              uint64_t hash,
+                              const K& key,
+                              bool& erased) {
+        if (depth >= k_hash_levels) {
+            for (size_t i = 0; i < node.m_entries.size(); ++i) {
+                if (KeyEqual{}(node.m_entries[i].first, key)) {
+                    erased = true;
+                    if (node.m_entries.size() == 1) { return nullptr; }
+                    auto copy = std::make_shared<Node>(node);
+                    copy->m_entries.erase(copy->m_entries.begin() +
+                                          static_cast<std::ptrdiff_t>(i));
+                    return copy;
+                }
+            }
+            return nullptr;
+        }
+
+        const uint32_t bit = slot_bit(hash, depth);
+        if ((node.m_entry_map & bit) != 0) {
+            const size_t index = slot_index(node.m_entry_map, bit);
+            if (!KeyEqual{}(node.m_entries[index].first, key)) { return nullptr; }
+            erased = true;
+            if (node.m_entries.size() == 1 && node.m_children.empty()) { return nullptr; }
+            auto copy = std::make_shared<Node>(node);
+            copy->m_entry_map &= ~bit;
+            copy->m_entries.erase(copy->m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+            return copy;
+        }
+        if ((node.m_child_map & bit) == 0) { return nullptr; }
+
+        const size_t index = slot_index(node.m_child_map, bit);
+        NodePtr child = erase_from(*node.m_children[index], depth + 1, hash, key, erased);
+        if (!erased) { return nullptr; }
+
+        auto copy = std::make_shared<Node>(node);
+        if (child != nullptr && !(child->m_children.empty() && child->m_entries.size() == 1)) {
+            copy->m_children[index] = std::move(child);
+            return copy;
+        }
+        copy->m_child_map &= ~bit;
+        copy->m_children.erase(copy->m_children.begin() + static_cast<std::ptrdiff_t>(index));
+        if (child != nullptr) {
+            // Inline the lone remaining entry into this node's slot.
+            copy->m_entry_map |= bit;
+            copy->m_entries.insert(copy->m_entries.begin() +
+                                       static_cast<std::ptrdiff_t>(
+                                           slot_index(copy->m_entry_map, bit)),
+                                   child->m_entries.front());
+        }
+        if (copy->m_entries.empty() && copy->m_children.empty()) { return nullptr; }
+        return copy;
+    }
+
+    NodePtr m_root;
+    size_t m_size = 0;
+};
+
+}  // namespace thl
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <tanh/utils/RealtimeSanitizer.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+
+namespace thl {
+
+/**
+ * @brief Bump allocator for per-block scratch memory on the audio thread
+ *
+ * Owners declare what one block can need while preparing — a reserve() per
+ * scratch buffer — and prepare() allocates a single block that fits all of
+ * it. On the audio thread, reset() at the start of each block rewinds the
+ * arena and allocate<T>() hands out spans by bumping an offset: no locks, no
+ * heap, nothing freed individually.
+ *
+ * The arena is also a std::pmr::memory_resource, so pmr containers on the
+ * audio thread can draw from it; their deallocations are no-ops. Running
+ * past the prepared capacity is a sizing bug: debug builds assert, release
+ * builds count it in num_overflows(). allocate<T>() then returns an empty
+ * span, while pmr allocations fall back to the upstream resource (which
+ * allocates on the audio thread).
+ *
+ * reset() reports the finished block's usage to an optional BlockHook, so
+ * hosts can track peak scratch usage per block.
+ */
+class ScratchArena : public std::pmr::memory_resource {
+public:
+    /// Called from reset() with the bytes the finished block used.
+    using BlockHook = void (*)(void* context, size_t used_bytes, size_t capacity_bytes);
+
+    explicit ScratchArena(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : m_upstream(upstream) {}
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    // ── Prepare time ─────────────────────────────────────────────────────
+
+    /// Forget every reserve() since the last prepare().
+    void clear_requirements() { m_required = 0; }
+
+    /// Declare @p bytes of scratch at @p alignment. Order-independent.
+    void reserve(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        m_required += bytes + alignment - 1;  // worst-case padding
+    }
+
+    template <typename T>
+    void reserve(size_t count) {
+        reserve(count * sizeof(T), alignof(T));
+    }
+
+    /// Allocate storage for the declared requirements and rewind. Resets
+    /// peak() and num_overflows(). NOT real-time safe.
+    void prepare() {
+        if (m_required != m_capacity) {
+            m_storage = m_required > 0 ? std::make_unique<std::byte[]>(m_required) : nullptr;
+            m_capacity = m_required;
+        }
+        m_used = 0;
+        m_peak = 0;
+        m_num_overflows = 0;
+    }
+
+    // ── Audio thread ─────────────────────────────────────────────────────
+
+    /// Start a block: report the previous block's usage and rewind.
+    void reset() TANH_NONBLOCKING_FUNCTION {
+        if (m_hook != nullptr) { m_hook(m_hook_context, m_used, m_capacity); }
+        m_peak = std::max(m_peak, m_used);
+        m_used = 0;
+    }
+
+    /// @p bytes at @p alignment, or nullptr if the arena is exhausted.
+    void* allocate_bytes(size_t bytes, size_t alignment) TANH_NONBLOCKING_FUNCTION {
+        const auto base = reinterpret_cast<std::uintptr_t>(m_storage.get());
+        const std::uintptr_t aligned = (base + m_used + alignment - 1) & ~(alignment - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (m_storage == nullptr || end > m_capacity) {
+            ++m_num_overflows;
+            assert(false && "ScratchArena overflow: reserve() more before prepare()");
+            return nullptr;
+        }
+        m_used = end;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// @p count default-initialized elements; empty if the arena is exhausted.
+    template <typename T>
+    std::span<T> allocate(size_t count) TANH_NONBLOCKING_FUNCTION {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "ScratchArena never runs destructors");
+        if (count == 0) { return {}; }
+        void* memory = allocate_bytes(count * sizeof(T), alignof(T));
+        if (memory == nullptr) { return {}; }
+        T* data = static_cast<T*>(memory);
+        std::uninitialized_default_construct_n(data, count);
+        return {data, count};
+    }
+
+    void set_block_hook(BlockHook hook, void* context = nullptr) {
+        m_hook = hook;
+        m_hook_context = context;
+    }
+
+    size_t capacity() const { return m_capacity; }
+    size_t used() const { return m_used; }
+    /// Most bytes any block used since prepare().
+    size_t peak() const { return std::max(m_peak, m_used); }
+    /// Allocations that did not fit since prepare().
+    size_t num_overflows() const { return m_num_overflows; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (void* memory = allocate_bytes(bytes, alignment)) { return memory; }
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        const auto* bytes_ptr = static_cast<const std::byte*>(p);
+        const bool in_arena =
+            m_storage != nullptr && bytes_ptr >= m_storage.get() && bytes_ptr < m_storage.get() + m_capacity;
+        if (!in_arena) { m_upstream->deallocate(p, bytes, alignment); }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::unique_ptr<std::byte[]> m_storage;
+    size_t m_capacity = 0;
+    size_t m_required = 0;
+    size_t m_used = 0;
+    size_t m_peak = 0;
+    size_t m_num_overflows = 0;
+
+    BlockHook m_hook = nullptr;
+    void* m_hook_context = nullptr;
+    std::pmr::memory_resource* m_upstream;
+};
+
+}  // namespace thl
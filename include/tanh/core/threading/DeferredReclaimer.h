@@ -0,0 +1,200 @@
+#pragma once
+
+#include <tanh/core/Exports.h>
+#include <tanh/core/threading/MPMCQueue.h>
+#include <tanh/core/threading/RCU.h>
+#include <tanh/utils/RealtimeSanitizer.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace thl {
+
+/**
+ * @brief Destroys retired objects once no reader can still reference them
+ *
+ * A "garbage chute" for memory the audio thread may still be reading. The
+ * thread that unpublishes an object — a writer after swapping a pointer, or
+ * the audio thread itself — hands ownership to retire() and moves on: it
+ * never waits for readers and never runs the destructor. Destruction happens
+ * later on the reclaim thread, or in collect().
+ *
+ * Safety is epoch-based. Readers bracket their accesses with a ReadScope,
+ * which publishes the epoch it entered in through the thread's
+ * RCUReaderSlot. retire() tags the object with the current epoch and
+ * advances it; the object is destroyed once no scope entered at or before
+ * that epoch is still open. Open the scope *before* loading the pointers it
+ * protects — a scope entered after retire() can only see the replacement.
+ *
+ * ReadScope and try_retire() are lock-free and allocation-free once the
+ * thread holds a reader slot (see register_reader_thread()). Retired objects
+ * travel through a bounded queue of Options::m_capacity entries: try_retire()
+ * fails when it is full, retire() spills into a locked overflow list.
+ */
+class TANH_API DeferredReclaimer {
+public:
+    using Destroy = void (*)(void*);
+
+    struct Options {
+        /// Retired objects in flight to the reclaimer. Rounded up to a power of two.
+        size_t m_capacity = 1024;
+        /// Reclaim on a thread owned by the reclaimer instead of explicit collect() calls.
+        bool m_reclaim_thread = true;
+        /// How often the reclaim thread collects.
+        std::chrono::microseconds m_reclaim_interval{1000};
+    };
+
+    /**
+     * @brief RAII read section
+     *
+     * Objects retired while the scope is open stay alive until it closes.
+     * Scopes nest on a thread; only the outermost one publishes its epoch.
+     * The first scope on an unregistered thread claims a reader slot and is
+     * NOT real-time safe.
+     */
+    class [[nodiscard]] ReadScope {
+    public:
+        explicit ReadScope(const DeferredReclaimer& reclaimer) TANH_NONBLOCKING_FUNCTION {
+            const RCUReaderSlot& slot = RCUReaderSlot::acquire();
+            if (slot.is_valid()) [[likely]] {
+                auto& epoch = reclaimer.m_reader_epochs[slot.m_index];
+                if (epoch.load(std::memory_order_relaxed) != 0) { return; }  // Nested
+                m_epoch = &epoch;
+                m_epoch->store(reclaimer.m_epoch.load(std::memory_order_seq_cst),
+                               std::memory_order_relaxed);
+            } else {
+                // Every slot is taken: hold back all reclamation instead
+                m_unslotted = &reclaimer.m_unslotted_readers;
+                m_unslotted->fetch_add(1, std::memory_order_relaxed);
+            }
+            // Pairs with the fence in collect(): either the reclaimer sees
+            // this scope, or this scope sees every pointer swap made before
+            // the retire()s that collect() is about to act on.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        ~ReadScope() {
+            if (m_epoch != nullptr) { m_epoch->store(0, std::memory_order_release); }
+            if (m_unslotted != nullptr) { m_unslotted->fetch_sub(1, std::memory_order_release); }
+        }
+
+        // Moving hands the open section over; the source no longer closes it
+        ReadScope(ReadScope&& other) noexcept
+            : m_epoch(std::exchange(other.m_epoch, nullptr))
+            , m_unslotted(std::exchange(other.m_unslotted, nullptr)) {}
+
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+        ReadScope& operator=(ReadScope&&) = delete;
+
+    private:
+        std::atomic<uint64_t>* m_epoch = nullptr;
+        std::atomic<uint32_t>* m_unslotted = nullptr;
+    };
+
+    DeferredReclaimer();
+    explicit DeferredReclaimer(Options options);
+
+    /// Destroys every object still pending. No ReadScope may be open.
+    ~DeferredReclaimer();
+
+    DeferredReclaimer(const DeferredReclaimer&) = delete;
+    DeferredReclaimer& operator=(const DeferredReclaimer&) = delete;
+
+    /// Process-wide instance with a reclaim thread, created on first use.
+    static DeferredReclaimer& shared();
+
+    /// Claim the calling thread's reader slot ahead of its first ReadScope.
+    /// NOT real-time safe.
+    static void register_reader_thread() { (void)RCUReaderSlot::acquire(); }
+
+    ReadScope read_scope() const TANH_NONBLOCKING_FUNCTION { return ReadScope(*this); }
+
+    /**
+     * @brief Hand @p object to the reclaimer; lock-free and allocation-free
+     *
+     * Returns false when the queue is full, in which case ownership stays
+     * with the caller (retry on a later block).
+     */
+    bool try_retire(void* object, Destroy destroy) TANH_NONBLOCKING_FUNCTION;
+
+    /// try_retire() that falls back to a locked overflow list. NOT real-time safe.
+    void retire(void* object, Destroy destroy);
+
+    /// Typed try_retire(); on success @p object is released.
+    template <typename T>
+    bool try_retire(std::unique_ptr<T>& object) TANH_NONBLOCKING_FUNCTION {
+        if (!object) { return true; }
+        if (!try_retire(object.get(), &destroy_as<T>)) { return false; }
+        (void)object.release();
+        return true;
+    }
+
+    /// Typed retire().
+    template <typename T>
+    void retire(std::unique_ptr<T> object) {
+        if (object) { retire(object.release(), &destroy_as<T>); }
+    }
+
+    /**
+     * @brief Destroy every retired object no open ReadScope can reference
+     *
+     * Called by the reclaim thread; call it yourself when
+     * Options::m_reclaim_thread is false. Returns the number destroyed.
+     */
+    size_t collect();
+
+    /// Objects retired but not yet destroyed.
+    size_t num_pending() const { return m_num_pending.load(std::memory_order_relaxed); }
+
+    /// Objects destroyed since construction.
+    uint64_t num_reclaimed() const { return m_num_reclaimed.load(std::memory_order_relaxed); }
+
+private:
+    struct Retired {
+        void* m_object;
+        Destroy m_destroy;
+        uint64_t m_epoch;
+    };
+
+    template <typename T>
+    static void destroy_as(void* object) {
+        delete static_cast<T*>(object);
+    }
+
+    void reclaim_loop();
+
+    Options m_options;
+
+    // Epoch retire() tags with; starts at 1 so 0 marks an idle reader slot
+    alignas(64) std::atomic<uint64_t> m_epoch{1};
+    mutable std::array<std::atomic<uint64_t>, RCUReaderSlot::k_count> m_reader_epochs{};
+    mutable std::atomic<uint32_t> m_unslotted_readers{0};
+
+    MPMCQueue<Retired> m_queue;
+    std::mutex m_overflow_mutex;
+    std::vector<Retired> m_overflow;
+
+    // Drained but not yet safe to destroy — guarded by m_collect_mutex
+    std::mutex m_collect_mutex;
+    std::vector<Retired> m_pending;
+
+    std::atomic<size_t> m_num_pending{0};
+    std::atomic<uint64_t> m_num_reclaimed{0};
+
+    std::mutex m_stop_mutex;
+    std::condition_variable m_stop_cv;
+    bool m_stop = false;
+    std::thread m_reclaimer;
+};
+
+}  // namespace thl
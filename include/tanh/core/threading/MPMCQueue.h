@@ -0,0 +1,105 @@
+#pragma once
+
+#include <tanh/utils/RealtimeSanitizer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace thl {
+
+/**
+ * @brief Bounded lock-free multi-producer / multi-consumer queue
+ *
+ * Fixed-capacity ring of cells, each tagged with a sequence number that
+ * tells producers and consumers whether the cell is free for the current
+ * lap (Vyukov's bounded MPMC design). All storage is allocated in the
+ * constructor; try_push() and try_pop() never allocate, never lock and
+ * return false instead of waiting when the queue is full or empty.
+ *
+ * @tparam T Trivially copyable element type
+ */
+template <typename T>
+class MPMCQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "MPMCQueue elements must be trivially copyable");
+
+public:
+    /// @param capacity Minimum number of elements; rounded up to a power of two
+    explicit MPMCQueue(size_t capacity) {
+        size_t rounded = 2;
+        while (rounded < capacity) { rounded <<= 1; }
+        m_mask = rounded - 1;
+        m_cells = std::make_unique<Cell[]>(rounded);
+        for (size_t i = 0; i < rounded; ++i) {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    [[nodiscard]] size_t capacity() const { return m_mask + 1; }
+
+    /// @brief Enqueue a copy of @p value; false if the queue is full.
+    bool try_push(const T& value) noexcept TANH_NONBLOCKING_FUNCTION {
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Full: the cell still holds last lap's value
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->m_value = value;
+        cell->m_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Dequeue the oldest element into @p out; false if the queue is empty.
+    bool try_pop(T& out) noexcept TANH_NONBLOCKING_FUNCTION {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty: no producer has filled this cell yet
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        out = cell->m_value;
+        cell->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> m_sequence{0};
+        T m_value{};
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+
+    // Producers and consumers contend on different cache lines
+    alignas(64) std::atomic<size_t> m_enqueue_pos{0};
+    alignas(64) std::atomic<size_t> m_dequeue_pos{0};
+};
+
+}  // namespace thl
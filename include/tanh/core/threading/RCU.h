@@ -1,18 +1,112 @@
 #pragma once
 
+#include <tanh/core/Exports.h>
 #include <tanh/utils/RealtimeSanitizer.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 namespace thl {
 
+/**
+ * @brief Process-wide reader slot of a thread
+ *
+ * The first RCU registration on a thread claims one of k_count slots; the
+ * slot is released when the thread exits and may then be claimed by another
+ * thread, which gets a new generation. Every RCU instance keeps one reader
+ * node per slot, so a registered thread finds its node by array index
+ * instead of hashing its instance pointer. Threads beyond k_count fall back
+ * to a per-thread hash map.
+ */
+struct RCUReaderSlot {
+    static constexpr uint32_t k_count = 64;
+
+    uint32_t m_index = k_count;
+    uint64_t m_generation = 0;  // 0 = never claimed; unique per claim otherwise
+    bool m_claimed = false;     // claim attempted (m_index == k_count if all were taken)
+
+    bool is_valid() const noexcept { return m_index < k_count; }
+
+    /// @brief Slot of the calling thread, without claiming one.
+    static const RCUReaderSlot& current() noexcept;
+
+    /// @brief Slot of the calling thread, claiming one on first use.
+    /// NOT real-time safe on the first call per thread.
+    static const RCUReaderSlot& acquire();
+
+    /// @brief Generation of the thread currently holding @p index, 0 if free.
+    TANH_API static uint64_t generation_of(uint32_t index) noexcept;
+
+private:
+    TANH_API static RCUReaderSlot claim();
+};
+
+namespace detail {
+inline thread_local RCUReaderSlot t_rcu_reader_slot;
+}  // namespace detail
+
+inline const RCUReaderSlot& RCUReaderSlot::current() noexcept {
+    return detail::t_rcu_reader_slot;
+}
+
+inline const RCUReaderSlot& RCUReaderSlot::acquire() {
+    auto& slot = detail::t_rcu_reader_slot;
+    if (!slot.m_claimed) [[unlikely]] { slot = claim(); }
+    return slot;
+}
+
+/**
+ * @brief Default RCU reclamation policy: the writer frees retired versions
+ *
+ * Every update() opportunistically frees the versions no reader can still
+ * see, retries harder once cleanup_threshold versions are pending, and falls
+ * back to a blocking synchronize once emergency_threshold versions pile up.
+ * Deterministic and thread-free, but a reader that stalls inside a read
+ * section eventually stalls the writer with it.
+ */
+struct GracePeriodReclamation {};
+
+/**
+ * @brief Epoch-based RCU reclamation with a background reclaimer thread
+ *
+ * Readers publish the epoch (grace period) they entered in, exactly as with
+ * GracePeriodReclamation. update() only publishes the new version and queues
+ * the old one, tagged with its epoch; it never waits for readers. A
+ * reclaimer thread owned by the RCU instance frees every queued version
+ * older than the oldest epoch still held by a reader.
+ *
+ * The reclaimer runs every k_reclaim_interval while versions are queued,
+ * and immediately once cleanup_threshold versions are queued (the
+ * emergency_threshold is unused); it sleeps while the queue is empty.
+ * With readers whose sections are bounded (an audio block), a version is
+ * therefore freed within k_reclaim_interval plus one read section of
+ * being retired, and the backlog is bounded by the update rate over that
+ * window. retired_versions() and peak_retired_versions() make it
+ * observable.
+ *
+ * Derive from this policy to change the interval:
+ * ```cpp
+ * struct FastEpochs : thl::EpochReclamation {
+ *     static constexpr std::chrono::microseconds k_reclaim_interval{100};
+ * };
+ * thl::RCU<Config, FastEpochs> config;
+ * ```
+ */
+struct EpochReclamation {
+    static constexpr std::chrono::microseconds k_reclaim_interval{500};
+};
+
 /**
  * @brief Generic RCU (Read-Copy-Update) container for lock-free reads
  *
@@ -24,16 +118,46 @@ namespace thl {
  * entering the real-time context (e.g., during audio setup). This allocates
  * the reader node outside the real-time path.
  *
+ * A registered thread finds its reader node through its RCUReaderSlot, so a
+ * read is one array load plus the generation store/clear. Hot loops can skip
+ * even that by keeping the ReaderToken returned by register_reader_thread()
+ * and calling read(token, func).
+ *
  * @tparam T The type of data to protect (e.g., std::map, std::vector)
+ * @tparam Reclamation How retired versions are freed: GracePeriodReclamation
+ * (default, writer-driven) or EpochReclamation (background thread, writers
+ * never block on readers)
  */
-template <typename T>
+template <typename T, typename Reclamation = GracePeriodReclamation>
 class RCU {
+    static constexpr bool k_epoch_reclamation =
+        std::is_base_of_v<EpochReclamation, Reclamation>;
+
+    struct ReaderNode;
+
 public:
     using DataType = T;
     using DataPtr = std::unique_ptr<T>;
     using ReadFunction = std::function<void(const T&)>;
     using UpdateFunction = std::function<void(T&)>;
 
+    /**
+     * @brief The calling thread's reader node on this instance
+     *
+     * Returned by register_reader_thread(). Valid on the registering thread
+     * only, for the lifetime of the RCU instance and of that thread.
+     */
+    class ReaderToken {
+    public:
+        ReaderToken() = default;
+        bool is_valid() const noexcept { return m_node != nullptr; }
+
+    private:
+        friend class RCU;
+        explicit ReaderToken(ReaderNode* node) : m_node(node) {}
+        ReaderNode* m_node = nullptr;
+    };
+
     /**
      * @brief Construct RCU with initial data
      * @param initial_data Initial value (will be copied)
@@ -47,7 +171,9 @@ public:
                  size_t emergency_threshold = 32)
         : m_data_ptr(new T(initial_data))
         , m_cleanup_threshold(cleanup_threshold)
-        , m_emergency_threshold(emergency_threshold) {}
+        , m_emergency_threshold(emergency_threshold) {
+        start_reclaimer();
+    }
 
     /**
      * @brief Construct RCU with moved data
@@ -60,9 +186,13 @@ public:
     explicit RCU(T&& initial_data, size_t cleanup_threshold = 8, size_t emergency_threshold = 32)
         : m_data_ptr(new T(std::move(initial_data)))
         , m_cleanup_threshold(cleanup_threshold)
-        , m_emergency_threshold(emergency_threshold) {}
+        , m_emergency_threshold(emergency_threshold) {
+        start_reclaimer();
+    }
 
     ~RCU() {
+        stop_reclaimer();
+
         // Clean up any remaining retired data
         for (auto& retired : m_retired_list) { delete retired.m_ptr; }
         m_retired_list.clear();
@@ -130,17 +260,30 @@ public:
         // Auto-register thread if not already registered (not real-time safe
         // not registered already) Make sure to register before calling first
         // read if you want full real-time safety
-        register_reader_thread();
+        return read(ReaderToken(reader_node()), std::forward<Func>(read_func));
+    }
 
+    /**
+     * @brief Lock-free read access through a token from register_reader_thread()
+     *
+     * Skips the per-read node lookup entirely. The token must come from this
+     * instance and the calling thread.
+     */
+    template <typename Func>
+    auto read(ReaderToken token, Func&& read_func) const
+        -> decltype(read_func(std::declval<const T&>())) {
         // RAII guard to ensure rcu_read_unlock() is always called, even if
         // callback throws
         struct ReadGuard {
             const RCU* m_rcu;
-            ReadGuard(const RCU* r) : m_rcu(r) { m_rcu->rcu_read_lock(); }
-            ~ReadGuard() { m_rcu->rcu_read_unlock(); }
+            ReaderNode* m_node;
+            ReadGuard(const RCU* r, ReaderNode* n) : m_rcu(r), m_node(n) {
+                m_rcu->rcu_read_lock(m_node);
+            }
+            ~ReadGuard() { m_rcu->rcu_read_unlock(m_node); }
         };
 
-        const ReadGuard guard(this);
+        const ReadGuard guard(this, token.m_node);
 
         // Load current data pointer (guaranteed valid during read section)
         const T* data = m_data_ptr.load(std::memory_order_acquire);
@@ -186,7 +329,16 @@ public:
         // Retire old version with current grace period
         // Note: At 1 billion updates/sec, takes 584 years to overflow uint64_t
         const uint64_t retire_period = m_grace_period.fetch_add(1, std::memory_order_acq_rel);
+
+        if constexpr (k_epoch_reclamation) {
+            // Hand the old version to the reclaimer thread and return.
+            retire_to_reclaimer({const_cast<T*>(old_data), retire_period});
+            cleanup_dead_nodes();
+            return;
+        }
+
         m_retired_list.push_back({const_cast<T*>(old_data), retire_period});
+        note_retired(1);
 
         // ═══════════════════════════════════════════════════
         // TIER 1: Opportunistic cleanup (always try, non-blocking)
@@ -215,6 +367,7 @@ public:
 
             // Now delete everything in retired list
             for (auto& retired : m_retired_list) { delete retired.m_ptr; }
+            note_reclaimed(m_retired_list.size());
             m_retired_list.clear();
         }
 
@@ -232,6 +385,8 @@ public:
      * Safe to call multiple times - subsequent calls are no-ops.
      * NOT real-time safe (allocates memory on first call per thread).
      *
+     * @return Token for read(token, func) on this thread
+     *
      * @note If not called explicitly, read() will auto-register on first use.
      *       But this first call is NOT real-time safe.
      *
@@ -246,25 +401,42 @@ public:
      * });
      * ```
      */
-    void register_reader_thread() const {
-        if (!t_rcu_state().get_node(this)) {
+    // NOLINTNEXTLINE(modernize-use-nodiscard) — usually called for its side effect.
+    ReaderToken register_reader_thread() const {
+        const RCUReaderSlot& slot = RCUReaderSlot::acquire();
+        if (slot.is_valid()) {
+            ReaderNode* node = m_slot_nodes[slot.m_index].load(std::memory_order_acquire);
+            if (node != nullptr &&
+                node->m_slot_generation.load(std::memory_order_relaxed) == slot.m_generation) {
+                return ReaderToken(node);
+            }
+
             // Serialize with cleanup and count
             const std::scoped_lock lock(m_writer_mutex);
-
-            // Allocate node on heap so it persists beyond thread lifetime
-            auto node = std::make_unique<ReaderNode>();
-            ReaderNode* node_ptr = node.get();
-            // Lock-free registration using atomic compare-and-swap
-            ReaderNode* current_head = m_reader_head.load(std::memory_order_acquire);
-            do {
-                node->m_next.store(current_head, std::memory_order_relaxed);
-            } while (!m_reader_head.compare_exchange_weak(current_head,
-                                                          node_ptr,
-                                                          std::memory_order_release,
-                                                          std::memory_order_acquire));
-
-            t_rcu_state().m_nodes.emplace(this, std::move(node));
+            if (node == nullptr) {
+                // Owned by this instance; a later thread on the same slot reuses it
+                auto owned = std::make_unique<ReaderNode>();
+                owned->m_slot = slot.m_index;
+                node = owned.get();
+                link_reader_node(owned.release());
+                m_slot_nodes[slot.m_index].store(node, std::memory_order_release);
+            }
+            node->m_slot_generation.store(slot.m_generation, std::memory_order_relaxed);
+            return ReaderToken(node);
         }
+
+        if (ReaderNode* node = t_rcu_state().get_node(this)) { return ReaderToken(node); }
+
+        // No slot left: fall back to a node owned by this thread's hash map
+        // Serialize with cleanup and count
+        const std::scoped_lock lock(m_writer_mutex);
+
+        // Allocate node on heap so it persists beyond thread lifetime
+        auto node = std::make_unique<ReaderNode>();
+        ReaderNode* node_ptr = node.get();
+        link_reader_node(node_ptr);
+        t_rcu_state().m_nodes.emplace(this, std::move(node));
+        return ReaderToken(node_ptr);
     }
 
     unsigned int get_reader_count() const {
@@ -273,7 +445,14 @@ public:
         unsigned int count = 0;
         ReaderNode* node = m_reader_head.load(std::memory_order_acquire);
         while (node != nullptr) {
-            if (!node->m_is_dead.load(std::memory_order_acquire)) { ++count; }
+            if (node->m_slot < RCUReaderSlot::k_count) {
+                // Slot nodes outlive their thread; count them while the
+                // thread that registered them still holds the slot
+                const uint64_t generation = node->m_slot_generation.load(std::memory_order_relaxed);
+                if (generation == RCUReaderSlot::generation_of(node->m_slot)) { ++count; }
+            } else if (!node->m_is_dead.load(std::memory_order_acquire)) {
+                ++count;
+            }
             node = node->m_next.load(std::memory_order_acquire);
         }
         return count;
@@ -284,6 +463,23 @@ public:
         synchronize_rcu();
     }
 
+    /**
+     * @brief Number of retired versions not yet freed
+     *
+     * Memory held by retired versions is this count times the size of one T.
+     * Lock-free; safe to poll from any thread.
+     */
+    size_t retired_versions() const {
+        return m_retired_versions.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief High-water mark of retired_versions() since construction
+     */
+    size_t peak_retired_versions() const {
+        return m_peak_retired_versions.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief RAII scope that holds an RCU read section open.
      *
@@ -303,13 +499,13 @@ public:
      */
     class [[nodiscard]] ReadScope {
     public:
-        explicit ReadScope(const RCU* rcu) : m_rcu(rcu) {
-            m_rcu->register_reader_thread();
-            m_rcu->rcu_read_lock();
+        explicit ReadScope(const RCU* rcu) : ReadScope(rcu, ReaderToken(rcu->reader_node())) {}
+        ReadScope(const RCU* rcu, ReaderToken token) : m_rcu(rcu), m_node(token.m_node) {
+            m_rcu->rcu_read_lock(m_node);
             m_data = m_rcu->m_data_ptr.load(std::memory_order_acquire);
         }
         ~ReadScope() {
-            if (m_rcu != nullptr) { m_rcu->rcu_read_unlock(); }
+            if (m_rcu != nullptr) { m_rcu->rcu_read_unlock(m_node); }
         }
         ReadScope(const ReadScope&) = delete;
         ReadScope& operator=(const ReadScope&) = delete;
@@ -321,6 +517,7 @@ public:
 
     private:
         const RCU* m_rcu;
+        ReaderNode* m_node;
         const T* m_data = nullptr;
     };
 
@@ -329,6 +526,13 @@ public:
      */
     ReadScope read_scope() const TANH_NONBLOCKING_FUNCTION { return ReadScope(this); }
 
+    /**
+     * @brief Open an RCU read section through a token. See ReadScope.
+     */
+    ReadScope read_scope(ReaderToken token) const TANH_NONBLOCKING_FUNCTION {
+        return ReadScope(this, token);
+    }
+
 private:
     // RCU-protected data pointer
     std::atomic<T*> m_data_ptr;
@@ -350,17 +554,37 @@ private:
     size_t m_cleanup_threshold;    // Try harder to cleanup
     size_t m_emergency_threshold;  // Force blocking cleanup
 
+    // Retired-version accounting (both policies)
+    std::atomic<size_t> m_retired_versions{0};
+    std::atomic<size_t> m_peak_retired_versions{0};
+
+    // EpochReclamation only: m_retired_list is shared with the reclaimer
+    // thread under m_retire_mutex instead of m_writer_mutex.
+    std::mutex m_retire_mutex;
+    std::condition_variable m_reclaim_cv;
+    bool m_reclaim_requested = false;
+    bool m_stop_reclaimer = false;
+    std::thread m_reclaimer;
+
     // Lock-free linked list node for reader registration
     struct ReaderNode {
         std::atomic<uint64_t> m_read_generation{0};
         std::atomic<ReaderNode*> m_next{nullptr};
         std::atomic<bool> m_is_dead{false};  // Mark node as dead when thread
                                              // exits
+        // Slot nodes only: owning slot and the claim generation that last
+        // registered it. Hash-map nodes keep m_slot == k_count.
+        uint32_t m_slot = RCUReaderSlot::k_count;
+        std::atomic<uint64_t> m_slot_generation{0};
     };
 
     // Per-instance reader list head
     mutable std::atomic<ReaderNode*> m_reader_head{nullptr};
 
+    // Reader node per RCUReaderSlot — written under m_writer_mutex, never
+    // cleared before destruction
+    mutable std::array<std::atomic<ReaderNode*>, RCUReaderSlot::k_count> m_slot_nodes{};
+
     // Thread-local RCU state with per-instance registration tracking
     struct ThreadRCUState {
         // Map from RCU instance pointer to this thread's reader node for that
@@ -397,18 +621,40 @@ private:
         return instance;
     }
 
-    // RCU operations
-    void rcu_read_lock() const {
-        if (auto* node = t_rcu_state().get_node(this)) {
-            const uint64_t current_period = m_grace_period.load(std::memory_order_acquire);
-            node->m_read_generation.store(current_period, std::memory_order_release);
+    // Reader node of the calling thread, registering it on first use
+    ReaderNode* reader_node() const {
+        const RCUReaderSlot& slot = RCUReaderSlot::current();
+        if (slot.is_valid()) [[likely]] {
+            ReaderNode* node = m_slot_nodes[slot.m_index].load(std::memory_order_acquire);
+            if (node != nullptr &&
+                node->m_slot_generation.load(std::memory_order_relaxed) == slot.m_generation)
+                [[likely]] {
+                return node;
+            }
+        } else if (slot.m_claimed) {
+            if (ReaderNode* node = t_rcu_state().get_node(this)) { return node; }
         }
+        return register_reader_thread().m_node;
     }
 
-    void rcu_read_unlock() const {
-        if (auto* node = t_rcu_state().get_node(this)) {
-            node->m_read_generation.store(0, std::memory_order_release);
-        }
+    // Must be called while holding m_writer_mutex
+    void link_reader_node(ReaderNode* node) const {
+        // Lock-free registration using atomic compare-and-swap
+        ReaderNode* current_head = m_reader_head.load(std::memory_order_acquire);
+        do {
+            node->m_next.store(current_head, std::memory_order_relaxed);
+        } while (!m_reader_head.compare_exchange_weak(
+            current_head, node, std::memory_order_release, std::memory_order_acquire));
+    }
+
+    // RCU operations
+    void rcu_read_lock(ReaderNode* node) const {
+        const uint64_t current_period = m_grace_period.load(std::memory_order_acquire);
+        node->m_read_generation.store(current_period, std::memory_order_release);
+    }
+
+    void rcu_read_unlock(ReaderNode* node) const {
+        node->m_read_generation.store(0, std::memory_order_release);
     }
 
     /**
@@ -422,6 +668,31 @@ private:
     void cleanup_safe_versions() {
         if (m_retired_list.empty()) { return; }
 
+        const uint64_t min_active_period = oldest_active_period();
+
+        // Delete all versions older than the threshold
+        size_t reclaimed = 0;
+        auto it = m_retired_list.begin();
+        while (it != m_retired_list.end()) {
+            if (it->m_grace_period < min_active_period) {
+                delete it->m_ptr;  // Safe - all readers past this period
+                it = m_retired_list.erase(it);
+                ++reclaimed;
+            } else {
+                ++it;  // Keep newer versions
+            }
+        }
+        note_reclaimed(reclaimed);
+    }
+
+    /**
+     * @brief Oldest grace period any live reader is currently in
+     *
+     * Returns the current grace period when no reader is inside a read
+     * section. Must be called while holding m_writer_mutex (the reader list
+     * is only pruned under it).
+     */
+    uint64_t oldest_active_period() const {
         // Get current grace period - we can never delete data from current or
         // previous period
         const uint64_t current_period = m_grace_period.load(std::memory_order_acquire);
@@ -442,17 +713,97 @@ private:
             }
             node = node->m_next.load(std::memory_order_acquire);
         }
+        return min_active_period;
+    }
 
-        // Delete all versions older than the threshold
-        auto it = m_retired_list.begin();
-        while (it != m_retired_list.end()) {
-            if (it->m_grace_period < min_active_period) {
-                delete it->m_ptr;  // Safe - all readers past this period
-                it = m_retired_list.erase(it);
-            } else {
-                ++it;  // Keep newer versions
+    void note_retired(size_t count) {
+        const size_t now = m_retired_versions.fetch_add(count, std::memory_order_relaxed) + count;
+        size_t peak = m_peak_retired_versions.load(std::memory_order_relaxed);
+        while (now > peak && !m_peak_retired_versions.compare_exchange_weak(
+                                 peak, now, std::memory_order_relaxed)) {}
+    }
+
+    void note_reclaimed(size_t count) {
+        if (count > 0) { m_retired_versions.fetch_sub(count, std::memory_order_relaxed); }
+    }
+
+    // ── EpochReclamation ────────────────────────────────────────────────
+
+    void start_reclaimer() {
+        if constexpr (k_epoch_reclamation) {
+            m_reclaimer = std::thread([this] { reclaimer_loop(); });
+        }
+    }
+
+    void stop_reclaimer() {
+        if constexpr (k_epoch_reclamation) {
+            {
+                const std::scoped_lock lock(m_retire_mutex);
+                m_stop_reclaimer = true;
+            }
+            m_reclaim_cv.notify_all();
+            if (m_reclaimer.joinable()) { m_reclaimer.join(); }
+        }
+    }
+
+    // Called by update() with m_writer_mutex held. Never waits for readers:
+    // the only lock taken is m_retire_mutex, which the reclaimer holds just
+    // long enough to splice the list.
+    void retire_to_reclaimer(RetiredData retired) {
+        bool wake = false;
+        {
+            const std::scoped_lock lock(m_retire_mutex);
+            wake = m_retired_list.empty();
+            m_retired_list.push_back(retired);
+            if (m_retired_list.size() >= m_cleanup_threshold) {
+                m_reclaim_requested = true;
+                wake = true;
             }
         }
+        note_retired(1);
+        if (wake) { m_reclaim_cv.notify_one(); }
+    }
+
+    void reclaimer_loop() {
+        std::unique_lock lock(m_retire_mutex);
+        while (true) {
+            m_reclaim_cv.wait(lock, [this] { return m_stop_reclaimer || !m_retired_list.empty(); });
+            if (m_stop_reclaimer) { return; }
+
+            // Give in-flight read sections one interval to move on, unless
+            // the backlog already reached cleanup_threshold.
+            m_reclaim_cv.wait_for(lock, Reclamation::k_reclaim_interval, [this] {
+                return m_stop_reclaimer || m_reclaim_requested;
+            });
+            if (m_stop_reclaimer) { return; }
+            m_reclaim_requested = false;
+
+            lock.unlock();
+            reclaim_expired();
+            lock.lock();
+        }
+    }
+
+    void reclaim_expired() {
+        uint64_t min_active_period = 0;
+        {
+            const std::scoped_lock lock(m_writer_mutex);
+            min_active_period = oldest_active_period();
+        }
+
+        std::vector<RetiredData> expired;
+        {
+            const std::scoped_lock lock(m_retire_mutex);
+            auto keep = std::partition(
+                m_retired_list.begin(), m_retired_list.end(), [&](const RetiredData& r) {
+                    return r.m_grace_period >= min_active_period;
+                });
+            expired.assign(keep, m_retired_list.end());
+            m_retired_list.erase(keep, m_retired_list.end());
+        }
+
+        for (auto& retired : expired) { delete retired.m_ptr; }
+        note_reclaimed(expired.size());
     }
 
     /**
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <tanh/core/Exports.h>
+#include <tanh/utils/RealtimeSanitizer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace thl {
+
+/**
+ * @brief Fixed-size fork/join pool for sharding audio-block work across cores
+ *
+ * Workers are created once in the constructor and never allocate afterwards.
+ * Between jobs they spin for a bounded number of iterations and then sleep on
+ * a futex (std::atomic::wait), so a pool driven once per audio block stays
+ * hot without burning a core while the audio device is idle.
+ *
+ * parallel_for() is a blocking fork/join: the calling thread publishes the
+ * job, executes indices itself alongside the workers, and returns once every
+ * index has completed. It never allocates, never takes a lock, and never
+ * sleeps — the caller only spins for workers that are mid-job. Exactly one
+ * thread (normally the audio thread) may call parallel_for() at a time.
+ */
+class TANH_API WorkerPool {
+public:
+    struct Options {
+        /// Worker threads in addition to the calling thread. 0 → every job
+        /// runs inline on the caller.
+        size_t m_num_workers = 0;
+        /// Spin iterations a worker polls for new work before it sleeps.
+        uint32_t m_spin_iterations = 1u << 14;
+        /// Pin worker i to CPU (i + 1) % hardware_concurrency, leaving CPU 0
+        /// for the calling thread. Best effort; Linux only.
+        bool m_pin_threads = true;
+    };
+
+    explicit WorkerPool(Options options);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Number of worker threads (excluding the caller).
+    [[nodiscard]] size_t num_workers() const { return m_workers.size(); }
+
+    /**
+     * @brief Run fn(i) for every i in [0, count) and wait for completion
+     *
+     * Indices are claimed dynamically, so the order in which they execute —
+     * and on which thread — is unspecified. fn must be safe to call
+     * concurrently for distinct indices.
+     */
+    template <typename Fn>
+    void parallel_for(size_t count, Fn& fn) TANH_NONBLOCKING_FUNCTION {
+        run(
+            count,
+            [](void* context, size_t index) { (*static_cast<Fn*>(context))(index); },
+            &fn);
+    }
+
+private:
+    using JobFunction = void (*)(void* context, size_t index);
+
+    void run(size_t count, JobFunction function, void* context) TANH_NONBLOCKING_FUNCTION;
+    void execute_jobs();
+    void worker_loop();
+
+    // Job description. Written by the caller only while no worker is inside
+    // a job (m_active == 0), published by the m_generation increment.
+    size_t m_count = 0;
+    JobFunction m_function = nullptr;
+    void* m_context = nullptr;
+
+    std::atomic<uint64_t> m_generation{0};
+    // Last generation the caller closed. Workers that wake after the close
+    // skip straight back to waiting without touching the job description.
+    std::atomic<uint64_t> m_closed_generation{0};
+    std::atomic<size_t> m_next_index{0};
+    std::atomic<size_t> m_active{0};
+    std::atomic<size_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+
+    uint32_t m_spin_iterations;
+    std::vector<std::thread> m_workers;
+};
+
+}  // namespace thl
@@ -2,8 +2,10 @@
 
 #include <tanh/core/Exports.h>
 #include <tanh/dsp/audio/AudioBufferView.h>
+#include <tanh/dsp/utils/ChangePointMask.h>
 #include <tanh/utils/RealtimeSanitizer.h>
 
+#include <concepts>
 #include <cstdint>
 #include <span>
 
@@ -27,12 +29,23 @@ public:
     void process_modulated(const thl::dsp::audio::AudioBufferView& buffer,
                            std::span<const uint32_t> change_points) TANH_NONBLOCKING_FUNCTION;
 
+    // Caller-injected packed bitset (e.g. from collect_change_point_mask):
+    // splits at every set bit without materialising an index list. A
+    // template only so that a bare {} keeps selecting the span overload.
+    template <std::same_as<utils::ChangePointMask> Mask>
+    void process_modulated(const thl::dsp::audio::AudioBufferView& buffer,
+                           const Mask& change_points) TANH_NONBLOCKING_FUNCTION {
+        split_and_process(buffer, change_points);
+    }
+
 protected:
     virtual std::span<const uint32_t> get_change_points() TANH_NONBLOCKING_FUNCTION { return {}; }
 
 private:
     void split_and_process(const thl::dsp::audio::AudioBufferView& buffer,
                            std::span<const uint32_t> change_points) TANH_NONBLOCKING_FUNCTION;
+    void split_and_process(const thl::dsp::audio::AudioBufferView& buffer,
+                           const utils::ChangePointMask& change_points) TANH_NONBLOCKING_FUNCTION;
 };
 
 }  // namespace thl::dsp
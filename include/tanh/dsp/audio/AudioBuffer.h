@@ -163,9 +163,9 @@ public:
                 m_channels = other.m_channels;
                 other.m_channels = temp;
             } else {
-                thl::Logger::error("thl.dsp.audio.audio_buffer",
-                                   "Buffer: cannot swap data, buffers have "
-                                   "different dimensions");
+                thl::Logger::rt_error("thl.dsp.audio.audio_buffer",
+                                      "Buffer: cannot swap data, buffers have "
+                                      "different dimensions");
             }
         }
     }
@@ -175,8 +175,8 @@ public:
             m_data.swap_data(other);
             reset_channel_ptr();
         } else {
-            thl::Logger::error("thl.dsp.audio.audio_buffer",
-                               "Buffer: cannot swap data, MemoryBlock has different size");
+            thl::Logger::rt_error("thl.dsp.audio.audio_buffer",
+                                  "Buffer: cannot swap data, MemoryBlock has different size");
         }
     }
 
@@ -185,8 +185,8 @@ public:
             m_data.swap_data(raw_data, size);
             reset_channel_ptr();
         } else {
-            thl::Logger::error("thl.dsp.audio.audio_buffer",
-                               "Buffer: cannot swap data, size mismatch");
+            thl::Logger::rt_error("thl.dsp.audio.audio_buffer",
+                                  "Buffer: cannot swap data, size mismatch");
         }
     }
 
@@ -1,40 +1,77 @@
 #pragma once
 
+#include <tanh/core/threading/DeferredReclaimer.h>
 #include <tanh/dsp/audio/AudioBuffer.h>
 
 #include <atomic>
 #include <cstdint>
-#include <thread>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace thl::dsp::audio {
 
 /**
- * RT-safe single-buffered audio data storage with CAS state machine.
+ * RT-safe audio data storage with pointer publication and deferred reclamation.
  *
- * Uses a three-state atomic (Idle, Reading, Loading) to coordinate
- * between the RT thread and a loader thread with minimal memory overhead.
+ * The loaded buffers live in a heap-allocated vector published through an
+ * atomic pointer. A load fills a fresh staging vector, swaps it in and hands
+ * the previous one to a DeferredReclaimer, so neither side ever waits for the
+ * other and the RT thread never sees a half-loaded buffer.
  *
- * RT thread:  CAS(Idle→READING) to read, store(Idle) when done.
- *             If CAS fails (loader active), output silence for that block.
- * Loader:     Spin CAS(Idle→Loading), move data in, store(Idle).
+ * Readers:    begin_read() returns a ReadSection holding the buffer published
+ *             when it began; the buffer stays alive until the section is
+ *             destroyed. Sections belong to the reading thread, so any number
+ *             of threads may read one store at once. The first begin_read()
+ *             on a thread claims a reader slot — call
+ *             DeferredReclaimer::register_reader_thread() during setup.
+ * Loader:     begin_load() returns the staging vector, commit_load() publishes
+ *             it. Loads must come from one thread at a time.
  */
 class AudioDataStore {
 public:
-    AudioDataStore() = default;
-
-    bool begin_read() {
-        // NOLINTNEXTLINE(misc-const-correctness) — mutated by compare_exchange_strong on failure.
-        int expected = Idle;
-        return m_state.compare_exchange_strong(expected,
-                                               Reading,
-                                               std::memory_order_acq_rel,
-                                               std::memory_order_relaxed);
-    }
+    AudioDataStore() : AudioDataStore(DeferredReclaimer::shared()) {}
+
+    explicit AudioDataStore(DeferredReclaimer& reclaimer)
+        : m_reclaimer(reclaimer), m_buffer(new std::vector<AudioBuffer>()) {}
+
+    // No read section may be open
+    ~AudioDataStore() { delete m_buffer.load(std::memory_order_relaxed); }
+
+    AudioDataStore(const AudioDataStore&) = delete;
+    AudioDataStore& operator=(const AudioDataStore&) = delete;
+
+    /**
+     * Move-only read section: keeps the buffer published when it began alive
+     * until it is destroyed. Keep it on the stack of the reading thread.
+     */
+    class [[nodiscard]] ReadSection {
+    public:
+        ReadSection(ReadSection&&) noexcept = default;
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) = delete;
+        ReadSection& operator=(ReadSection&&) = delete;
+
+        const std::vector<AudioBuffer>& buffer() const { return *m_buffer; }
 
-    void end_read() { m_state.store(Idle, std::memory_order_release); }
+    private:
+        friend class AudioDataStore;
 
-    const std::vector<AudioBuffer>& get_buffer() const { return m_buffer; }
+        // The scope opens before the pointer is loaded
+        ReadSection(const DeferredReclaimer& reclaimer,
+                    const std::atomic<std::vector<AudioBuffer>*>& buffer)
+            : m_scope(reclaimer), m_buffer(buffer.load(std::memory_order_acquire)) {}
+
+        DeferredReclaimer::ReadScope m_scope;
+        const std::vector<AudioBuffer>* m_buffer;
+    };
+
+    ReadSection begin_read() const { return ReadSection(m_reclaimer, m_buffer); }
+
+    // The latest published buffer. Loader thread only — readers use begin_read().
+    const std::vector<AudioBuffer>& get_buffer() const {
+        return *m_buffer.load(std::memory_order_acquire);
+    }
 
     bool is_loaded() const { return m_loaded.load(std::memory_order_acquire); }
 
@@ -45,37 +82,25 @@ public:
     }
 
     std::vector<AudioBuffer>& begin_load() {
-        // Spin until we can acquire Loading state
-        while (true) {
-            // NOLINTNEXTLINE(misc-const-correctness) — mutated by compare_exchange_weak on failure.
-            int expected = Idle;
-            if (m_state.compare_exchange_weak(expected,
-                                              Loading,
-                                              std::memory_order_acq_rel,
-                                              std::memory_order_relaxed)) {
-                break;
-            }
-            std::this_thread::yield();
-        }
-
-        m_buffer.clear();
-        m_buffer.shrink_to_fit();
-        return m_buffer;
+        m_staging = std::make_unique<std::vector<AudioBuffer>>();
+        return *m_staging;
     }
 
     void commit_load(int root_note) {
+        std::unique_ptr<std::vector<AudioBuffer>> previous(
+            m_buffer.exchange(m_staging.release(), std::memory_order_acq_rel));
+        m_reclaimer.retire(std::move(previous));
+
         m_root_note.store(root_note, std::memory_order_relaxed);
-        m_loaded.store(true, std::memory_order_relaxed);
         m_load_generation.fetch_add(1, std::memory_order_relaxed);
-
-        m_state.store(Idle, std::memory_order_release);
+        m_loaded.store(true, std::memory_order_release);
     }
 
 private:
-    enum State { Idle = 0, Reading = 1, Loading = 2 };
+    DeferredReclaimer& m_reclaimer;
+    std::atomic<std::vector<AudioBuffer>*> m_buffer;
+    std::unique_ptr<std::vector<AudioBuffer>> m_staging;  // Loader only
 
-    std::vector<AudioBuffer> m_buffer;
-    std::atomic<int> m_state{Idle};
     std::atomic<int> m_root_note{60};
     std::atomic<bool> m_loaded{false};
     std::atomic<uint32_t> m_load_generation{0};
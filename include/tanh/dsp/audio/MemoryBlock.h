@@ -117,8 +117,10 @@ public:
             if (m_size == other.m_size) {
                 std::swap(m_data, other.m_data);
             } else {
-                thl::Logger::error("thl.dsp.audio.memory_block",
-                                   "MemoryBlock: cannot swap data with different sizes");
+                thl::Logger::rt_error("thl.dsp.audio.memory_block",
+                                      "MemoryBlock: cannot swap data with different sizes (%zu, %zu)",
+                                      m_size,
+                                      other.m_size);
             }
         }
     }
@@ -127,8 +129,10 @@ public:
         if (m_size == size) {
             std::swap(m_data, data);
         } else {
-            thl::Logger::error("thl.dsp.audio.memory_block",
-                               "MemoryBlock: cannot swap data with different sizes");
+            thl::Logger::rt_error("thl.dsp.audio.memory_block",
+                                  "MemoryBlock: cannot swap data with different sizes (%zu, %zu)",
+                                  m_size,
+                                  size);
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <tanh/core/Exports.h>
+#include <tanh/core/ObjectPool.h>
 #include <tanh/dsp/BaseProcessor.h>
 #include <tanh/dsp/audio/AudioDataStore.h>
 #include <tanh/dsp/granular/GrainVisualizationListener.h>
@@ -24,7 +25,7 @@ constexpr float k_max_grain_size = 0.4f;   // 400 ms
 constexpr float k_min_grain_interval = 0.02f;  // 20 ms (50 grains/sec)
 constexpr float k_max_grain_interval = 0.2f;   // 200 ms (5 grains/sec)
 
-// Maximum number of grains that can be active simultaneously
+// Default maximum number of grains that can be active simultaneously
 constexpr size_t k_max_grains = 32;
 
 // Duration in seconds over which temperature ramps up from 0 to full at
@@ -48,7 +49,6 @@ struct Grain {
     float m_amplitude;          // Grain amplitude/volume
     float m_gain;
     float m_position_spread;                 // Pan position [0, 1] for MonoToStereo spread
-    bool m_active;                           // Whether the grain is currently active
     thl::dsp::utils::HannWindow m_envelope;  // Hann window envelope for amplitude
                                              // modulation
     size_t m_sample_index;                   // Index of the sample in the audio data
@@ -66,6 +66,10 @@ public:
 
     void reset_grains();
 
+    /// Grains that can play at once; takes effect on the next prepare().
+    void set_max_grains(size_t max_grains);
+    size_t get_max_grains() const { return m_max_grains; }
+
     bool is_active() const { return m_envelope.is_active(); }
 
     void set_visualization_listener(GrainVisualizationListener* listener);
@@ -132,8 +136,8 @@ private:
     double m_sample_rate = 48000.0;
     size_t m_channels = 2;
 
-    // Grain management
-    std::vector<Grain> m_grains;
+    // Grain management: live grains come from a pool sized by prepare()
+    thl::ObjectPool<Grain> m_grains;
     size_t m_max_grains{k_max_grains};
     size_t m_next_grain_time{0};
     size_t m_min_grain_interval{100};
@@ -159,9 +163,20 @@ private:
     size_t m_current_sample_index{0};
 
     // Grain generation and management
-    void trigger_grain(const size_t sample_index, uint32_t modulation_offset);
-    void update_grains(float** buffer, size_t n_buffer_frames, uint32_t modulation_offset);
-    void read_sample(float position, size_t sample_index, size_t source_channel, float& out_sample);
+    // audio_data is the buffer of the read section process() holds open
+    void trigger_grain(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                       const size_t sample_index,
+                       uint32_t modulation_offset);
+    void update_grains(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                       float** buffer,
+                       size_t n_buffer_frames,
+                       uint32_t modulation_offset);
+    void finish_grain(Grain& grain);
+    void read_sample(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                     float position,
+                     size_t sample_index,
+                     size_t source_channel,
+                     float& out_sample);
     size_t calculate_grain_size(float grain_size_param, float temperature);
     float calculate_velocity(float velocity, float temperature);
     long calculate_start_position(const SampleRegion& region, float temperature);
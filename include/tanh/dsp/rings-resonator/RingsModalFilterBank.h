@@ -0,0 +1,113 @@
+#pragma once
+
+#include <tanh/dsp/DspTypes.h>
+#include <tanh/dsp/filter/OnePole.h>
+#include <tanh/dsp/utils/SimdFloat.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace thl::dsp::resonator {
+
+// Structure-of-arrays bank of TPT band-pass SVFs for the modal resonator.
+//
+// Holds the same g/r/h coefficients and two integrator states as
+// thl::dsp::filter::Svf, but one array per field so that
+// utils::simd::FloatBatch::k_width modes are advanced per instruction.
+// The per-mode arithmetic is identical to Svf::process<BandPass>; only the
+// order in which the band-pass outputs are summed differs, so results match
+// the scalar filter array to within float rounding.
+//
+// Even-indexed modes are summed into `odd`, odd-indexed modes into `even`
+// (Rings numbers its partials from 1). Modes are processed in pairs exactly
+// like the original loop, so a bank asked for an odd count also advances the
+// next mode; modes past that are left untouched.
+template <size_t NumModes>
+class RingsModalFilterBank {
+public:
+    static_assert(NumModes % 2 == 0, "Modes are processed in odd/even pairs");
+
+    void reset() {
+        m_state_1.fill(0.0f);
+        m_state_2.fill(0.0f);
+    }
+
+    template <Approximation approximation>
+    void set_f_q(size_t index, float f, float resonance) {
+        const float g = thl::dsp::filter::OnePole::tan<approximation>(f);
+        const float r = 1.0f / resonance;
+        m_g[index] = g;
+        m_r[index] = r;
+        m_h[index] = 1.0f / (1.0f + r * g + g * g);
+    }
+
+    // Feeds `input` to the first num_modes filters (rounded up to even) and
+    // returns the amplitude-weighted band-pass sums. amplitudes[i] weights
+    // mode i and must cover the rounded-up mode count.
+    void process(float input, const float* amplitudes, size_t num_modes, float& odd, float& even) {
+        using Batch = thl::dsp::utils::simd::FloatBatch;
+        constexpr size_t k_width = Batch::k_width;
+
+        num_modes = (num_modes + 1) & ~static_cast<size_t>(1);
+        const size_t vector_end = num_modes - (num_modes % k_width);
+
+        const Batch in = Batch::broadcast(input);
+        Batch acc = Batch::broadcast(0.0f);
+        for (size_t i = 0; i < vector_end; i += k_width) {
+            const Batch g = Batch::load(&m_g[i]);
+            const Batch r = Batch::load(&m_r[i]);
+            const Batch h = Batch::load(&m_h[i]);
+            const Batch state_1 = Batch::load(&m_state_1[i]);
+            const Batch state_2 = Batch::load(&m_state_2[i]);
+
+            const Batch hp = (in - r * state_1 - g * state_1 - state_2) * h;
+            const Batch bp = g * hp + state_1;
+            (g * hp + bp).store(&m_state_1[i]);
+            const Batch lp = g * bp + state_2;
+            (g * bp + lp).store(&m_state_2[i]);
+
+            acc = acc + bp * Batch::load(&amplitudes[i]);
+        }
+
+        alignas(64) std::array<float, k_width> lanes{};
+        acc.store(lanes.data());
+        odd = 0.0f;
+        even = 0.0f;
+        for (size_t lane = 0; lane < k_width; lane += 2) {
+            odd += lanes[lane];
+            even += lanes[lane + 1];
+        }
+
+        // Remaining pairs when num_modes is not a multiple of the lane count.
+        for (size_t i = vector_end; i < num_modes; i += 2) {
+            odd += amplitudes[i] * process_mode(i, input);
+            even += amplitudes[i + 1] * process_mode(i + 1, input);
+        }
+    }
+
+    float g(size_t index) const { return m_g[index]; }
+    float r(size_t index) const { return m_r[index]; }
+    float h(size_t index) const { return m_h[index]; }
+
+private:
+    float process_mode(size_t i, float in) {
+        const float g = m_g[i];
+        const float state_1 = m_state_1[i];
+        const float state_2 = m_state_2[i];
+        const float hp = (in - m_r[i] * state_1 - g * state_1 - state_2) * m_h[i];
+        const float bp = g * hp + state_1;
+        m_state_1[i] = g * hp + bp;
+        const float lp = g * bp + state_2;
+        m_state_2[i] = g * bp + lp;
+        return bp;
+    }
+
+    alignas(64) std::array<float, NumModes> m_g{};
+    alignas(64) std::array<float, NumModes> m_r{};
+    alignas(64) std::array<float, NumModes> m_h{};
+    alignas(64) std::array<float, NumModes> m_state_1{};
+    alignas(64) std::array<float, NumModes> m_state_2{};
+};
+
+}  // namespace thl::dsp::resonator
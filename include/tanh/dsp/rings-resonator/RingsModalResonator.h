@@ -30,8 +30,8 @@
 
 #include <tanh/core/Exports.h>
 #include <tanh/dsp/audio/AudioBufferView.h>
-#include <tanh/dsp/filter/Svf.h>
 #include <tanh/dsp/rings-resonator/RingsDsp.h>
+#include <tanh/dsp/rings-resonator/RingsModalFilterBank.h>
 #include <tanh/dsp/utils/DelayLine.h>
 
 #include <algorithm>
@@ -96,7 +96,8 @@ private:
     int32_t m_num_modes = 0;
     bool m_dirty = true;
 
-    std::array<thl::dsp::filter::Svf, k_max_modes> m_f;
+    RingsModalFilterBank<k_max_modes> m_f;
+    alignas(64) std::array<float, k_max_modes> m_amplitudes{};
 };
 
 }  // namespace thl::dsp::resonator
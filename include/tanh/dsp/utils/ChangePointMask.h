@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace thl::dsp::utils {
+
+// Packed per-sample change-point flags: sample i is bit (i % 64) of word
+// i / 64. A block of N samples needs change_point_words(N) words; bits at or
+// past N are always zero.
+//
+// Compared to one byte per sample this makes the per-block clear and the
+// "which samples changed" scan O(N / 64), and merging the change points of
+// several targets a plain word-wise OR.
+
+inline constexpr size_t k_change_point_word_bits = 64;
+
+constexpr size_t change_point_words(size_t num_samples) {
+    return (num_samples + k_change_point_word_bits - 1) / k_change_point_word_bits;
+}
+
+inline void set_change_point(uint64_t* words, size_t sample) {
+    words[sample / k_change_point_word_bits] |= uint64_t{1} << (sample % k_change_point_word_bits);
+}
+
+[[nodiscard]] inline bool test_change_point(const uint64_t* words, size_t sample) {
+    return ((words[sample / k_change_point_word_bits] >> (sample % k_change_point_word_bits)) &
+            1u) != 0;
+}
+
+// Sets every stride-th sample in [first, num_samples).
+inline void set_change_points_strided(uint64_t* words,
+                                      size_t first,
+                                      size_t stride,
+                                      size_t num_samples) {
+    if (stride == 1) {
+        // Dense run: whole words at a time.
+        for (size_t i = first; i < num_samples;) {
+            const size_t bit = i % k_change_point_word_bits;
+            const size_t run = std::min(k_change_point_word_bits - bit, num_samples - i);
+            const uint64_t bits = run == k_change_point_word_bits ? ~uint64_t{0}
+                                                                  : ((uint64_t{1} << run) - 1);
+            words[i / k_change_point_word_bits] |= bits << bit;
+            i += run;
+        }
+        return;
+    }
+    for (size_t i = first; i < num_samples; i += stride) { set_change_point(words, i); }
+}
+
+// Read-only view of a packed change-point bitset covering m_num_samples
+// samples. An empty mask (no words) means "no change points".
+struct ChangePointMask {
+    std::span<const uint64_t> m_words;
+    size_t m_num_samples = 0;
+
+    [[nodiscard]] bool empty() const { return m_words.empty(); }
+
+    [[nodiscard]] bool test(size_t sample) const {
+        return sample < m_num_samples && test_change_point(m_words.data(), sample);
+    }
+
+    [[nodiscard]] size_t count() const {
+        size_t total = 0;
+        for (const uint64_t w : m_words) { total += static_cast<size_t>(std::popcount(w)); }
+        return total;
+    }
+
+    // Calls fn(sample) for every set sample in ascending order.
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (size_t w = 0; w < m_words.size(); ++w) {
+            for (uint64_t bits = m_words[w]; bits != 0; bits &= bits - 1) {
+                fn(static_cast<uint32_t>(w * k_change_point_word_bits +
+                                         static_cast<size_t>(std::countr_zero(bits))));
+            }
+        }
+    }
+};
+
+}  // namespace thl::dsp::utils
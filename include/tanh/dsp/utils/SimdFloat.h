@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstddef>
+
+#if !defined(THL_DSP_NO_SIMD) && defined(__AVX512F__)
+#define THL_SIMD_AVX512 1
+#include <immintrin.h>
+#elif !defined(THL_DSP_NO_SIMD) && defined(__AVX__)
+#define THL_SIMD_AVX 1
+#include <immintrin.h>
+#elif !defined(THL_DSP_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define THL_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !defined(THL_DSP_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define THL_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace thl::dsp::utils::simd {
+
+// Thin wrapper around the widest float vector register enabled at build time.
+//
+// The instruction set is picked from the compiler's target macros, so the
+// lane count follows the -m/-march flags the library is built with:
+//   AVX-512F → 16 lanes, AVX → 8 lanes, SSE2 / NEON → 4 lanes.
+// Defining THL_DSP_NO_SIMD (CMake: TANH_WITH_SIMD=OFF) selects a portable
+// 4-lane scalar fallback with identical semantics, which is also what every
+// other target gets.
+//
+// Only the handful of element-wise operations the DSP kernels need are
+// exposed. Loads and stores are unaligned; callers that keep their data
+// 64-byte aligned get the aligned fast path from the hardware for free.
+struct FloatBatch {
+#if defined(THL_SIMD_AVX512)
+    static constexpr size_t k_width = 16;
+    using Native = __m512;
+#elif defined(THL_SIMD_AVX)
+    static constexpr size_t k_width = 8;
+    using Native = __m256;
+#elif defined(THL_SIMD_SSE2)
+    static constexpr size_t k_width = 4;
+    using Native = __m128;
+#elif defined(THL_SIMD_NEON)
+    static constexpr size_t k_width = 4;
+    using Native = float32x4_t;
+#else
+    static constexpr size_t k_width = 4;
+    struct Native {
+        float m_lanes[k_width];
+    };
+#endif
+
+    Native m_value;
+
+    static FloatBatch load(const float* ptr) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_loadu_ps(ptr)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_loadu_ps(ptr)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_loadu_ps(ptr)};
+#elif defined(THL_SIMD_NEON)
+        return {vld1q_f32(ptr)};
+#else
+        FloatBatch b{};
+        for (size_t i = 0; i < k_width; ++i) { b.m_value.m_lanes[i] = ptr[i]; }
+        return b;
+#endif
+    }
+
+    static FloatBatch broadcast(float value) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_set1_ps(value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_set1_ps(value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_set1_ps(value)};
+#elif defined(THL_SIMD_NEON)
+        return {vdupq_n_f32(value)};
+#else
+        FloatBatch b{};
+        for (size_t i = 0; i < k_width; ++i) { b.m_value.m_lanes[i] = value; }
+        return b;
+#endif
+    }
+
+    void store(float* ptr) const {
+#if defined(THL_SIMD_AVX512)
+        _mm512_storeu_ps(ptr, m_value);
+#elif defined(THL_SIMD_AVX)
+        _mm256_storeu_ps(ptr, m_value);
+#elif defined(THL_SIMD_SSE2)
+        _mm_storeu_ps(ptr, m_value);
+#elif defined(THL_SIMD_NEON)
+        vst1q_f32(ptr, m_value);
+#else
+        for (size_t i = 0; i < k_width; ++i) { ptr[i] = m_value.m_lanes[i]; }
+#endif
+    }
+
+    friend FloatBatch operator+(FloatBatch a, FloatBatch b) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_add_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_add_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_add_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_NEON)
+        return {vaddq_f32(a.m_value, b.m_value)};
+#else
+        for (size_t i = 0; i < k_width; ++i) { a.m_value.m_lanes[i] += b.m_value.m_lanes[i]; }
+        return a;
+#endif
+    }
+
+    friend FloatBatch operator-(FloatBatch a, FloatBatch b) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_sub_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_sub_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_sub_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_NEON)
+        return {vsubq_f32(a.m_value, b.m_value)};
+#else
+        for (size_t i = 0; i < k_width; ++i) { a.m_value.m_lanes[i] -= b.m_value.m_lanes[i]; }
+        return a;
+#endif
+    }
+
+    friend FloatBatch operator*(FloatBatch a, FloatBatch b) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_mul_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_mul_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_mul_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_NEON)
+        return {vmulq_f32(a.m_value, b.m_value)};
+#else
+        for (size_t i = 0; i < k_width; ++i) { a.m_value.m_lanes[i] *= b.m_value.m_lanes[i]; }
+        return a;
+#endif
+    }
+
+    static FloatBatch min(FloatBatch a, FloatBatch b) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_min_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_min_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_min_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_NEON)
+        return {vminq_f32(a.m_value, b.m_value)};
+#else
+        for (size_t i = 0; i < k_width; ++i) {
+            a.m_value.m_lanes[i] =
+                b.m_value.m_lanes[i] < a.m_value.m_lanes[i] ? b.m_value.m_lanes[i]
+                                                            : a.m_value.m_lanes[i];
+        }
+        return a;
+#endif
+    }
+
+    static FloatBatch max(FloatBatch a, FloatBatch b) {
+#if defined(THL_SIMD_AVX512)
+        return {_mm512_max_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_AVX)
+        return {_mm256_max_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_SSE2)
+        return {_mm_max_ps(a.m_value, b.m_value)};
+#elif defined(THL_SIMD_NEON)
+        return {vmaxq_f32(a.m_value, b.m_value)};
+#else
+        for (size_t i = 0; i < k_width; ++i) {
+            a.m_value.m_lanes[i] =
+                a.m_value.m_lanes[i] < b.m_value.m_lanes[i] ? b.m_value.m_lanes[i]
+                                                            : a.m_value.m_lanes[i];
+        }
+        return a;
+#endif
+    }
+};
+
+// Name of the instruction set FloatBatch was compiled for (benchmark labels).
+constexpr const char* instruction_set() {
+#if defined(THL_SIMD_AVX512)
+    return "avx512";
+#elif defined(THL_SIMD_AVX)
+    return "avx";
+#elif defined(THL_SIMD_SSE2)
+    return "sse2";
+#elif defined(THL_SIMD_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace thl::dsp::utils::simd
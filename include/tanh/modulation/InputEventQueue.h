@@ -2,27 +2,57 @@
 
 #include <readerwriterqueue.h>
 #include <tanh/core/Exports.h>
+#include <tanh/core/ScratchArena.h>
 #include <tanh/state/ModulationScope.h>
 
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
 namespace thl::modulation {
 
+// When an InputEventQueue event happened. Base::None (default) → untimed,
+// spread. Base::Sample → absolute sample position on the matrix clock
+// (ModulationMatrix::get_num_processed_samples()). Base::Host → seconds on
+// the producer's clock; drain_timed() maps it through
+// InputEventQueue::BlockTiming.
+struct InputEventTimestamp {
+    enum class Base : uint8_t { None, Sample, Host };
+
+    uint64_t m_sample = 0;
+    double m_host_seconds = 0.0;
+    Base m_base = Base::None;
+
+    static InputEventTimestamp at_sample(uint64_t sample) {
+        return {.m_sample = sample, .m_host_seconds = 0.0, .m_base = Base::Sample};
+    }
+    static InputEventTimestamp at_host_time(double seconds) {
+        return {.m_sample = 0, .m_host_seconds = seconds, .m_base = Base::Host};
+    }
+};
+
 // Pure-transport helper for input-driven modulation sources (XY pad, touch
 // LFO, MIDI-CC, haptic). Bridges a UI-thread producer to an audio-thread
 // consumer via a lock-free SPSC ring buffer, then spreads drained events
 // within the current audio block at offsets i * block_size / n_bucket per
 // stream.
 //
-// Events carry no timestamp. Within each stream (mono + each voice), the
-// i-th of n_bucket events is placed at a monotonically increasing offset —
-// FIFO ordering is preserved per stream, cross-stream ordering is discarded.
-// Per-bucket (not global) spreading ensures polyphonic simultaneity: 10
-// concurrent touch events on 10 voices all land at offset 0, not strummed.
+// Untimed events (the default) are spread: within each stream (mono + each
+// voice), the i-th of n_bucket events is placed at a monotonically increasing
+// offset — FIFO ordering is preserved per stream, cross-stream ordering is
+// discarded. Per-bucket (not global) spreading ensures polyphonic
+// simultaneity: 10 concurrent touch events on 10 voices all land at offset 0,
+// not strummed.
+//
+// Producers that know when an event happened (MIDI, OSC, host automation)
+// can stamp it with an absolute sample position or a host-clock time. Drained
+// with drain_timed(), such events land at their exact offset within the block
+// they belong to. Events that are still in the future stay queued for a later
+// block, and late events follow a LatePolicy. Use one drain flavour per queue:
+// drain_spread() ignores timestamps.
 //
 // Not a base class — compose this as a member of a ModulationSource and
 // call drain_spread() from pre_process_block(). Stream topology mirrors
@@ -36,15 +66,45 @@ class TANH_API InputEventQueue {
 public:
     enum class EventType : uint8_t { Value, Active };
 
+    // Defined at namespace scope so that it can default the push_*
+    // arguments below.
+    using Timestamp = InputEventTimestamp;
+
     struct Event {
         EventType m_type;
         bool m_is_mono;   // true → mono stream; false → per-voice stream
         uint8_t m_voice;  // unused when m_is_mono = true
         bool m_active;    // used when m_type == Active
         float m_value;    // used when m_type == Value
+        Timestamp m_time{};
+    };
+
+    // What drain_timed() does with an event stamped before the block start.
+    enum class LatePolicy : uint8_t {
+        Clamp,  // land at offset 0
+        Drop,   // discard; counted in num_dropped_late()
+        Defer,  // delay every timed event by BlockTiming::m_defer_latency so
+                // that relative timing survives arrival jitter; events still
+                // late after that land at offset 0
     };
 
-    explicit InputEventQueue(thl::modulation::ModulationScope scope, size_t queue_capacity = 64);
+    // The current block's position on both clocks. m_block_start_sample is
+    // ModulationMatrix::get_num_processed_samples() read in
+    // pre_process_block() (the counter advances after the block). The host
+    // fields are only consulted for Base::Host events.
+    struct BlockTiming {
+        uint64_t m_block_start_sample = 0;
+        double m_block_start_host_seconds = 0.0;
+        double m_sample_rate = 0.0;
+        LatePolicy m_late_policy = LatePolicy::Clamp;
+        uint32_t m_defer_latency = 0;
+    };
+
+    // pending_capacity bounds how many future events drain_timed() carries
+    // across blocks, independently of the SPSC queue's size.
+    explicit InputEventQueue(thl::modulation::ModulationScope scope,
+                             size_t queue_capacity = 64,
+                             size_t pending_capacity = 64);
 
     // Author the voice-count and reserve all audio-thread scratch buffers.
     // Call from the composing ModulationSource's prepare() before any
@@ -55,10 +115,11 @@ public:
     // ── UI thread (single producer) — non-blocking, allocation-free ────
     // Returns false if the SPSC queue is full (audio-thread stall — always
     // an error). Mono/voice push methods assert on misuse.
-    bool push_mono_value(float value);
-    bool push_mono_active(bool active);
-    bool push_voice_value(uint32_t voice, float value);
-    bool push_voice_active(uint32_t voice, bool active);
+    // `time` is optional; see Timestamp.
+    bool push_mono_value(float value, Timestamp time = {});
+    bool push_mono_active(bool active, Timestamp time = {});
+    bool push_voice_value(uint32_t voice, float value, Timestamp time = {});
+    bool push_voice_active(uint32_t voice, bool active, Timestamp time = {});
 
     // ── Audio thread — drain the queue ─────────────────────────────────
     // Call exactly once per block from pre_process_block(). Snapshots the
@@ -68,10 +129,31 @@ public:
     using OnEvent = std::function<void(const Event& e, uint32_t offset)>;
     size_t drain_spread(uint32_t block_size, const OnEvent& cb);
 
+    // Sample-accurate alternative to drain_spread(). Call exactly once per
+    // block from pre_process_block(). Timed events due in
+    // [block start, block start + block_size) are dispatched at their exact
+    // offset; later ones are retained for a future block. The SPSC queue is
+    // emptied every block, so a due event is never stuck behind future ones;
+    // if more than pending_capacity events are due later, the latest-due are
+    // discarded and counted in num_dropped_overflow(). Untimed events are
+    // spread per stream as in drain_spread(). Per stream, callbacks arrive in
+    // non-decreasing offset order, FIFO on ties. Returns events dispatched.
+    size_t drain_timed(uint32_t block_size, const BlockTiming& timing, const OnEvent& cb);
+
+    // Timed events held back for a later block. Audio thread only.
+    [[nodiscard]] size_t num_pending() const { return m_pending.size(); }
+    // Late events discarded under LatePolicy::Drop since prepare(). Audio
+    // thread only.
+    [[nodiscard]] uint64_t num_dropped_late() const { return m_num_dropped_late; }
+    // Future events discarded because pending_capacity was full, since
+    // prepare(). Audio thread only.
+    [[nodiscard]] uint64_t num_dropped_overflow() const { return m_num_dropped_overflow; }
+
     [[nodiscard]] thl::modulation::ModulationScope scope() const { return m_scope; }
     [[nodiscard]] bool has_mono() const { return m_scope == k_global_scope; }
     [[nodiscard]] uint32_t num_voices() const { return m_num_voices; }
     [[nodiscard]] size_t queue_capacity() const { return m_queue_capacity; }
+    [[nodiscard]] size_t pending_capacity() const { return m_pending_capacity; }
 
 private:
     // Layout ordered for minimal padding: largest alignment first, smallest
@@ -79,13 +161,37 @@ private:
     // Cross-thread transport — lock-free SPSC.
     moodycamel::ReaderWriterQueue<Event> m_event_queue;
 
-    // Audio-thread-only scratch (no sync needed). Exactly one of
-    // m_mono_indices / m_voice_indices carries traffic, selected by scope.
-    std::vector<Event> m_drain_buffer;
-    std::vector<size_t> m_mono_indices;                // only if scope is global
-    std::vector<std::vector<size_t>> m_voice_indices;  // only if scope is non-global
+    // Per-drain bucketing of event indices by stream: the mono stream for a
+    // global queue, one stream per voice otherwise. Each stream owns a
+    // stride-sized slice of m_indices: room for every event of the drain.
+    struct Buckets {
+        std::span<size_t> m_indices;
+        std::span<uint32_t> m_counts;
+        size_t m_stride = 0;
+
+        std::span<size_t> bucket(size_t stream) const {
+            return m_indices.subspan(stream * m_stride, m_counts[stream]);
+        }
+    };
+
+    [[nodiscard]] size_t num_streams() const { return has_mono() ? 1 : m_num_voices; }
+    // Carve this drain's buckets out of m_scratch; events addressed to a
+    // stream this queue does not have are left out.
+    Buckets make_buckets(size_t stride);
+    void add_to_bucket(Buckets& buckets, const Event& e, size_t index) const;
+
+    // Audio-thread-only scratch (no sync needed), rewound at every drain:
+    // the drained events, the bucket index lists and drain_timed()'s offsets.
+    // drain_timed() works on up to pending_capacity + queue_capacity events.
+    thl::ScratchArena m_scratch;
+
+    // drain_timed() only: events carried across blocks.
+    std::vector<Event> m_pending;
+    uint64_t m_num_dropped_late = 0;
+    uint64_t m_num_dropped_overflow = 0;
 
     const size_t m_queue_capacity;
+    const size_t m_pending_capacity;
     uint32_t m_num_voices = 0;  // authored by prepare(); always 0 for global scope
     const thl::modulation::ModulationScope m_scope;
 };
@@ -27,6 +27,11 @@ public:
     void prepare(double sample_rate, size_t samples_per_block, uint32_t voice_count) override;
     void process(size_t num_samples, size_t offset = 0) override;
 
+    // process() touches only this LFO's own phase, slew and PRNG state, so
+    // several LFOs may render on worker threads at once. Subclasses must
+    // keep get_parameter_float() / get_parameter_int() read-only.
+    [[nodiscard]] bool supports_concurrent_render() const override { return true; }
+
     // Reset the fade-in envelope to zero. Call when the LFO becomes active so
     // its output ramps in over `FadeIn` seconds.
     void reset_fade_in();
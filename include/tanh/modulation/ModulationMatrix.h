@@ -1,6 +1,7 @@
 #pragma once
 
 #include <tanh/core/Exports.h>
+#include <tanh/core/threading/DeferredReclaimer.h>
 #include <tanh/core/threading/RCU.h>
 #include <tanh/modulation/ModulationRouting.h>
 #include <tanh/modulation/ModulationSource.h>
@@ -15,12 +16,15 @@
 #include <mutex>
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
 namespace thl {
 class State;
+class WorkerPool;
 }
 
 namespace thl::modulation {
@@ -36,6 +40,16 @@ struct CyclicStep {
 
 using ScheduleStep = std::variant<BulkStep, CyclicStep>;
 
+// A run of consecutive BulkSteps, [m_first_step, m_first_step + m_num_steps)
+// in the schedule, whose sources all support concurrent rendering and do not
+// modulate one another. With a WorkerPool attached, every source × voice of
+// a wave renders in parallel; routings are then applied serially in schedule
+// order, so the result is identical to the serial path.
+struct RenderWave {
+    size_t m_first_step;
+    size_t m_num_steps;
+};
+
 // All state read by the RT thread — bundled into a single RCU instance for
 // atomic publication. Pointers in routings_by_source reference elements in
 // the routings vector of the same ProcessingConfig instance; they stay valid
@@ -51,11 +65,19 @@ struct ProcessingConfig {
     // source per block, before any ScheduleStep. Contains every source added
     // via add_source(), including sources with no routings.
     std::vector<ModulationSource*> m_all_sources;
+
+    // Parallel rendering — only consulted when m_worker_pool is non-null.
+    // Sorted by m_first_step; steps outside every wave run serially.
+    std::vector<RenderWave> m_render_waves;
+    thl::WorkerPool* m_worker_pool = nullptr;
 };
 
 class TANH_API ModulationMatrix {
 public:
     explicit ModulationMatrix(thl::State& state);
+    // Retired VoiceBuffers / MonoBuffers go to @p reclaimer instead of the
+    // process-wide DeferredReclaimer::shared().
+    ModulationMatrix(thl::State& state, thl::DeferredReclaimer& reclaimer);
     ~ModulationMatrix();
 
     ModulationMatrix(const ModulationMatrix&) = delete;
@@ -69,9 +91,10 @@ public:
 
     // Allocate internal buffers sized to samples_per_block and rebuild the
     // schedule. Every target's VoiceBuffers / MonoBuffers is freshly allocated
-    // and atomically published — old buffers are retired past a synchronize()
-    // barrier so in-flight audio blocks always see either the old or the new
-    // buffer in full, never a torn mid-resize state.
+    // and atomically published — old buffers are handed to the
+    // DeferredReclaimer, which frees them only after every ReadScope that
+    // could have loaded them has closed, so in-flight audio blocks always see
+    // either the old or the new buffer in full, never a torn mid-resize state.
     //
     // Threading contract:
     // - Same-size prepare (same samples_per_block) is safe to call concurrently
@@ -88,13 +111,30 @@ public:
     void prepare(double sample_rate, size_t samples_per_block);
 
     using ConfigRCU = thl::RCU<ProcessingConfig>;
-    using ReadScope = typename ConfigRCU::ReadScope;
+
+    // Read section over both the published ProcessingConfig and the target
+    // buffers retired to the DeferredReclaimer. The reclaimer section is
+    // entered first, so it covers every buffer pointer the config leads to.
+    class [[nodiscard]] ReadScope {
+    public:
+        ReadScope(const thl::DeferredReclaimer& reclaimer, const ConfigRCU& config)
+            TANH_NONBLOCKING_FUNCTION : m_buffers(reclaimer), m_config(config.read_scope()) {}
+
+        const ProcessingConfig& data() const TANH_NONBLOCKING_FUNCTION { return m_config.data(); }
+        const ProcessingConfig* operator->() const TANH_NONBLOCKING_FUNCTION {
+            return &m_config.data();
+        }
+
+    private:
+        thl::DeferredReclaimer::ReadScope m_buffers;
+        ConfigRCU::ReadScope m_config;
+    };
 
     // Open an RCU read section covering the full audio block. Callers that
     // need to reach into ResolvedTarget buffers outside of ModulationMatrix
     // (e.g. DSP processors reading SmartHandle state) must hold a ReadScope
-    // for the duration of those reads — the scope prevents the writer from
-    // reclaiming retired VoiceBuffers / MonoBuffers while the audio thread
+    // for the duration of those reads — the scope prevents the reclaimer from
+    // destroying retired VoiceBuffers / MonoBuffers while the audio thread
     // still references them.
     //
     // Usage on the audio thread:
@@ -103,7 +143,17 @@ public:
     //   processor_manager.process(buffer);  // SmartHandle reads safe here
     //   // scope dtor releases the read section
     [[nodiscard]] ReadScope read_scope() const TANH_NONBLOCKING_FUNCTION {
-        return m_config.read_scope();
+        return ReadScope(m_reclaimer, m_config);
+    }
+
+    // Claim the calling thread's reader slots ahead of its first read_scope().
+    // Hosts call this on the audio thread before its first block (e.g. from
+    // the driver's start callback); otherwise that first read_scope() claims
+    // them under a lock. The constructor only registers the constructing
+    // thread. NOT real-time safe.
+    void register_reader_thread() const {
+        m_config.register_reader_thread();
+        thl::DeferredReclaimer::register_reader_thread();
     }
 
     // Process all sources and fill modulation buffers for all targets.
@@ -163,6 +213,47 @@ public:
     // k_global_scope or not registered.
     void set_voice_count(ModulationScope scope, uint32_t voice_count);
 
+    // Attach a worker pool (not owned) to shard source rendering across
+    // cores, or nullptr (the default) for the serial path. Only sources that
+    // opt in via ModulationSource::supports_concurrent_render() are rendered
+    // off the audio thread. Blocks until no audio block still uses the
+    // previous pool, so a pool may be destroyed once set_worker_pool(nullptr)
+    // returns.
+    void set_worker_pool(thl::WorkerPool* pool);
+
+    // ── Batched edits ───────────────────────────────────────────────────
+    // RAII write transaction for loading a patch. While a batch is open,
+    // add_source, add_routing, remove_routing, set_voice_count,
+    // register_scope and from_json apply their edits but defer the schedule
+    // rebuild; commit() (or destruction) runs one Tarjan rebuild and one RCU
+    // publication for all of them. Batches nest — only the outermost commit
+    // rebuilds. Calls that must return with the new config live (prepare,
+    // set_worker_pool, remove_source) still rebuild immediately, which also
+    // publishes everything batched so far.
+    //
+    //   auto tx = matrix.begin_batch();
+    //   for (const auto& r : patch_routings) { matrix.add_routing(r); }
+    //   tx.commit();
+    class [[nodiscard]] Batch {
+    public:
+        Batch(Batch&& other) noexcept : m_matrix(std::exchange(other.m_matrix, nullptr)) {}
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+        Batch& operator=(Batch&&) = delete;
+        ~Batch() { commit(); }
+
+        void commit() {
+            if (m_matrix != nullptr) { std::exchange(m_matrix, nullptr)->end_batch(); }
+        }
+
+    private:
+        friend class ModulationMatrix;
+        explicit Batch(ModulationMatrix* matrix) : m_matrix(matrix) {}
+        ModulationMatrix* m_matrix;
+    };
+
+    Batch begin_batch();
+
     // Source management
     void add_source(const std::string_view id, ModulationSource* source);
 
@@ -242,10 +333,31 @@ public:
     // State::from_json() if present.
     void from_json(const nlohmann::json& json);
 
+    // Binary counterparts of to_json()/from_json() — see BinarySnapshot.h
+    // for the layout. include_state=true embeds a State::to_binary() blob
+    // after the routings.
+    std::vector<std::byte> to_binary(bool include_state = true);
+
+    // Replaces all user routings with the snapshot's, rebuilds the schedule,
+    // and applies the embedded State blob if present. Throws
+    // SnapshotFormatException on malformed input, leaving routings untouched.
+    void from_binary(std::span<const std::byte> data);
+
 private:
     // Internal rebuild — must be called with m_writer_mutex held.
     void rebuild_schedule_with_lock();
 
+    // Rebuild now, or mark one pending while a Batch is open. Must be called
+    // with m_writer_mutex held.
+    void request_rebuild_with_lock();
+
+    // Assign IDs to loaded routings that lack one and advance
+    // m_next_routing_id past the highest. Must be called with m_writer_mutex held.
+    void finalize_routing_ids_with_lock();
+
+    // Closes one Batch level; the outermost runs the pending rebuild.
+    void end_batch();
+
     // Ensure a target exists for the given id. Returns a stable pointer.
     // Must be called with m_writer_mutex held.
     ResolvedTarget* ensure_target_with_lock(const std::string_view id);
@@ -270,6 +382,13 @@ private:
     void process_source_bulk_with_scope(const ProcessingConfig& config,
                                         ModulationSource* source,
                                         size_t num_samples);
+    static void render_source(ModulationSource* source, size_t num_samples);
+    void apply_source_routings_with_scope(ModulationSource* source,
+                                          const std::vector<const ResolvedRouting*>& routings,
+                                          size_t num_samples);
+    void process_render_wave_with_scope(const ProcessingConfig& config,
+                                        const RenderWave& wave,
+                                        size_t num_samples);
     void process_cyclic_with_scope(const ProcessingConfig& config,
                                    const std::vector<ModulationSource*>& sources,
                                    size_t num_samples);
@@ -295,6 +414,10 @@ private:
     // "samples since prepare" value is not invalidated by routing changes.
     uint64_t m_num_processed_samples = 0;
 
+    // Optional parallel renderer (not owned) — protected by m_writer_mutex,
+    // published to the RT thread through ProcessingConfig::m_worker_pool.
+    thl::WorkerPool* m_worker_pool = nullptr;
+
     // Writer mutex — serializes all non-RT methods
     std::mutex m_writer_mutex;
 
@@ -312,9 +435,17 @@ private:
     // Starts at 1; 0 is k_invalid_routing_id.
     uint32_t m_next_routing_id = 1;
 
+    // Open Batch levels and whether an edit inside them still needs a
+    // rebuild — protected by m_writer_mutex.
+    uint32_t m_batch_depth = 0;
+    bool m_rebuild_pending = false;
+
     // RT-safe processing config — RCU-protected for lock-free RT reads
     thl::RCU<ProcessingConfig> m_config;
 
+    // Destroys retired target buffers once no ReadScope can reference them
+    thl::DeferredReclaimer& m_reclaimer;
+
     // Scope registry. Entries in m_scope_names own the name strings; the
     // c_str() pointers from these std::string nodes are stored on
     // ModulationScope handles and in m_scopes below. std::list guarantees
@@ -3,10 +3,13 @@
 #include <tanh/core/Exports.h>
 #include <tanh/state/ModulationScope.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -81,6 +84,14 @@ public:
                                size_t /*num_samples*/,
                                size_t /*offset*/ = 0) {}
 
+    // Opt-in for multi-threaded rendering. Return true only if process() /
+    // process_voice() touch nothing but this source's own state and read-only
+    // modulation targets, and process_voice() calls for distinct voices are
+    // independent. With a WorkerPool attached (ModulationMatrix::
+    // set_worker_pool), the matrix may then render this source on a worker
+    // thread, concurrently with other such sources and with its own voices.
+    [[nodiscard]] virtual bool supports_concurrent_render() const { return false; }
+
     // Parameter keys this source exposes for modulation-on-modulation.
     // Used by the matrix to build the dependency graph for Tarjan SCC.
     virtual std::vector<std::string> parameter_keys() const { return {}; }
@@ -119,6 +130,64 @@ public:
         for (auto& cp : m_voice_change_points) { cp.clear(); }
     }
 
+    // ── Piecewise-constant output ───────────────────────────────────────
+    // A source may describe the block it just rendered as up to
+    // k_max_output_segments constant segments, declared in ascending order
+    // from process() / process_voice() (declare_output_segment /
+    // declare_voice_output_segment, or declare_constant_output for a single
+    // value across the block). Segment k covers [m_start, next m_start); the
+    // last one runs to the end of the block. A segment at sample 0 starts a
+    // new description; one that does not start at 0, or that declares more
+    // segments than fit, is dropped for the block.
+    //
+    // For fully-active sources the matrix then applies routings segment by
+    // segment without reading the output buffer, and targets reached only
+    // by block-constant contributions stay single-valued for the block.
+    //
+    // The description is a promise about the dense output, not a
+    // replacement for it: the output buffer must still hold the value for
+    // every rendered sample (feedback cycles, contended Replace targets and
+    // external readers use it). The matrix clears all descriptions at block
+    // start (clear_output_segments) and ignores them for sources rendered
+    // sample-by-sample inside a feedback cycle.
+    struct OutputSegment {
+        uint32_t m_start = 0;
+        float m_value = 0.0f;
+    };
+
+    static constexpr uint32_t k_max_output_segments = 8;
+
+    [[nodiscard]] std::span<const OutputSegment> output_segments() const {
+        if (m_num_output_segments > k_max_output_segments) { return {}; }
+        return {m_output_segments.data(), m_num_output_segments};
+    }
+
+    [[nodiscard]] std::span<const OutputSegment> voice_output_segments(uint32_t v) const {
+        assert(v < m_num_voices);
+        const uint32_t count = m_voice_num_output_segments[v];
+        if (count > k_max_output_segments) { return {}; }
+        return {m_voice_output_segments.data() + static_cast<size_t>(v) * k_max_output_segments,
+                count};
+    }
+
+    [[nodiscard]] bool is_output_constant() const { return m_num_output_segments == 1; }
+    [[nodiscard]] float constant_output() const { return m_output_segments[0].m_value; }
+
+    [[nodiscard]] bool is_voice_output_constant(uint32_t v) const {
+        assert(v < m_num_voices);
+        return m_voice_num_output_segments[v] == 1;
+    }
+
+    [[nodiscard]] float constant_voice_output(uint32_t v) const {
+        assert(v < m_num_voices);
+        return m_voice_output_segments[static_cast<size_t>(v) * k_max_output_segments].m_value;
+    }
+
+    void clear_output_segments() {
+        m_num_output_segments = 0;
+        std::ranges::fill(m_voice_num_output_segments, 0u);
+    }
+
     // ── Output active mask accessors ────────────────────────────────────
     const std::vector<uint8_t>& get_output_active() const { return m_output_active; }
     std::vector<uint8_t>& get_output_active() { return m_output_active; }
@@ -167,9 +236,37 @@ protected:
             }
 
             if (!m_fully_active) { m_voice_output_active_storage.assign(total, 0); }
+            m_voice_output_segments.assign(
+                static_cast<size_t>(m_num_voices) * k_max_output_segments, OutputSegment{});
+            m_voice_num_output_segments.assign(m_num_voices, 0);
         }
     }
 
+    void declare_constant_output(float value) {
+        m_output_segments[0] = {0, value};
+        m_num_output_segments = 1;
+    }
+
+    void declare_voice_constant_output(uint32_t voice_index, float value) {
+        assert(voice_index < m_num_voices);
+        m_voice_output_segments[static_cast<size_t>(voice_index) * k_max_output_segments] = {0,
+                                                                                             value};
+        m_voice_num_output_segments[voice_index] = 1;
+    }
+
+    void declare_output_segment(uint32_t start, float value) {
+        push_output_segment(m_output_segments.data(), m_num_output_segments, start, value);
+    }
+
+    void declare_voice_output_segment(uint32_t voice_index, uint32_t start, float value) {
+        assert(voice_index < m_num_voices);
+        push_output_segment(m_voice_output_segments.data() +
+                                static_cast<size_t>(voice_index) * k_max_output_segments,
+                            m_voice_num_output_segments[voice_index],
+                            start,
+                            value);
+    }
+
     void record_change_point(uint32_t sample_index) { m_change_points.push_back(sample_index); }
 
     void record_voice_change_point(uint32_t voice_index, uint32_t sample_index) {
@@ -207,6 +304,28 @@ private:
     // Output active masks — only allocated when !m_fully_active
     std::vector<uint8_t> m_output_active;
     std::vector<uint8_t> m_voice_output_active_storage;
+
+    // Appends one segment. A segment at sample 0 starts a new description;
+    // a count past k_max_output_segments marks it as dropped until then.
+    static void push_output_segment(OutputSegment* segments,
+                                    uint32_t& count,
+                                    uint32_t start,
+                                    float value) {
+        if (start == 0) { count = 0; }
+        if (count >= k_max_output_segments || (count == 0 && start != 0)) {
+            count = k_max_output_segments + 1;
+            return;
+        }
+        assert(count == 0 || start > segments[count - 1].m_start);
+        segments[count++] = {start, value};
+    }
+
+    // Piecewise-constant descriptions — reset every block by the matrix.
+    // Voice v's segments live at v * k_max_output_segments.
+    std::array<OutputSegment, k_max_output_segments> m_output_segments{};
+    uint32_t m_num_output_segments = 0;
+    std::vector<OutputSegment> m_voice_output_segments;
+    std::vector<uint32_t> m_voice_num_output_segments;
 };
 
 }  // namespace thl::modulation
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "tanh/dsp/utils/ChangePointMask.h"
 #include "tanh/state/ModulationScope.h"
 #include "tanh/state/ParameterDefinitions.h"
 
@@ -37,7 +38,10 @@ struct VoiceBuffers {
 
     // Change-point flags are needed whenever either additive or replace is
     // present, so they live at the VoiceBuffers level rather than per-path.
-    std::vector<uint8_t> m_change_point_flags_storage;
+    // Packed bitset (see ChangePointMask.h), m_change_point_words words per
+    // voice.
+    size_t m_change_point_words = 0;
+    std::vector<uint64_t> m_change_point_bits_storage;
     std::vector<std::vector<uint32_t>> m_change_points;
 
     // ── Replace — only allocated if m_has_replace ───────────────────────
@@ -60,6 +64,22 @@ struct VoiceBuffers {
     std::vector<uint32_t> m_replace_priority_storage;
     std::vector<uint64_t> m_replace_freshness_storage;
 
+    // ── Per-block sparsity state (audio thread only, one entry per voice) ─
+    // Every voice starts a block "uniform": its whole modulation is the
+    // single value in m_uniform_additive / m_uniform_replace(_active) and
+    // its dense storage above is all-zero. The first per-sample write turns
+    // it dense (make_dense). m_voice_dirty records which voices touched
+    // their dense storage (values, masks, watermarks or change-point bits)
+    // since the last clear, so clear_per_block only wipes those ranges.
+    std::vector<uint8_t> m_voice_dense;
+    std::vector<uint8_t> m_voice_dirty;
+    std::vector<float> m_uniform_additive;
+    std::vector<float> m_uniform_replace;
+    std::vector<uint8_t> m_uniform_replace_active;
+    // block_size ones: the replace-active mask handed out for a uniform
+    // voice whose Replace value is live. Only allocated if m_has_replace.
+    std::vector<uint8_t> m_replace_all_active;
+
     VoiceBuffers() = default;
 
     VoiceBuffers(uint32_t num_voices,
@@ -77,7 +97,9 @@ struct VoiceBuffers {
         if (m_has_additive) { m_additive_storage.assign(total, 0.0f); }
 
         if (m_has_additive || m_has_replace) {
-            m_change_point_flags_storage.assign(total, 0);
+            m_change_point_words = dsp::utils::change_point_words(block_size);
+            m_change_point_bits_storage.assign(
+                static_cast<size_t>(num_voices) * m_change_point_words, uint64_t{0});
             m_change_points.resize(num_voices);
             for (auto& cp : m_change_points) {
                 cp.clear();
@@ -94,6 +116,40 @@ struct VoiceBuffers {
             m_replace_priority_storage.assign(total, 0u);
             m_replace_freshness_storage.assign(total, uint64_t{0});
         }
+
+        m_voice_dense.assign(num_voices, 0);
+        m_voice_dirty.assign(num_voices, 0);
+        m_uniform_additive.assign(num_voices, 0.0f);
+        m_uniform_replace.assign(num_voices, 0.0f);
+        m_uniform_replace_active.assign(num_voices, 0);
+        if (m_has_replace) { m_replace_all_active.assign(block_size, 1); }
+    }
+
+    [[nodiscard]] bool is_dense(uint32_t v) const {
+        assert(v < m_num_voices);
+        return m_voice_dense[v] != 0;
+    }
+
+    void mark_dirty(uint32_t v) {
+        assert(v < m_num_voices);
+        m_voice_dirty[v] = 1;
+    }
+
+    // Switch voice v to per-sample storage, expanding its uniform values
+    // into the (still zero) dense ranges. Must precede any per-sample write.
+    void make_dense(uint32_t v) {
+        assert(v < m_num_voices);
+        if (m_voice_dense[v] != 0) { return; }
+        m_voice_dense[v] = 1;
+        m_voice_dirty[v] = 1;
+        const size_t base = static_cast<size_t>(v) * m_block_size;
+        if (m_has_additive && m_uniform_additive[v] != 0.0f) {
+            std::fill_n(m_additive_storage.begin() + base, m_block_size, m_uniform_additive[v]);
+        }
+        if (m_has_replace && m_uniform_replace_active[v] != 0) {
+            std::fill_n(m_replace_storage.begin() + base, m_block_size, m_uniform_replace[v]);
+            std::fill_n(m_replace_active_storage.begin() + base, m_block_size, uint8_t{1});
+        }
     }
 
     float* additive_voice(uint32_t v) {
@@ -126,6 +182,20 @@ struct VoiceBuffers {
         return m_replace_active_storage.data() + static_cast<size_t>(v) * m_block_size;
     }
 
+    uint64_t* change_point_bits_voice(uint32_t v) {
+        assert((m_has_additive || m_has_replace) && v < m_num_voices);
+        return m_change_point_bits_storage.data() + static_cast<size_t>(v) * m_change_point_words;
+    }
+
+    const uint64_t* change_point_bits_voice(uint32_t v) const {
+        assert((m_has_additive || m_has_replace) && v < m_num_voices);
+        return m_change_point_bits_storage.data() + static_cast<size_t>(v) * m_change_point_words;
+    }
+
+    dsp::utils::ChangePointMask change_point_mask_voice(uint32_t v) const {
+        return {{change_point_bits_voice(v), m_change_point_words}, m_block_size};
+    }
+
     uint32_t* replace_priority_voice(uint32_t v) {
         assert(m_has_replace_priority && v < m_num_voices);
         return m_replace_priority_storage.data() + static_cast<size_t>(v) * m_block_size;
@@ -146,33 +216,46 @@ struct VoiceBuffers {
         return m_replace_freshness_storage.data() + static_cast<size_t>(v) * m_block_size;
     }
 
+    // Wipes only the voices written since the last clear; every voice
+    // starts the next block uniform and unmodulated.
     void clear_per_block() {
-        if (m_has_additive) { std::ranges::fill(m_additive_storage, 0.0f); }
-        if (m_has_additive || m_has_replace) {
-            std::ranges::fill(m_change_point_flags_storage, uint8_t{0});
-            for (auto& cp : m_change_points) { cp.clear(); }
-        }
-        if (m_has_replace) {
-            std::ranges::fill(m_replace_storage, 0.0f);
-            std::ranges::fill(m_replace_active_storage, uint8_t{0});
-        }
-        if (m_has_replace_priority) {
-            std::ranges::fill(m_replace_priority_storage, uint32_t{0});
-            std::ranges::fill(m_replace_freshness_storage, uint64_t{0});
+        for (uint32_t v = 0; v < m_num_voices; ++v) {
+            if (m_voice_dirty[v] == 0) { continue; }
+            m_voice_dirty[v] = 0;
+            const size_t base = static_cast<size_t>(v) * m_block_size;
+            if (m_has_additive) {
+                std::fill_n(m_additive_storage.begin() + base, m_block_size, 0.0f);
+            }
+            if (m_has_additive || m_has_replace) {
+                std::fill_n(m_change_point_bits_storage.begin() +
+                                static_cast<size_t>(v) * m_change_point_words,
+                            m_change_point_words,
+                            uint64_t{0});
+                m_change_points[v].clear();
+            }
+            if (m_has_replace) {
+                std::fill_n(m_replace_storage.begin() + base, m_block_size, 0.0f);
+                std::fill_n(m_replace_active_storage.begin() + base, m_block_size, uint8_t{0});
+            }
+            if (m_has_replace_priority) {
+                std::fill_n(m_replace_priority_storage.begin() + base, m_block_size, 0u);
+                std::fill_n(m_replace_freshness_storage.begin() + base, m_block_size, uint64_t{0});
+            }
         }
+        std::ranges::fill(m_voice_dense, uint8_t{0});
+        std::ranges::fill(m_uniform_additive, 0.0f);
+        std::ranges::fill(m_uniform_replace_active, uint8_t{0});
     }
 
+    // Clean voices carry no change-point bits, and their lists were emptied
+    // when they were last cleared.
     void build_change_points() {
         if (!m_has_additive && !m_has_replace) { return; }
         for (uint32_t v = 0; v < m_num_voices; ++v) {
+            if (m_voice_dirty[v] == 0) { continue; }
             auto& cp = m_change_points[v];
             cp.clear();
-            const size_t base = static_cast<size_t>(v) * m_block_size;
-            for (size_t i = 0; i < m_block_size; ++i) {
-                if (m_change_point_flags_storage[base + i]) {
-                    cp.push_back(static_cast<uint32_t>(i));
-                }
-            }
+            change_point_mask_voice(v).for_each([&cp](uint32_t i) { cp.push_back(i); });
         }
     }
 };
@@ -206,10 +289,18 @@ struct MonoBuffers {
     std::vector<uint64_t> m_replace_freshness;
 
     // Change points — allocated whenever m_has_additive || m_has_replace.
-    // uint8_t (not bool) so callers can write through a pointer.
-    std::vector<uint8_t> m_change_point_flags;
+    // Packed bitset, see ChangePointMask.h.
+    std::vector<uint64_t> m_change_point_bits;
     std::vector<uint32_t> m_change_points;
 
+    // Per-block sparsity state — mono counterpart of the VoiceBuffers
+    // fields of the same name.
+    bool m_dense = false;
+    bool m_dirty = false;
+    float m_uniform_additive = 0.0f;
+    float m_uniform_replace = 0.0f;
+    bool m_uniform_replace_active = false;
+
     MonoBuffers() = default;
 
     MonoBuffers(size_t block_size, bool has_additive, bool has_replace, bool has_replace_priority)
@@ -227,17 +318,36 @@ struct MonoBuffers {
             m_replace_freshness.assign(block_size, uint64_t{0});
         }
         if (m_has_additive || m_has_replace) {
-            m_change_point_flags.assign(block_size, 0);
+            m_change_point_bits.assign(dsp::utils::change_point_words(block_size), uint64_t{0});
             m_change_points.clear();
             m_change_points.reserve(block_size);
         }
     }
 
+    // See VoiceBuffers::make_dense.
+    void make_dense() {
+        if (m_dense) { return; }
+        m_dense = true;
+        m_dirty = true;
+        if (m_has_additive && m_uniform_additive != 0.0f) {
+            std::ranges::fill(m_additive_buffer, m_uniform_additive);
+        }
+        if (m_has_replace && m_uniform_replace_active) {
+            std::ranges::fill(m_replace_buffer, m_uniform_replace);
+            std::ranges::fill(m_replace_active, uint8_t{1});
+        }
+    }
+
     void clear_per_block() {
+        if (m_has_additive || m_has_replace) { m_change_points.clear(); }
+        m_dense = false;
+        m_uniform_additive = 0.0f;
+        m_uniform_replace_active = false;
+        if (!m_dirty) { return; }
+        m_dirty = false;
         if (m_has_additive) { std::ranges::fill(m_additive_buffer, 0.0f); }
         if (m_has_additive || m_has_replace) {
-            std::ranges::fill(m_change_point_flags, uint8_t{0});
-            m_change_points.clear();
+            std::ranges::fill(m_change_point_bits, uint64_t{0});
         }
         if (m_has_replace) {
             std::ranges::fill(m_replace_buffer, 0.0f);
@@ -252,18 +362,20 @@ struct MonoBuffers {
     void build_change_points() {
         if (!m_has_additive && !m_has_replace) { return; }
         m_change_points.clear();
-        for (size_t i = 0; i < m_block_size; ++i) {
-            if (m_change_point_flags[i]) { m_change_points.push_back(static_cast<uint32_t>(i)); }
-        }
+        change_point_mask().for_each([this](uint32_t i) { m_change_points.push_back(i); });
+    }
+
+    dsp::utils::ChangePointMask change_point_mask() const {
+        return {m_change_point_bits, m_block_size};
     }
 };
 
 // Per-parameter modulation target. Exposes swappable VoiceBuffers and
 // MonoBuffers via atomic pointers; SmartHandle and the matrix's audio-thread
 // paths read these without any RCU call or refcount. The writer allocates
-// fresh buffer instances under m_writer_mutex, atomic-stores the new pointers
-// *after* m_config.synchronize() has drained all in-flight audio blocks, and
-// reclaims retired buffers at the end of the rebuild.
+// fresh buffer instances under m_writer_mutex, atomic-stores the new pointers,
+// and at the end of the rebuild hands the retired buffers to the matrix's
+// DeferredReclaimer.
 struct ResolvedTarget {
     // ── Hot fields read by SmartHandle::load() on every sample ───────────
 
@@ -277,7 +389,8 @@ struct ResolvedTarget {
     // Atomic buffer pointers — swapped by writer, read by audio thread.
     // nullptr means this target has no active routings of that polyphony.
     // Pointed-to object is owned by m_voice_owner / m_mono_owner (writer-only)
-    // and stays alive until retired past a synchronize() barrier.
+    // and stays alive until the DeferredReclaimer sees no ReadScope that
+    // could still reference it.
     std::atomic<VoiceBuffers*> m_voice{nullptr};
     std::atomic<MonoBuffers*> m_mono{nullptr};
 
@@ -299,10 +412,9 @@ struct ResolvedTarget {
     std::unique_ptr<VoiceBuffers> m_voice_owner;
     std::unique_ptr<MonoBuffers> m_mono_owner;
 
-    // Retirement lists for deferred reclamation. After a rebuild stores new
-    // owners, the previous owners are pushed here and drained only after
-    // m_config.synchronize() has guaranteed no in-flight audio block still
-    // references them.
+    // Retirement lists. After a rebuild stores new owners, the previous owners
+    // are pushed here and handed to the DeferredReclaimer once the new config
+    // is published.
     std::vector<std::unique_ptr<VoiceBuffers>> m_voice_retired;
     std::vector<std::unique_ptr<MonoBuffers>> m_mono_retired;
 
@@ -323,7 +435,9 @@ struct ResolvedTarget {
     // RT-safe: read the base value as float from the parameter's atomic cache.
     [[nodiscard]] float read_base_as_float() const;
 
-    // Called once per block from the audio thread at block start.
+    // Called once per block from the audio thread at block start. Only the
+    // voices / mono buffer written during the previous block pay for a
+    // wipe; see VoiceBuffers::m_voice_dirty.
     void clear_per_block() {
         if (auto* v = m_voice.load(std::memory_order_acquire)) { v->clear_per_block(); }
         if (auto* m = m_mono.load(std::memory_order_acquire)) { m->clear_per_block(); }
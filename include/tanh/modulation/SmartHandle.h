@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tanh/dsp/utils/ChangePointMask.h>
+#include <tanh/dsp/utils/SimdFloat.h>
 #include <tanh/modulation/ResolvedTarget.h>
 #include <tanh/state/Parameter.h>
 #include <tanh/utils/RealtimeSanitizer.h>
@@ -30,12 +32,12 @@ namespace thl::modulation {
 // The hot path is a single std::memory_order_acquire load of either the
 // ResolvedTarget::m_voice or ResolvedTarget::m_mono atomic pointer, followed
 // by direct reads through the returned const pointer. The pointed-to buffer
-// object is immutable while published; the writer swaps the pointer and only
-// destroys retired buffers after m_config.synchronize() has guaranteed no
-// in-flight audio block still references them.
+// object is immutable while published; the writer swaps the pointer and the
+// matrix's DeferredReclaimer destroys retired buffers only once no open
+// ReadScope can still reference them.
 //
 // Every access to the conditionally-allocated storage vectors
-// (m_additive_*, m_replace_*, m_change_point_flags*, m_change_points) below
+// (m_additive_*, m_replace_*, m_change_point_bits*, m_change_points) below
 // is gated on VoiceBuffers::m_has_additive / m_has_replace (or the MonoBuffers
 // equivalents). Those storage vectors are only allocated when the matching
 // flag is set at construction time — reading through an unallocated span is
@@ -74,6 +76,13 @@ public:
         if (!m_target) { return m_handle.load(); }
 
         if (auto* vb = m_target->m_voice.load(std::memory_order_acquire)) {
+            // Uniform voice: the whole block's modulation is one value pair.
+            if (!vb->is_dense(voice_index)) {
+                const float base_f = vb->m_uniform_replace_active[voice_index] != 0
+                                         ? vb->m_uniform_replace[voice_index]
+                                         : static_cast<float>(m_handle.load());
+                return apply_modulation(base_f, vb->m_uniform_additive[voice_index]);
+            }
             float base_f = 0.0f;
             float mod = 0.0f;
             // Flag-gate before touching replace_*/additive_* storage: those
@@ -87,6 +96,12 @@ public:
             if (vb->m_has_additive) { mod = vb->additive_voice(voice_index)[modulation_offset]; }
             return apply_modulation(base_f, mod);
         } else if (auto* mb = m_target->m_mono.load(std::memory_order_acquire)) {
+            if (!mb->m_dense) {
+                const float base_f = mb->m_uniform_replace_active
+                                         ? mb->m_uniform_replace
+                                         : static_cast<float>(m_handle.load());
+                return apply_modulation(base_f, mb->m_uniform_additive);
+            }
             float base_f = 0.0f;
             float mod = 0.0f;
             if (mb->m_has_replace && modulation_offset < mb->m_replace_active.size() &&
@@ -111,7 +126,7 @@ public:
     //
     // TIMING: same caveat as change_points_voice() — only populated by
     // MonoBuffers::build_change_points() at end-of-block. Mid-block readers
-    // should use change_point_flags() instead.
+    // should use change_point_mask() instead.
     const std::vector<uint32_t>* change_points() const TANH_NONBLOCKING_FUNCTION {
         if (!m_target) { return nullptr; }
         if (auto* mb = m_target->m_mono.load(std::memory_order_acquire)) {
@@ -120,19 +135,21 @@ public:
         return nullptr;
     }
 
-    // Access the mono change-point flag bitmask (one uint8_t per sample) for
-    // this parameter's target. Returns nullptr if the target has no mono
-    // buffer or carries no modulation flags.
+    // Access the mono change-point bitset (one bit per sample, see
+    // ChangePointMask.h) for this parameter's target. Returns an empty mask
+    // if the target has no mono buffer or carries no modulation flags.
     //
     // Live counterpart to change_points() — updated as the matrix applies
     // each upstream routing, so mid-block readers (e.g. a relay source)
     // observe change points already contributed by Tarjan-earlier sources.
-    // Pointer is valid for the current RCU block scope.
-    const uint8_t* change_point_flags() const TANH_NONBLOCKING_FUNCTION {
-        if (!m_target) { return nullptr; }
+    // The view is valid for the current RCU block scope.
+    dsp::utils::ChangePointMask change_point_mask() const TANH_NONBLOCKING_FUNCTION {
+        if (!m_target) { return dsp::utils::ChangePointMask(); }
         auto* mb = m_target->m_mono.load(std::memory_order_acquire);
-        if (!mb || !(mb->m_has_additive || mb->m_has_replace)) { return nullptr; }
-        return mb->m_change_point_flags.data();
+        if (!mb || !(mb->m_has_additive || mb->m_has_replace)) {
+            return dsp::utils::ChangePointMask();
+        }
+        return mb->change_point_mask();
     }
 
     // Access the per-voice replace-active mask (one uint8_t per sample) for
@@ -146,6 +163,11 @@ public:
         // !m_has_replace → m_replace_active_storage was never allocated;
         // returning nullptr is the contract, not an error.
         if (!vb || !vb->m_has_replace) { return nullptr; }
+        // A uniform voice's dense mask is still all-zero; hand out the
+        // shared all-ones mask when its uniform Replace value is live.
+        if (!vb->is_dense(voice_index) && vb->m_uniform_replace_active[voice_index] != 0) {
+            return vb->m_replace_all_active.data();
+        }
         return vb->replace_active_voice(voice_index);
     }
 
@@ -159,7 +181,7 @@ public:
     // which the matrix runs once per block *after* all sources have executed.
     // Readers that run mid-block (e.g. a relay source inside
     // process_source_bulk_with_scope) will observe stale previous-block data.
-    // For live in-block reads use change_point_flags_voice() instead.
+    // For live in-block reads use change_point_mask_voice() instead.
     const std::vector<uint32_t>* change_points_voice(uint32_t voice_index) const
         TANH_NONBLOCKING_FUNCTION {
         if (!m_target) { return nullptr; }
@@ -169,22 +191,24 @@ public:
         return &vb->m_change_points[voice_index];
     }
 
-    // Access the per-voice change-point flag bitmask (one uint8_t per sample)
-    // for this parameter's target. Returns nullptr if the target has no voice
+    // Access the per-voice change-point bitset (one bit per sample) for this
+    // parameter's target. Returns an empty mask if the target has no voice
     // buffer, carries no modulation flags, or voice_index is out of range.
     //
-    // Unlike change_points_voice(), the flag storage is updated live as the
+    // Unlike change_points_voice(), the bitset is updated live as the
     // matrix applies each upstream routing — so a mid-block reader (e.g. a
     // relay source) sees the change points already contributed by sources
-    // that Tarjan ordered before it. Pointer is valid for the current RCU
+    // that Tarjan ordered before it. The view is valid for the current RCU
     // block scope.
-    const uint8_t* change_point_flags_voice(uint32_t voice_index) const TANH_NONBLOCKING_FUNCTION {
-        if (!m_target) { return nullptr; }
+    dsp::utils::ChangePointMask change_point_mask_voice(uint32_t voice_index) const
+        TANH_NONBLOCKING_FUNCTION {
+        if (!m_target) { return dsp::utils::ChangePointMask(); }
         auto* vb = m_target->m_voice.load(std::memory_order_acquire);
-        if (!vb || !(vb->m_has_additive || vb->m_has_replace)) { return nullptr; }
-        if (voice_index >= vb->m_num_voices) { return nullptr; }
-        return vb->m_change_point_flags_storage.data() +
-               static_cast<size_t>(voice_index) * vb->m_block_size;
+        if (!vb || !(vb->m_has_additive || vb->m_has_replace) ||
+            voice_index >= vb->m_num_voices) {
+            return dsp::utils::ChangePointMask();
+        }
+        return vb->change_point_mask_voice(voice_index);
     }
 
     thl::ParameterHandle<T> raw_handle() const TANH_NONBLOCKING_FUNCTION { return m_handle; }
@@ -215,22 +239,36 @@ public:
 
         if (auto* vb = m_target->m_voice.load(std::memory_order_acquire)) {
             has_mod_state = true;
-            if (vb->m_has_replace && vb->replace_active_voice(voice_index)[modulation_offset]) {
+            if (!vb->is_dense(voice_index)) {
+                base_f = vb->m_uniform_replace_active[voice_index] != 0
+                             ? vb->m_uniform_replace[voice_index]
+                             : static_cast<float>(m_handle.load());
+                mod = vb->m_uniform_additive[voice_index];
+            } else if (vb->m_has_replace &&
+                       vb->replace_active_voice(voice_index)[modulation_offset]) {
                 base_f = vb->replace_voice(voice_index)[modulation_offset];
             } else {
                 base_f = static_cast<float>(m_handle.load());
             }
-            if (vb->m_has_additive) { mod = vb->additive_voice(voice_index)[modulation_offset]; }
+            if (vb->m_has_additive && vb->is_dense(voice_index)) {
+                mod = vb->additive_voice(voice_index)[modulation_offset];
+            }
         } else if (auto* mb = m_target->m_mono.load(std::memory_order_acquire)) {
             has_mod_state = true;
-            if (mb->m_has_replace && modulation_offset < mb->m_replace_active.size() &&
-                mb->m_replace_active[modulation_offset]) {
-                base_f = mb->m_replace_buffer[modulation_offset];
+            if (!mb->m_dense) {
+                base_f = mb->m_uniform_replace_active ? mb->m_uniform_replace
+                                                      : static_cast<float>(m_handle.load());
+                mod = mb->m_uniform_additive;
             } else {
-                base_f = static_cast<float>(m_handle.load());
-            }
-            if (mb->m_has_additive && modulation_offset < mb->m_additive_buffer.size()) {
-                mod = mb->m_additive_buffer[modulation_offset];
+                if (mb->m_has_replace && modulation_offset < mb->m_replace_active.size() &&
+                    mb->m_replace_active[modulation_offset]) {
+                    base_f = mb->m_replace_buffer[modulation_offset];
+                } else {
+                    base_f = static_cast<float>(m_handle.load());
+                }
+                if (mb->m_has_additive && modulation_offset < mb->m_additive_buffer.size()) {
+                    mod = mb->m_additive_buffer[modulation_offset];
+                }
             }
         }
 
@@ -252,6 +290,84 @@ public:
         return m_handle.range().to_normalized(base_f + mod);
     }
 
+    // Block counterpart of load(): writes load(modulation_offset + i,
+    // voice_index) into out[i] for every i in out.
+    //
+    // The buffer pointers and the base value are resolved once for the whole
+    // span instead of once per sample. Float targets on plain-space buffers
+    // combine base + additive with FloatBatch; normalized-buffer targets
+    // clamp in normalized space with FloatBatch and pay the curve conversion
+    // per sample only. A target with no dense buffers to combine (nothing
+    // published, or a voice that only received block-constant contributions)
+    // holds one value for the block: it is computed once by load(), through
+    // the same apply_modulation() path, and filled.
+    //
+    // modulation_offset + out.size() must not exceed the matrix block size.
+    void load_block(std::span<T> out,
+                    uint32_t voice_index = 0,
+                    uint32_t modulation_offset = 0) const TANH_NONBLOCKING_FUNCTION {
+        const BlockBuffers buffers = resolve_block(voice_index, modulation_offset, out.size());
+        if (buffers.m_uniform) {
+            std::fill(out.begin(), out.end(), load(modulation_offset, voice_index));
+            return;
+        }
+        if (!buffers.m_additive && !buffers.m_replace) {
+            std::fill(out.begin(), out.end(), load(modulation_offset, voice_index));
+            return;
+        }
+
+        const auto base_f = static_cast<float>(m_handle.load());
+        const size_t n = out.size();
+
+        if constexpr (std::is_same_v<T, float>) {
+            if (m_target->m_uses_normalized_buffer) {
+                // Stage the clamped normalized values in `out`, then convert.
+                combine_normalized(out.data(), base_f, buffers, n);
+                for (float& v : out) { v = m_target->m_range->from_normalized(v); }
+            } else {
+                combine_plain(out.data(), base_f, buffers, n);
+            }
+        } else {
+            // double / int / bool: still one pointer resolution per block, but
+            // the snap and type conversion stay per sample.
+            for (size_t i = 0; i < n; ++i) {
+                const float b = buffers.m_replace && buffers.m_replace_active[i]
+                                    ? buffers.m_replace[i]
+                                    : base_f;
+                const float mod = buffers.m_additive ? buffers.m_additive[i] : 0.0f;
+                out[i] = apply_modulation(b, mod);
+            }
+        }
+    }
+
+    // Block counterpart of load_normalized(): writes
+    // load_normalized(modulation_offset + i, voice_index) into out[i].
+    // Same resolution and preconditions as load_block().
+    void load_block_normalized(std::span<float> out,
+                               uint32_t voice_index = 0,
+                               uint32_t modulation_offset = 0) const TANH_NONBLOCKING_FUNCTION {
+        const BlockBuffers buffers = resolve_block(voice_index, modulation_offset, out.size());
+        if (buffers.m_uniform) {
+            std::fill(out.begin(), out.end(), load_normalized(modulation_offset, voice_index));
+            return;
+        }
+        const auto base_f = static_cast<float>(m_handle.load());
+        const thl::Range& range = m_handle.range();
+
+        if (!buffers.m_additive && !buffers.m_replace) {
+            std::fill(out.begin(), out.end(), load_normalized(modulation_offset, voice_index));
+            return;
+        }
+
+        if (m_target->m_uses_normalized_buffer) {
+            combine_normalized(out.data(), base_f, buffers, out.size());
+            return;
+        }
+
+        combine_plain(out.data(), base_f, buffers, out.size());
+        for (float& v : out) { v = range.to_normalized(v); }
+    }
+
     // Returns the block size of whichever buffer set is currently published
     // for this target, or 0 if unmodulated.
     size_t get_buffer_size() const TANH_NONBLOCKING_FUNCTION {
@@ -269,6 +385,131 @@ public:
     ResolvedTarget* target() const TANH_NONBLOCKING_FUNCTION { return m_target; }
 
 private:
+    using Batch = thl::dsp::utils::simd::FloatBatch;
+
+    // Buffer pointers for one voice, already advanced to the block's first
+    // sample. Null where the published buffer carries no such storage.
+    // m_uniform: the voice holds one value for the whole block (see
+    // VoiceBuffers::m_voice_dense) and the pointers are left null.
+    struct BlockBuffers {
+        const float* m_additive = nullptr;
+        const float* m_replace = nullptr;
+        const uint8_t* m_replace_active = nullptr;
+        bool m_uniform = false;
+    };
+
+    // Single acquire load of m_voice / m_mono for a whole block. Applies the
+    // same flag gates as load() — see header comment.
+    BlockBuffers resolve_block(uint32_t voice_index,
+                               uint32_t modulation_offset,
+                               [[maybe_unused]] size_t num_samples) const
+        TANH_NONBLOCKING_FUNCTION {
+        BlockBuffers buffers;
+        if (!m_target) { return buffers; }
+
+        if (auto* vb = m_target->m_voice.load(std::memory_order_acquire)) {
+            assert(modulation_offset + num_samples <= vb->m_block_size);
+            if (!vb->is_dense(voice_index)) {
+                buffers.m_uniform = true;
+                return buffers;
+            }
+            if (vb->m_has_replace) {
+                buffers.m_replace = vb->replace_voice(voice_index) + modulation_offset;
+                buffers.m_replace_active = vb->replace_active_voice(voice_index) +
+                                           modulation_offset;
+            }
+            if (vb->m_has_additive) {
+                buffers.m_additive = vb->additive_voice(voice_index) + modulation_offset;
+            }
+        } else if (auto* mb = m_target->m_mono.load(std::memory_order_acquire)) {
+            assert(modulation_offset + num_samples <= mb->m_block_size);
+            if (!mb->m_dense) {
+                buffers.m_uniform = true;
+                return buffers;
+            }
+            if (mb->m_has_replace) {
+                buffers.m_replace = mb->m_replace_buffer.data() + modulation_offset;
+                buffers.m_replace_active = mb->m_replace_active.data() + modulation_offset;
+            }
+            if (mb->m_has_additive) {
+                buffers.m_additive = mb->m_additive_buffer.data() + modulation_offset;
+            }
+        }
+        return buffers;
+    }
+
+    // dst[i] = (replace active ? replace[i] : base) + additive[i], plain space.
+    static void combine_plain(float* dst,
+                              float base_f,
+                              const BlockBuffers& buffers,
+                              size_t n) TANH_NONBLOCKING_FUNCTION {
+        if (buffers.m_replace) {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = buffers.m_replace_active[i] ? buffers.m_replace[i] : base_f;
+            }
+            if (buffers.m_additive) { add_in_place(dst, buffers.m_additive, n); }
+            return;
+        }
+
+        const Batch base = Batch::broadcast(base_f);
+        size_t i = 0;
+        for (; i + Batch::k_width <= n; i += Batch::k_width) {
+            (base + Batch::load(buffers.m_additive + i)).store(dst + i);
+        }
+        for (; i < n; ++i) { dst[i] = base_f + buffers.m_additive[i]; }
+    }
+
+    // Normalized-space combine for targets whose buffers hold normalized
+    // deltas: dst[i] = wrap_or_clamp(to_normalized(base_i) + additive[i]).
+    // Without a Replace routing the base is converted once for the block.
+    void combine_normalized(float* dst,
+                            float base_f,
+                            const BlockBuffers& buffers,
+                            size_t n) const TANH_NONBLOCKING_FUNCTION {
+        const thl::Range& range = *m_target->m_range;
+        const float base_norm = range.to_normalized(base_f);
+
+        if (buffers.m_replace) {
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = buffers.m_replace_active[i] ? range.to_normalized(buffers.m_replace[i])
+                                                     : base_norm;
+            }
+            if (buffers.m_additive) { add_in_place(dst, buffers.m_additive, n); }
+        } else {
+            const Batch base = Batch::broadcast(base_norm);
+            size_t i = 0;
+            for (; i + Batch::k_width <= n; i += Batch::k_width) {
+                (base + Batch::load(buffers.m_additive + i)).store(dst + i);
+            }
+            for (; i < n; ++i) { dst[i] = base_norm + buffers.m_additive[i]; }
+        }
+
+        if (range.m_periodic) {
+            for (size_t i = 0; i < n; ++i) {
+                float v = std::fmod(dst[i], 1.0f);
+                if (v < 0.0f) { v += 1.0f; }
+                dst[i] = v;
+            }
+            return;
+        }
+
+        const Batch zero = Batch::broadcast(0.0f);
+        const Batch one = Batch::broadcast(1.0f);
+        size_t i = 0;
+        for (; i + Batch::k_width <= n; i += Batch::k_width) {
+            Batch::min(Batch::max(Batch::load(dst + i), zero), one).store(dst + i);
+        }
+        for (; i < n; ++i) { dst[i] = std::clamp(dst[i], 0.0f, 1.0f); }
+    }
+
+    static void add_in_place(float* dst, const float* src, size_t n) TANH_NONBLOCKING_FUNCTION {
+        size_t i = 0;
+        for (; i + Batch::k_width <= n; i += Batch::k_width) {
+            (Batch::load(dst + i) + Batch::load(src + i)).store(dst + i);
+        }
+        for (; i < n; ++i) { dst[i] += src[i]; }
+    }
+
     // Common modulation application: base_f + mod with curve conversion and type cast.
     T apply_modulation(float base_f, float mod) const TANH_NONBLOCKING_FUNCTION {
         float result;
@@ -343,8 +584,64 @@ ResolvedTarget* handle_target(const H& h) TANH_NONBLOCKING_FUNCTION {
     }
 }
 
+
+// Live change-point bitset of one handle's target for voice_index (mono
+// buffer and voice buffer merged by the caller). Empty when the target
+// carries no modulation.
+template <typename Handle>
+void target_change_point_masks(const Handle& h,
+                               uint32_t voice_index,
+                               dsp::utils::ChangePointMask& mono,
+                               dsp::utils::ChangePointMask& voice) TANH_NONBLOCKING_FUNCTION {
+    mono = dsp::utils::ChangePointMask();
+    voice = dsp::utils::ChangePointMask();
+    auto* t = handle_target(h);
+    if (!t) { return; }
+    if (auto* mb = t->m_mono.load(std::memory_order_acquire);
+        mb && (mb->m_has_additive || mb->m_has_replace)) {
+        mono = mb->change_point_mask();
+    }
+    // m_change_point_bits_storage is only allocated when the buffer actually
+    // carries modulation (either flag set).
+    if (auto* vb = t->m_voice.load(std::memory_order_acquire);
+        vb && (vb->m_has_additive || vb->m_has_replace) && voice_index < vb->m_num_voices) {
+        voice = vb->change_point_mask_voice(voice_index);
+    }
+}
+
 }  // namespace detail
 
+// Free utility: OR the change-point bitsets of a span of handles into
+// out_words (one bit per sample, see ChangePointMask.h) and return a mask
+// view over them. voice_index selects per-voice change points for
+// polyphonic targets (0 = mono/default). Handle types are resolved as for
+// collect_change_points() below.
+//
+// out_words must hold change_point_words(samples_per_block) words; bits for
+// samples beyond out_words are dropped. The result can be handed straight to
+// BaseProcessor::process_modulated() without materialising an index list.
+// O(H * block_size / 64).
+template <typename Handle>
+dsp::utils::ChangePointMask collect_change_point_mask(std::span<const Handle> handles,
+                                                      std::span<uint64_t> out_words,
+                                                      uint32_t voice_index = 0)
+    TANH_NONBLOCKING_FUNCTION {
+    std::fill(out_words.begin(), out_words.end(), uint64_t{0});
+    size_t num_samples = 0;
+    for (const auto& h : handles) {
+        dsp::utils::ChangePointMask masks[2];
+        detail::target_change_point_masks(h, voice_index, masks[0], masks[1]);
+        for (const auto& mask : masks) {
+            const size_t n = std::min(mask.m_words.size(), out_words.size());
+            for (size_t w = 0; w < n; ++w) { out_words[w] |= mask.m_words[w]; }
+            num_samples = std::max(num_samples, mask.m_num_samples);
+        }
+    }
+    num_samples =
+        std::min(num_samples, out_words.size() * dsp::utils::k_change_point_word_bits);
+    return {out_words.first(dsp::utils::change_point_words(num_samples)), num_samples};
+}
+
 // Free utility: collect change points from a span of handles.
 // Writes a sorted, deduplicated list of change points into target_buffer.
 // voice_index selects per-voice change points for polyphonic targets (0 = mono/default).
@@ -362,93 +659,42 @@ ResolvedTarget* handle_target(const H& h) TANH_NONBLOCKING_FUNCTION {
 //   the buffer once at prepare() time, e.g.:
 //     m_change_points.reserve(samples_per_block);
 //
-// Uses target_buffer's pre-reserved memory as a bitset for O(1) dedup and
-// inherently sorted output. No stack allocation, no block size limit.
-// O(H*C + block_size/32) instead of the naive O(H*C*M).
-//
-// Layout within target_buffer (capacity N, W = ceil(N/32) bitset words):
-//   [ output indices ...          | bitset words at N-W .. N-1 ]
-// The bitset is placed at the high end. During extraction the write pointer
-// advances at most 32× faster than the read pointer, but the W-word bitset
-// starts N-W positions ahead of position 0, giving exactly enough headroom
-// (32·W ≤ N for any N ≥ 32, and W = ceil(N/32)).
+// Reads the targets' packed change-point bitsets directly: each 64-sample
+// word is OR-merged across handles and expanded with a ctz walk, so the
+// output is inherently sorted and deduplicated and no scratch space is
+// needed. O(H * block_size / 64 + C).
 template <typename Handle>
 void collect_change_points(std::span<const Handle> handles,
                            std::vector<uint32_t>& target_buffer,
                            uint32_t voice_index = 0) TANH_NONBLOCKING_FUNCTION {
-    // First pass: find max index to determine bitset size.
-    // NOLINTNEXTLINE(misc-const-correctness) — mutated in the loop below.
-    uint32_t max_index = 0;
-    // NOLINTNEXTLINE(misc-const-correctness) — mutated in the loop below.
-    bool has_any = false;
-
+    size_t num_words = 0;
     for (const auto& h : handles) {
-        auto* t = detail::handle_target(h);
-        if (!t) { continue; }
-        if (auto* mb = t->m_mono.load(std::memory_order_acquire)) {
-            for (const uint32_t v : mb->m_change_points) {
-                if (v > max_index) { max_index = v; }
-                has_any = true;
-            }
-        }
-        if (auto* vb = t->m_voice.load(std::memory_order_acquire)) {
-            // m_change_points is sized to m_num_voices only when the buffer
-            // actually carries modulation (either flag set); an all-flags-
-            // clear VoiceBuffers leaves it empty and indexing would be OOB.
-            if ((vb->m_has_additive || vb->m_has_replace) && voice_index < vb->m_num_voices) {
-                for (const uint32_t v : vb->m_change_points[voice_index]) {
-                    if (v > max_index) { max_index = v; }
-                    has_any = true;
-                }
-            }
-        }
-    }
-
-    if (!has_any) {
-        target_buffer.resize(0);
-        return;
+        dsp::utils::ChangePointMask mono, voice;
+        detail::target_change_point_masks(h, voice_index, mono, voice);
+        num_words = std::max({num_words, mono.m_words.size(), voice.m_words.size()});
     }
 
-    const size_t count = static_cast<size_t>(max_index) + 1;
-    const size_t words_needed = (count + 31) / 32;
-    assert(count <= target_buffer.capacity() &&
-           "collect_change_points: target_buffer capacity too small — "
-           "reserve at least samples_per_block before calling");
-
-    // Resize to cover the full range. Bitset goes at [count - words_needed, count).
-    target_buffer.resize(count);
-    const size_t bitset_base = count - words_needed;
-    std::memset(&target_buffer[bitset_base], 0, words_needed * sizeof(uint32_t));
-
-    // Second pass: set bits in the high-end bitset region.
-    for (const auto& h : handles) {
-        auto* t = detail::handle_target(h);
-        if (!t) { continue; }
-        if (auto* mb = t->m_mono.load(std::memory_order_acquire)) {
-            for (const uint32_t v : mb->m_change_points) {
-                target_buffer[bitset_base + v / 32] |= uint32_t{1} << (v % 32);
-            }
-        }
-        if (auto* vb = t->m_voice.load(std::memory_order_acquire)) {
-            if ((vb->m_has_additive || vb->m_has_replace) && voice_index < vb->m_num_voices) {
-                for (const uint32_t v : vb->m_change_points[voice_index]) {
-                    target_buffer[bitset_base + v / 32] |= uint32_t{1} << (v % 32);
-                }
-            }
-        }
-    }
+    // Every emitted index is < 64 * num_words, and the output is written in
+    // ascending order, so sizing to the covered sample range is enough.
+    const size_t capacity =
+        std::min(num_words * dsp::utils::k_change_point_word_bits, target_buffer.capacity());
+    target_buffer.resize(capacity);  // trivial type within capacity — no allocation
 
-    // Extraction: read from bitset at the high end, write indices to the low end.
-    // The write pointer never overtakes the read pointer because the bitset
-    // starts count-W positions ahead, and each word produces at most 32 entries.
     size_t write = 0;
-    for (size_t w = 0; w < words_needed; ++w) {
-        const auto word = target_buffer[bitset_base + w];
-        auto bits = word;
-        while (bits != 0) {
-            const int bit = std::countr_zero(bits);
-            target_buffer[write++] = static_cast<uint32_t>(w * 32 + bit);
-            bits &= bits - 1;  // clear lowest set bit
+    for (size_t w = 0; w < num_words; ++w) {
+        uint64_t bits = 0;
+        for (const auto& h : handles) {
+            dsp::utils::ChangePointMask mono, voice;
+            detail::target_change_point_masks(h, voice_index, mono, voice);
+            if (w < mono.m_words.size()) { bits |= mono.m_words[w]; }
+            if (w < voice.m_words.size()) { bits |= voice.m_words[w]; }
+        }
+        for (; bits != 0; bits &= bits - 1) {
+            assert(write < target_buffer.size() &&
+                   "collect_change_points: target_buffer capacity too small — "
+                   "reserve at least samples_per_block before calling");
+            target_buffer[write++] = static_cast<uint32_t>(
+                w * dsp::utils::k_change_point_word_bits + std::countr_zero(bits));
         }
     }
     target_buffer.resize(write);  // shrink only — trivial type, no allocation
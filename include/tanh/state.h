@@ -2,3 +2,5 @@
 
 // Include the main State header
 #include "state/State.h"
+#include "state/BinarySnapshot.h"
+#include "state/PresetMorpher.h"
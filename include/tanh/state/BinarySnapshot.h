@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "tanh/core/Exports.h"
+
+/// @file BinarySnapshot.h
+/// @brief Binary preset snapshots for State and ModulationMatrix.
+///
+/// A compact alternative to to_json()/from_json() for loading many presets:
+/// fixed-size, 8-byte aligned entries keyed by parameter ID, applied straight
+/// from the buffer — which may be a memory-mapped file — without building a
+/// document first. All integers are little-endian; offsets are relative to
+/// the start of the blob.
+///
+/// @code
+/// State blob ("THLSTATE"):
+///   header:  char[8] magic  u32 version  u32 header_size  u32 num_parameters
+///            u32 string_bytes  u32 entry_size  u32 reserved
+///   entry:   u32 id  u8 type  u8[3] reserved  u64 payload
+///   strings: string_bytes of string parameter values
+///
+/// ModulationMatrix blob ("THLMODMX"):
+///   header:  char[8] magic  u32 version  u32 header_size  u32 num_routings
+///            u32 string_bytes  u32 routing_size  u32 state_bytes
+///   routing: u32 id  u32 source_offset  u32 source_size  u32 target_offset
+///            u32 target_size  f32 depth  u32 max_decimation
+///            u32 replace_priority  u32 replace_hold_priority
+///            f32 replace_range_min  f32 replace_range_max
+///            u8 depth_mode  u8 combine_mode  u8 flags  u8 reserved
+///   strings: string_bytes of source and target IDs
+///   state:   a State blob of state_bytes, 8-byte aligned (absent if 0)
+/// @endcode
+///
+/// The payload holds the value in the parameter's own type: the double's
+/// bits, or a float / int32 / bool in its low bytes; for strings the low
+/// word is the offset into the string table and the high word the size.
+/// Readers step through entries by the header's entry_size, so later
+/// versions can append fields.
+namespace thl {
+
+/**
+ * @class SnapshotFormatException
+ * @brief Thrown when a binary snapshot is truncated, has the wrong magic, or
+ * has an unsupported version.
+ */
+class TANH_API SnapshotFormatException : public std::runtime_error {
+public:
+    explicit SnapshotFormatException(const std::string& what)
+        : std::runtime_error("Invalid binary snapshot: " + what) {}
+};
+
+namespace detail {
+
+constexpr uint32_t k_snapshot_version = 1;
+constexpr size_t k_snapshot_header_size = 32;
+constexpr std::array<char, 8> k_state_snapshot_magic = {'T', 'H', 'L', 'S', 'T', 'A', 'T', 'E'};
+constexpr std::array<char, 8> k_matrix_snapshot_magic = {'T', 'H', 'L', 'M', 'O', 'D', 'M', 'X'};
+constexpr size_t k_state_snapshot_entry_size = 16;
+constexpr size_t k_matrix_snapshot_routing_size = 48;
+
+constexpr size_t snapshot_align(size_t size) {
+    return (size + 7) & ~size_t{7};
+}
+
+// Appends fields to a preallocated snapshot; every supported target is
+// little-endian, so memcpy is the encoding
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::vector<std::byte>& out) : m_out(out) {}
+
+    template <typename T>
+    void put(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        put_bytes(&value, sizeof(T));
+    }
+
+    void put_bytes(const void* data, size_t size) {
+        const size_t offset = m_out.size();
+        m_out.resize(offset + size);
+        if (size > 0) { std::memcpy(m_out.data() + offset, data, size); }
+    }
+
+    void pad_to_alignment() { m_out.resize(snapshot_align(m_out.size())); }
+
+    size_t size() const { return m_out.size(); }
+
+private:
+    std::vector<std::byte>& m_out;
+};
+
+// Bounds-checked field access into a snapshot
+class SnapshotReader {
+public:
+    explicit SnapshotReader(std::span<const std::byte> data) : m_data(data) {}
+
+    template <typename T>
+    T get(size_t offset) const {
+        static_assert(std::is_trivially_copyable_v<T>);
+        require(offset, sizeof(T));
+        T value;
+        std::memcpy(&value, m_data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    std::string_view get_string(size_t offset, size_t size) const {
+        require(offset, size);
+        return {reinterpret_cast<const char*>(m_data.data()) + offset, size};
+    }
+
+    std::span<const std::byte> subspan(size_t offset, size_t size) const {
+        require(offset, size);
+        return m_data.subspan(offset, size);
+    }
+
+    void require(size_t offset, size_t size) const {
+        if (offset > m_data.size() || size > m_data.size() - offset) {
+            throw SnapshotFormatException("truncated");
+        }
+    }
+
+    /// Checks magic and version; returns the header size to skip.
+    size_t check_header(const std::array<char, 8>& magic) const {
+        require(0, k_snapshot_header_size);
+        if (std::memcmp(m_data.data(), magic.data(), magic.size()) != 0) {
+            throw SnapshotFormatException("bad magic");
+        }
+        if (get<uint32_t>(8) != k_snapshot_version) {
+            throw SnapshotFormatException("unsupported version " +
+                                          std::to_string(get<uint32_t>(8)));
+        }
+        const auto header_size = get<uint32_t>(12);
+        if (header_size < k_snapshot_header_size) { throw SnapshotFormatException("bad header"); }
+        return header_size;
+    }
+
+private:
+    std::span<const std::byte> m_data;
+};
+
+}  // namespace detail
+
+}  // namespace thl
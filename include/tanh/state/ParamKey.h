@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace thl {
+
+namespace detail {
+
+constexpr uint64_t k_fnv1a_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t k_fnv1a_prime = 1099511628211ULL;
+
+// 64-bit FNV-1a over the bytes of @p text
+constexpr uint64_t fnv1a_64(std::string_view text, uint64_t hash = k_fnv1a_offset_basis) noexcept {
+    for (const char c : text) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= k_fnv1a_prime;
+    }
+    return hash;
+}
+
+}  // namespace detail
+
+/**
+ * @class ParamKey
+ * @brief Dot-separated parameter path with its hash computed at compile time.
+ *
+ * Lookups through a ParamKey go to State's hash index instead of the string
+ * index: no hashing at run time, no allocation, and a single open-addressing
+ * probe sequence. Paths are relative to the root State.
+ *
+ * @code
+ * constexpr ParamKey k_cutoff("synth.filter.cutoff");
+ * float cutoff = state.get_from_root<float>(k_cutoff);
+ * @endcode
+ *
+ * A ParamKey only views its path. Literals live forever; a key built with
+ * from_runtime() must not outlive the string it was built from.
+ */
+class ParamKey {
+public:
+    template <size_t N>
+    explicit consteval ParamKey(const char (&path)[N]) noexcept
+        : ParamKey(std::string_view(path, N - 1)) {}
+
+    /// Key for a path only known at run time; hashes it on the spot.
+    static constexpr ParamKey from_runtime(std::string_view path) noexcept {
+        return ParamKey(path);
+    }
+
+    constexpr std::string_view path() const noexcept { return m_path; }
+    constexpr uint64_t hash() const noexcept { return m_hash; }
+
+    friend constexpr bool operator==(const ParamKey& a, const ParamKey& b) noexcept {
+        return a.m_hash == b.m_hash && a.m_path == b.m_path;
+    }
+
+private:
+    constexpr explicit ParamKey(std::string_view path) noexcept
+        : m_path(path), m_hash(detail::fnv1a_64(path)) {}
+
+    std::string_view m_path;
+    uint64_t m_hash;
+};
+
+}  // namespace thl
@@ -16,45 +16,36 @@ class State;
 class StateGroup;
 
 /**
- * @brief Atomic cache entry for real-time safe per-sample parameter access.
+ * @brief Where a parameter's value lives, for real-time safe per-sample access.
  *
- * Each parameter gets one AtomicCacheEntry, embedded in the owning
- * ParameterRecord. This is the single source of truth for numeric values.
- * ParameterHandle<T> accesses this entry via ParameterRecord*.
- * The entry's address is stable (std::map pointer stability) until
- * State::clear() or State destruction.
- *
- * Only the native-type atomic (matching ParameterRecord::m_def.m_type) is
- * written on set. Reads convert on the fly from the native atomic.
- *
- * @note Non-copyable, non-movable — always accessed via pointer.
+ * Each ParameterRecord holds one AtomicCacheEntry pointing at the
+ * parameter's slot in State's ParameterValueStore — the single source of
+ * truth for numeric values. Only the native-type pointer (matching
+ * ParameterRecord::m_def.m_type; m_atomic_double for String) is set, and
+ * reads convert on the fly from that atomic. The slot's address is stable
+ * until State::clear() or State destruction.
  */
 struct AtomicCacheEntry {
-    std::atomic<double> m_atomic_double{0.0};
-    std::atomic<float> m_atomic_float{0.0f};
-    std::atomic<int> m_atomic_int{0};
-    std::atomic<bool> m_atomic_bool{false};
-
-    AtomicCacheEntry() = default;
-    AtomicCacheEntry(const AtomicCacheEntry&) = delete;
-    AtomicCacheEntry& operator=(const AtomicCacheEntry&) = delete;
+    std::atomic<double>* m_atomic_double = nullptr;
+    std::atomic<float>* m_atomic_float = nullptr;
+    std::atomic<int>* m_atomic_int = nullptr;
+    std::atomic<bool>* m_atomic_bool = nullptr;
 };
 
 /**
- * @brief Consolidated per-parameter storage.
+ * @brief Consolidated per-parameter metadata.
  *
  * Each parameter gets one heap-allocated ParameterRecord, owned by
  * State::m_storage via unique_ptr. The record holds everything about the
- * parameter: immutable definition (type, range, flags, name, etc.),
- * atomic cache for real-time value access, gesture state, and string value.
+ * parameter: immutable definition (type, range, flags, name, etc.), where
+ * its value lives, gesture state, and string value.
  *
- * @section layout Cache-Line Layout
+ * @section layout Layout
  *
- * Fields are ordered for cache efficiency. `m_cache` is at offset 0 so
- * that ParameterHandle::load() touches the first cache line of the
- * allocation. `alignas(64)` on `m_def` guarantees the hot cache line
- * contains only `m_cache` (24 B), isolating it from non-RT writes to
- * `m_in_gesture` / `m_string_value` (false-sharing prevention).
+ * Numeric values live outside the record, in State's dense
+ * ParameterValueStore; `m_cache` (at offset 0) only points there and is
+ * never written after creation. Value writes therefore never touch the
+ * record's cache lines, and ParameterHandle skips the record entirely.
  *
  * `m_key` is a string_view pointing into the owning std::map node's key.
  * Set once after map insertion, never modified. Zero-cost, no duplication.
@@ -63,21 +54,22 @@ struct AtomicCacheEntry {
  * RCU publish in create() provides the happens-before guarantee — readers
  * only see the record after `m_key` and `m_def` are fully initialized.
  *
- * Because AtomicCacheEntry is non-copyable/non-movable the record itself
- * is non-copyable/non-movable — always accessed via pointer.
+ * The record is non-copyable/non-movable — always accessed via pointer.
  */
 struct ParameterRecord {
-    /// RT-hot: per-sample lock-free access (offset 0 for single cache line fetch)
+    /// Value slot in State's ParameterValueStore (set once at creation)
     AtomicCacheEntry m_cache;
 
     /// Immutable definition (type, range, flags, name, etc.)
-    /// alignas(64) ensures m_cache occupies its own cache line.
-    alignas(64) const ParameterDefinition m_def;
+    const ParameterDefinition m_def;
 
     /// Identity (set once after map insertion, never modified)
     std::string_view m_key;
 
-    /// Mutable runtime state (non-RT only, separate cache line from m_cache)
+    /// Bit in State's dirty set for deferred notifications (set once at creation)
+    uint32_t m_notify_index = UINT32_MAX;
+
+    /// Mutable runtime state (non-RT only)
     std::atomic<bool> m_in_gesture{false};
     std::string m_string_value;  // mutex-protected for String-typed parameters
 
@@ -94,9 +86,9 @@ struct ParameterRecord {
  * bypassing the RCU path entirely. Only supports numeric types (double, float,
  * int, bool).
  *
- * Stores a ParameterRecord* internally, giving access to both the atomic cache
- * and immutable metadata (definition, range, key, ID, flags) without any
- * additional lookups.
+ * Points straight at the value's slot in State's dense ParameterValueStore,
+ * and keeps the ParameterRecord* for immutable metadata (definition, range,
+ * key, ID, flags) without any additional lookups.
  *
  * @section lifetime Handle Lifetime
  *
@@ -130,28 +122,10 @@ class ParameterHandle {
 public:
     ParameterHandle() = default;
 
-    T load() const TANH_NONBLOCKING_FUNCTION {
-        if constexpr (std::is_same_v<T, double>) {
-            return m_record->m_cache.m_atomic_double.load(std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, float>) {
-            return m_record->m_cache.m_atomic_float.load(std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, int>) {
-            return m_record->m_cache.m_atomic_int.load(std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, bool>) {
-            return m_record->m_cache.m_atomic_bool.load(std::memory_order_relaxed);
-        }
-    }
+    T load() const TANH_NONBLOCKING_FUNCTION { return m_value->load(std::memory_order_relaxed); }
 
     void store(T value) TANH_NONBLOCKING_FUNCTION {
-        if constexpr (std::is_same_v<T, double>) {
-            m_record->m_cache.m_atomic_double.store(value, std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, float>) {
-            m_record->m_cache.m_atomic_float.store(value, std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, int>) {
-            m_record->m_cache.m_atomic_int.store(value, std::memory_order_relaxed);
-        } else if constexpr (std::is_same_v<T, bool>) {
-            m_record->m_cache.m_atomic_bool.store(value, std::memory_order_relaxed);
-        }
+        m_value->store(value, std::memory_order_relaxed);
     }
 
     [[nodiscard]] bool is_valid() const TANH_NONBLOCKING_FUNCTION { return m_record != nullptr; }
@@ -175,9 +149,23 @@ private:
     friend class State;
     friend class Parameter;
     explicit ParameterHandle(ParameterRecord* record)
-        : m_record(record), m_range(&record->m_def.m_range) {}
+        : m_record(record), m_range(&record->m_def.m_range), m_value(native_slot(record->m_cache)) {}
+
+    static std::atomic<T>* native_slot(const AtomicCacheEntry& cache) {
+        if constexpr (std::is_same_v<T, double>) {
+            return cache.m_atomic_double;
+        } else if constexpr (std::is_same_v<T, float>) {
+            return cache.m_atomic_float;
+        } else if constexpr (std::is_same_v<T, int>) {
+            return cache.m_atomic_int;
+        } else {
+            return cache.m_atomic_bool;
+        }
+    }
+
     ParameterRecord* m_record = nullptr;
     const Range* m_range = nullptr;
+    std::atomic<T>* m_value = nullptr;
 };
 
 /**
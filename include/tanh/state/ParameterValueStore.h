@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Parameter.h"
+#include "ParameterDefinitions.h"
+#include "tanh/utils/RealtimeSanitizer.h"
+
+namespace thl {
+
+/**
+ * @brief Dense, type-segregated storage for numeric parameter values.
+ *
+ * One column per native type — double, float, int and bool — so the values
+ * a processor reads every block sit next to each other instead of one per
+ * ParameterRecord allocation. String parameters keep their parsed double in
+ * the double column.
+ *
+ * Each record owns one slot in its type's column, and its AtomicCacheEntry
+ * (and every ParameterHandle) points straight at the slot's atomic. Slots
+ * live in fixed-size chunks that are never moved or freed before the store,
+ * so those pointers stay valid while columns grow. Each slot also carries
+ * its parameter ID, so bulk readers sweep a column front to back.
+ *
+ * Slots are allocated and released under State's storage mutex; value
+ * access and for_each() are lock-free. A slot's initial value is written
+ * before its ID is published, so for_each() never pairs a new parameter's
+ * ID with the value a reused slot held before.
+ */
+class ParameterValueStore {
+public:
+    template <typename T>
+    class Column {
+    public:
+        static constexpr size_t k_chunk_size = 1024;
+        static constexpr size_t k_max_chunks = 256;
+        static constexpr uint32_t k_no_id = UINT32_MAX;
+
+        std::atomic<T>* allocate(uint32_t id, T initial_value) {
+            uint32_t index = 0;
+            if (!m_free_slots.empty()) {
+                index = m_free_slots.back();
+                m_free_slots.pop_back();
+            } else {
+                index = m_size.load(std::memory_order_relaxed);
+                if (index >= k_max_chunks * k_chunk_size) {
+                    throw std::length_error("Too many parameters of one type in State");
+                }
+                auto& chunk = m_chunks[index / k_chunk_size];
+                if (!chunk) { chunk = std::make_unique<Chunk>(); }
+            }
+            Chunk& chunk = *m_chunks[index / k_chunk_size];
+            chunk.m_values[index % k_chunk_size].store(initial_value, std::memory_order_relaxed);
+            // Release publishes the value along with the ID
+            chunk.m_ids[index % k_chunk_size].store(id, std::memory_order_release);
+            // Release publishes the new chunk to for_each()
+            if (index == m_size.load(std::memory_order_relaxed)) {
+                m_size.store(index + 1, std::memory_order_release);
+            }
+            return &chunk.m_values[index % k_chunk_size];
+        }
+
+        void release(const std::atomic<T>* slot) {
+            const size_t num_chunks = (m_size.load(std::memory_order_relaxed) + k_chunk_size - 1) /
+                                      k_chunk_size;
+            for (size_t c = 0; c < num_chunks; ++c) {
+                const auto* values = m_chunks[c]->m_values.data();
+                if (slot < values || slot >= values + k_chunk_size) { continue; }
+                const auto offset = static_cast<size_t>(slot - values);
+                m_chunks[c]->m_ids[offset].store(k_no_id, std::memory_order_relaxed);
+                m_free_slots.push_back(static_cast<uint32_t>(c * k_chunk_size + offset));
+                return;
+            }
+        }
+
+        /// Free every slot; the chunks stay allocated.
+        void clear() {
+            m_size.store(0, std::memory_order_release);
+            m_free_slots.clear();
+        }
+
+        /// Call @p func(id, value) for every live slot, in slot order.
+        template <typename Func>
+        void for_each(Func&& func) const TANH_NONBLOCKING_FUNCTION {
+            const uint32_t size = m_size.load(std::memory_order_acquire);
+            for (uint32_t base = 0; base < size; base += k_chunk_size) {
+                const Chunk& chunk = *m_chunks[base / k_chunk_size];
+                const uint32_t end = std::min<uint32_t>(size - base, k_chunk_size);
+                for (uint32_t i = 0; i < end; ++i) {
+                    const uint32_t id = chunk.m_ids[i].load(std::memory_order_acquire);
+                    if (id == k_no_id) { continue; }
+                    func(id, chunk.m_values[i].load(std::memory_order_relaxed));
+                }
+            }
+        }
+
+        /// Bytes held by allocated chunks.
+        size_t memory_bytes() const {
+            size_t bytes = 0;
+            for (const auto& chunk : m_chunks) { bytes += chunk ? sizeof(Chunk) : 0; }
+            return bytes;
+        }
+
+    private:
+        struct Chunk {
+            std::array<std::atomic<T>, k_chunk_size> m_values{};
+            std::array<std::atomic<uint32_t>, k_chunk_size> m_ids{};
+        };
+
+        std::array<std::unique_ptr<Chunk>, k_max_chunks> m_chunks;
+        std::atomic<uint32_t> m_size{0};  // slots ever handed out
+        std::vector<uint32_t> m_free_slots;
+    };
+
+    /// Give @p record a slot in its native type's column, holding the
+    /// definition's default value (0.0 for string parameters).
+    void allocate(ParameterRecord& record) {
+        const uint32_t id = record.m_def.m_id;
+        const float default_value = record.m_def.m_default_value;
+        auto& cache = record.m_cache;
+        switch (record.m_def.m_type) {
+            case ParameterType::Float:
+                cache.m_atomic_float = m_floats.allocate(id, default_value);
+                break;
+            case ParameterType::Int:
+                cache.m_atomic_int = m_ints.allocate(id, static_cast<int>(default_value));
+                break;
+            case ParameterType::Bool:
+                cache.m_atomic_bool = m_bools.allocate(id, default_value != 0.0f);
+                break;
+            case ParameterType::Double:
+                cache.m_atomic_double = m_doubles.allocate(id, static_cast<double>(default_value));
+                break;
+            case ParameterType::String: cache.m_atomic_double = m_doubles.allocate(id, 0.0); break;
+        }
+    }
+
+    /// Return @p record's slot for reuse.
+    void release(const ParameterRecord& record) {
+        const auto& cache = record.m_cache;
+        if (cache.m_atomic_double != nullptr) { m_doubles.release(cache.m_atomic_double); }
+        if (cache.m_atomic_float != nullptr) { m_floats.release(cache.m_atomic_float); }
+        if (cache.m_atomic_int != nullptr) { m_ints.release(cache.m_atomic_int); }
+        if (cache.m_atomic_bool != nullptr) { m_bools.release(cache.m_atomic_bool); }
+    }
+
+    void clear() {
+        m_doubles.clear();
+        m_floats.clear();
+        m_ints.clear();
+        m_bools.clear();
+    }
+
+    /// Bytes held by every column.
+    size_t memory_bytes() const {
+        return m_doubles.memory_bytes() + m_floats.memory_bytes() + m_ints.memory_bytes() +
+               m_bools.memory_bytes();
+    }
+
+    const Column<double>& doubles() const { return m_doubles; }
+    const Column<float>& floats() const { return m_floats; }
+    const Column<int>& ints() const { return m_ints; }
+    const Column<bool>& bools() const { return m_bools; }
+
+private:
+    Column<double> m_doubles;
+    Column<float> m_floats;
+    Column<int> m_ints;
+    Column<bool> m_bools;
+};
+
+}  // namespace thl
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "tanh/core/Exports.h"
+#include "tanh/state/ParameterDefinitions.h"
+#include "tanh/state/StateSnapshot.h"
+#include "tanh/utils/RealtimeSanitizer.h"
+
+namespace thl {
+
+class State;
+struct ParameterRecord;
+
+/**
+ * @class PresetMorpher
+ * @brief Plays StateSnapshots back into a State from the audio thread.
+ *
+ * prepare() binds the morpher to the State's numeric parameters once; after
+ * that apply() and morph() are a single pass over those parameters, writing
+ * each one's AtomicCacheEntry directly — no lookups, no locks, no
+ * allocation. Call them at the start of a block (or per sample) and the
+ * audio thread always reads one coherent preset instead of the mixture a
+ * series of set() calls leaves behind.
+ *
+ * Writes are silent like ParameterHandle::store(), except that in
+ * State::NotificationMode::Deferred every parameter whose value changed is
+ * marked pending, so the next State::dispatch_pending() reports it once.
+ *
+ * Int parameters take the rounded blend and bool parameters switch at the
+ * halfway point. Parameters missing from a snapshot are left alone.
+ *
+ * @code
+ * PresetMorpher morpher(state);
+ * morpher.prepare();                        // message thread
+ * morpher.morph(preset_a, preset_b, 0.25f); // audio thread
+ * @endcode
+ */
+class TANH_API PresetMorpher {
+public:
+    explicit PresetMorpher(State& state) : m_state(state) {}
+
+    /**
+     * @brief Binds to the State's current numeric parameters.
+     *
+     * The binding holds raw record pointers. Call again after creating
+     * parameters, and always after removing any. The only removal paths
+     * are State::clear() and StateGroup::clear() (which also clears every
+     * subgroup); both destroy records and hand their value slots to the
+     * next parameters created, so a stale binding would write into a
+     * different parameter. apply() and morph() check is_stale() first and
+     * write nothing, returning false, when the binding is stale.
+     *
+     * @warning NOT real-time safe - acquires the storage mutex and allocates
+     */
+    void prepare();
+
+    /// Write every bound parameter @p snapshot holds a value for. False,
+    /// writing nothing, if the binding is stale.
+    bool apply(const StateSnapshot& snapshot) TANH_NONBLOCKING_FUNCTION;
+
+    /// Write (1 - t) * a + t * b to every bound parameter both snapshots
+    /// hold. False, writing nothing, if the binding is stale.
+    bool morph(const StateSnapshot& a, const StateSnapshot& b, float t) TANH_NONBLOCKING_FUNCTION;
+
+    /**
+     * @brief Write the weighted average of several snapshots.
+     *
+     * Weights are normalized by their sum; nothing is written if the sum is
+     * not positive. Only parameters every snapshot holds are written.
+     *
+     * @param snapshots Snapshots to blend
+     * @param weights One weight per snapshot
+     * @return False, writing nothing, if the binding is stale
+     */
+    bool morph(std::span<const StateSnapshot* const> snapshots,
+               std::span<const float> weights) TANH_NONBLOCKING_FUNCTION;
+
+    /// True if parameters were removed since prepare(); apply() and morph()
+    /// then refuse to write until prepare() runs again.
+    [[nodiscard]] bool is_stale() const TANH_NONBLOCKING_FUNCTION;
+
+    /// Number of bound parameters.
+    [[nodiscard]] size_t num_parameters() const { return m_targets.size(); }
+
+private:
+    struct Target {
+        ParameterRecord* m_record;
+        uint32_t m_id;
+        ParameterType m_type;
+    };
+
+    // Returns true if the stored value changed
+    static bool write(const Target& target, double value) TANH_NONBLOCKING_FUNCTION;
+
+    bool deferred() const TANH_NONBLOCKING_FUNCTION;
+    void mark_pending(const Target& target) TANH_NONBLOCKING_FUNCTION;
+
+    State& m_state;
+    std::vector<Target> m_targets;  // sorted by ID
+    uint64_t m_generation = 0;      // State's removal generation at prepare()
+};
+
+}  // namespace thl
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <span>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "ParamKey.h"
+#include "ParameterValueStore.h"
 #include "StateGroup.h"
+#include "StateSnapshot.h"
+#include "tanh/core/PersistentHashMap.h"
 #include "tanh/utils/RealtimeSanitizer.h"
 
 namespace thl::modulation {
@@ -122,6 +133,25 @@ public:
      */
     void set_in_root(std::string_view key, const char* value, ParameterListener* source = nullptr);
 
+    /**
+     * @brief Sets a parameter value through its precomputed key.
+     *
+     * Same as set_in_root(std::string_view, ...), but the record is found in
+     * the hash index without hashing or allocating.
+     *
+     * @throws StateKeyNotFoundException if the key doesn't exist
+     *
+     * @warning NOT real-time safe for string types
+     */
+    template <typename T>
+    void set_in_root(ParamKey key, const T& value, ParameterListener* source = nullptr);
+
+    /**
+     * @brief Sets a string parameter from a C-string.
+     * @copydetails set_in_root(ParamKey, const T&, ParameterListener*)
+     */
+    void set_in_root(ParamKey key, const char* value, ParameterListener* source = nullptr);
+
     // ── Parameter access (key-based) ──────────────────────────────────────
 
     /**
@@ -141,6 +171,21 @@ public:
     T get_from_root(std::string_view key,
                     bool allow_blocking = false) const TANH_NONBLOCKING_FUNCTION;
 
+    /**
+     * @brief Gets a parameter value through its precomputed key.
+     *
+     * @tparam T Return type (double, float, int, bool, or std::string)
+     * @param key The parameter key
+     * @param allow_blocking If true, disables real-time sanitizer checks
+     *
+     * @throws StateKeyNotFoundException if the key doesn't exist
+     *
+     * @note **REAL-TIME SAFE** for numeric types (double, float, int, bool),
+     *       from any thread — no hashing, allocation, or RCU registration
+     */
+    template <typename T>
+    T get_from_root(ParamKey key, bool allow_blocking = false) const TANH_NONBLOCKING_FUNCTION;
+
     /**
      * @brief Gets a Parameter object for the specified key.
      *
@@ -263,6 +308,49 @@ public:
      */
     void set_gesture_from_root(std::string_view key, bool gesture);
 
+    // ── Notification mode ────────────────────────────────────────────────
+
+    /// How writes through set(), set_in_root() and set_by_id() reach listeners.
+    enum class NotificationMode : uint8_t {
+        Immediate,  ///< Listeners run synchronously on the writing thread
+        Deferred,   ///< Writes mark the parameter dirty; dispatch_pending() notifies
+    };
+
+    /**
+     * @brief Selects how value writes notify listeners.
+     *
+     * In Deferred mode a write only sets the parameter's bit in a lock-free
+     * dirty set — one atomic OR, no allocation, no listener code — so the
+     * audio thread and automation threads can write with listeners attached.
+     * dispatch_pending() then delivers one callback per dirty parameter, no
+     * matter how often it was written in between.
+     *
+     * Deferred callbacks carry no source: a source whose strategy is None
+     * still suppresses the notification, but Others and Self cannot be
+     * applied to a coalesced change. Parameter creation always notifies
+     * immediately. Switching back to Immediate dispatches what is pending.
+     *
+     * @warning NOT real-time safe
+     */
+    void set_notification_mode(NotificationMode mode);
+
+    NotificationMode get_notification_mode() const {
+        return m_notification_mode.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Delivers one coalesced notification per parameter written since
+     * the last call.
+     *
+     * Call from a UI timer or a dedicated consumer thread; calls are
+     * serialized. Listeners run on the calling thread and may write
+     * parameters — those writes are picked up by the next call.
+     *
+     * @return Number of parameters notified
+     * @warning NOT real-time safe - invokes listener callbacks
+     */
+    size_t dispatch_pending();
+
     // ── Serialization ────────────────────────────────────────────────────
 
     /**
@@ -302,6 +390,114 @@ public:
     nlohmann::json group_to_json(std::string_view group_prefix,
                                  bool include_definitions = true) const;
 
+    /**
+     * @brief Serializes every parameter value into a binary snapshot.
+     *
+     * One fixed-size entry per parameter, keyed by its ID — see
+     * BinarySnapshot.h for the layout. Definitions are not included.
+     *
+     * @return The snapshot bytes
+     *
+     * @warning NOT real-time safe - allocates the returned buffer
+     */
+    std::vector<std::byte> to_binary() const;
+
+    /**
+     * @brief Applies a binary snapshot produced by to_binary().
+     *
+     * Values are read straight from @p data, which may be a memory-mapped
+     * file, and written by ID with the same notifications as set_by_id().
+     * Parameters not in the snapshot keep their values; nothing is written
+     * unless every entry is valid.
+     *
+     * @param data The snapshot bytes
+     * @param source Source listener for strategy-based notification filtering
+     *
+     * @throws SnapshotFormatException if @p data is not a valid snapshot
+     * @throws StateKeyNotFoundException if a snapshot ID does not exist
+     *
+     * @warning NOT real-time safe - allocates for string parameters
+     */
+    void from_binary(std::span<const std::byte> data, ParameterListener* source = nullptr);
+
+    /**
+     * @brief Captures every numeric parameter value, indexed by ID.
+     *
+     * The result is what PresetMorpher plays back on the audio thread.
+     * String parameters are skipped.
+     *
+     * @return Snapshot of the current values
+     *
+     * @warning NOT real-time safe - acquires the storage mutex and allocates
+     */
+    StateSnapshot capture_snapshot() const;
+
+    /**
+     * @brief Copies every numeric parameter value into @p values, as float,
+     * at index = parameter ID.
+     *
+     * Sweeps the dense value store column by column, so reading a block's
+     * worth of parameters costs a few contiguous cache lines rather than
+     * one per parameter. IDs at or past values.size() are skipped, and
+     * entries without a parameter are left untouched. String parameters
+     * contribute their parsed number.
+     *
+     * @param values Destination indexed by parameter ID
+     *
+     * @note **REAL-TIME SAFE** — lock-free, no allocation
+     */
+    void snapshot_values(std::span<float> values) const TANH_NONBLOCKING_FUNCTION;
+
+    /// @brief Bytes held by the dense value store.
+    size_t value_store_bytes() const;
+
+    // ── Batched creation ─────────────────────────────────────────────────
+
+    /**
+     * @brief RAII write transaction returned by begin_batch().
+     *
+     * While a batch is open, creating a parameter still stores it and
+     * notifies listeners immediately, but the lock-free key and ID indices
+     * are published once, on commit(), with a single RCU update each instead
+     * of two per parameter. Until then the batched parameters are visible
+     * only to the thread that opened the batch, through a locked lookup;
+     * every other thread — the audio thread included — misses them without
+     * locking. Enumeration (get_parameters(), is_empty(), to_json()) sees
+     * them only after commit. Batches nest — only
+     * the outermost commit publishes. Destroying an uncommitted batch commits it.
+     *
+     * @code
+     * auto tx = state.begin_batch();
+     * for (const auto& [key, def] : patch) { state.create(key, def); }
+     * tx.commit();
+     * @endcode
+     */
+    class [[nodiscard]] Batch {
+    public:
+        Batch(Batch&& other) noexcept : m_state(std::exchange(other.m_state, nullptr)) {}
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+        Batch& operator=(Batch&&) = delete;
+        ~Batch() { commit(); }
+
+        /// @brief Publishes the batched parameters; no-op after the first call.
+        void commit() {
+            if (m_state != nullptr) { std::exchange(m_state, nullptr)->end_batch(); }
+        }
+
+    private:
+        friend class State;
+        explicit Batch(State* state) : m_state(state) {}
+        State* m_state;
+    };
+
+    /**
+     * @brief Opens a batch coalescing index publication for created parameters.
+     *
+     * @warning NOT real-time safe - acquires the storage mutex
+     */
+    Batch begin_batch();
+
     // ── State management ─────────────────────────────────────────────────
 
     void clear() override;
@@ -311,6 +507,7 @@ private:
     friend class Parameter;
     friend class StateGroup;
     friend class modulation::ModulationMatrix;
+    friend class PresetMorpher;
 
     static std::string& m_temp_buffer_0() noexcept {
         static thread_local std::string s;
@@ -335,27 +532,125 @@ private:
     StorageMap m_storage;
 
     /// @brief Mutex protecting m_storage insertions, erasures, and non-atomic field access
-    /// (string_value). Numeric reads/writes go through the embedded AtomicCacheEntry
+    /// (string_value). Numeric reads/writes go through the atomics in m_values
     /// and do NOT require this mutex.
     mutable std::mutex m_storage_mutex;
 
+    /// @brief Numeric values of every record, in dense per-type columns.
+    /// Slots are allocated and released under m_storage_mutex.
+    ParameterValueStore m_values;
+
+    /// @brief Bumped under m_storage_mutex whenever records are destroyed
+    /// (State::clear(), StateGroup::clear()), so holders of raw record
+    /// pointers such as PresetMorpher can tell theirs went stale.
+    std::atomic<uint64_t> m_removal_generation{0};
+
+    /// @brief Transparent string hash so the index can be searched by string_view.
+    struct StringIndexHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const noexcept {
+            return std::hash<std::string_view>{}(key);
+        }
+    };
+
     /// @brief Lock-free index into m_storage. Each entry is a raw pointer to the
-    /// corresponding ParameterRecord. Copied only when parameters are created or
-    /// destroyed (startup / clear), never during normal value writes.
-    using StringIndexMap = std::map<std::string, ParameterRecord*, std::less<>>;
+    /// corresponding ParameterRecord. Updated only when parameters are created or
+    /// destroyed (startup / clear), never during normal value writes. Persistent,
+    /// so each update path-copies O(log N) trie nodes instead of the whole index.
+    using StringIndexMap = PersistentHashMap<std::string, ParameterRecord*, StringIndexHash>;
     mutable RCU<StringIndexMap> m_string_index_rcu;
 
-    /// @brief Lock-free O(1) ID lookup — maps m_def.m_id → ParameterRecord*.
+    /**
+     * @brief Lock-free ParamKey lookup — maps ParamKey::hash() → ParameterRecord*.
+     *
+     * Open addressing with linear probing; an empty slot has a null record,
+     * an erased one (StateGroup::clear()) k_erased_key_record. Readers probe
+     * without RCU: a writer (holding m_storage_mutex) stores the hash, then
+     * releases the record, and readers confirm the record's path, so a slot
+     * reused for another key is never mistaken for a hit. Past half full,
+     * the live entries are rehashed into a new table, twice the size if they
+     * need it. Readers may still be probing the old table, so it stays in
+     * m_key_tables until the State is destroyed.
+     */
+    struct KeyHashTable {
+        struct Slot {
+            std::atomic<uint64_t> m_hash{0};
+            std::atomic<ParameterRecord*> m_record{nullptr};
+        };
+
+        explicit KeyHashTable(size_t capacity)
+            : m_slots(std::make_unique<Slot[]>(capacity)), m_mask(capacity - 1) {}
+
+        std::unique_ptr<Slot[]> m_slots;
+        size_t m_mask;
+    };
+    static constexpr size_t k_initial_key_table_capacity = 64;
+    inline static ParameterRecord* const k_erased_key_record =
+        reinterpret_cast<ParameterRecord*>(alignof(ParameterRecord));
+
+    std::atomic<const KeyHashTable*> m_key_table{nullptr};
+    std::vector<std::unique_ptr<KeyHashTable>> m_key_tables;  // live table last; m_storage_mutex
+    size_t m_num_keyed = 0;                                   // m_storage_mutex
+
+    /**
+     * @brief Dirty set for NotificationMode::Deferred — one bit per record,
+     * at ParameterRecord::m_notify_index.
+     *
+     * Chunks are allocated (under m_storage_mutex) before a record that
+     * needs them is published, and never freed before the State, so writers
+     * reach their word without locking. m_notify_records maps a bit back to
+     * its record for dispatch_pending(); indices of records removed by
+     * StateGroup::clear() are reused.
+     */
+    static constexpr size_t k_dirty_chunk_words = 64;
+    static constexpr size_t k_dirty_chunk_bits = k_dirty_chunk_words * 64;
+    static constexpr size_t k_max_dirty_chunks = 256;
+
+    struct DirtyChunk {
+        std::array<std::atomic<uint64_t>, k_dirty_chunk_words> m_words{};
+    };
+
+    std::atomic<NotificationMode> m_notification_mode{NotificationMode::Immediate};
+    std::array<std::unique_ptr<DirtyChunk>, k_max_dirty_chunks> m_dirty_chunks;
+    std::vector<ParameterRecord*> m_notify_records;  // m_storage_mutex
+    std::vector<uint32_t> m_free_notify_indices;     // m_storage_mutex
+
+    /// @brief Serializes dispatch_pending(); guards m_dispatch_batch.
+    std::mutex m_dispatch_mutex;
+    std::vector<ParameterRecord*> m_dispatch_batch;
+
+    /// @brief Lock-free ID lookup — maps m_def.m_id → ParameterRecord*.
     /// Populated automatically by create_in_root() for every parameter.
-    using IdIndexMap = std::unordered_map<uint32_t, ParameterRecord*>;
+    using IdIndexMap = PersistentHashMap<uint32_t, ParameterRecord*>;
     mutable RCU<IdIndexMap> m_id_index_rcu;
 
     size_t m_max_string_size;
     size_t m_max_levels;
     uint32_t m_next_auto_id = 0;
 
+    /// @brief Per RCUReaderSlot, the generation of the thread that last ran
+    /// ensure_thread_registered(). A registered thread returns after one
+    /// array load instead of a per-thread hash lookup.
+    std::array<std::atomic<uint64_t>, RCUReaderSlot::k_count> m_registered_slot_generations{};
+
+    /// @brief Open Batch levels and the records created inside them that are
+    /// not yet in the indices — all guarded by m_storage_mutex. m_batch_open
+    /// mirrors m_batch_depth > 0 and m_batch_owner is the thread that opened
+    /// the outermost batch: only that thread's index misses take the lock.
+    uint32_t m_batch_depth = 0;
+    std::vector<ParameterRecord*> m_batched_records;
+    std::unordered_map<uint32_t, ParameterRecord*> m_batched_ids;
+    std::atomic<bool> m_batch_open{false};
+    std::atomic<std::thread::id> m_batch_owner{};
+
+    bool sees_open_batch() const TANH_NONBLOCKING_FUNCTION;
+
     ParameterRecord* get_record(std::string_view key) const;
+    ParameterRecord* get_record(ParamKey key) const TANH_NONBLOCKING_FUNCTION;
+    void index_key_hash(ParameterRecord* record);
+    void erase_key_hash(const ParameterRecord* record);
     ParameterRecord* get_record_by_id(uint32_t id) const;
+    void end_batch();
 
     template <typename T>
     T read_value(ParameterRecord* record, bool allow_blocking) const TANH_NONBLOCKING_FUNCTION;
@@ -364,6 +659,10 @@ private:
     void write_value(ParameterRecord* record, const T& value);
 
     void notify_after_write(ParameterRecord* record, ParameterListener* source);
+    void notify_now(ParameterRecord* record, ParameterListener* source);
+    void mark_pending(const ParameterRecord* record) TANH_NONBLOCKING_FUNCTION;
+    void assign_notify_index(ParameterRecord* record);
+    void release_notify_index(const ParameterRecord* record);
 
     template <typename T>
     ParameterHandle<T> make_handle(ParameterRecord* record) const;
@@ -293,7 +293,8 @@ private:
 
     mutable RCU<ListenerData> m_listeners_rcu;
 
-    using GroupMap = std::map<std::string, std::shared_ptr<StateGroup>>;
+    // std::less<> so lookups take a string_view without building a std::string
+    using GroupMap = std::map<std::string, std::shared_ptr<StateGroup>, std::less<>>;
     mutable RCU<GroupMap> m_groups_rcu;
 
     virtual void ensure_thread_registered();
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "tanh/utils/RealtimeSanitizer.h"
+
+namespace thl {
+
+/**
+ * @class StateSnapshot
+ * @brief Numeric parameter values of a State, in a dense array indexed by
+ * parameter ID.
+ *
+ * Captured with State::capture_snapshot() and played back on the audio
+ * thread by PresetMorpher. Values are stored as double whatever the
+ * parameter's type; string parameters are not captured. IDs the snapshot
+ * has no value for hold NaN.
+ *
+ * Snapshots are plain values: copy them, edit them with set_value() off the
+ * audio thread, and share them read-only with the audio thread.
+ */
+class StateSnapshot {
+public:
+    StateSnapshot() = default;
+
+    /// True if the snapshot holds a value for @p id.
+    [[nodiscard]] bool contains(uint32_t id) const TANH_NONBLOCKING_FUNCTION {
+        return id < m_values.size() && !std::isnan(m_values[id]);
+    }
+
+    /// The value for @p id, or NaN if there is none.
+    [[nodiscard]] double value(uint32_t id) const TANH_NONBLOCKING_FUNCTION {
+        return id < m_values.size() ? m_values[id] : k_missing;
+    }
+
+    /// Set the value for @p id, growing the array as needed. NOT real-time safe.
+    void set_value(uint32_t id, double value) {
+        if (id >= m_values.size()) { m_values.resize(size_t{id} + 1, k_missing); }
+        m_values[id] = value;
+    }
+
+    /// Drop the value for @p id.
+    void erase(uint32_t id) {
+        if (id < m_values.size()) { m_values[id] = k_missing; }
+    }
+
+    /// One past the highest ID the array covers.
+    [[nodiscard]] size_t size() const { return m_values.size(); }
+
+    /// The raw values, indexed by ID (NaN where missing).
+    [[nodiscard]] std::span<const double> values() const { return m_values; }
+
+    static constexpr double k_missing = std::numeric_limits<double>::quiet_NaN();
+
+private:
+    std::vector<double> m_values;
+};
+
+}  // namespace thl
@@ -1,18 +1,94 @@
 #include <tanh/audio-io/AudioFileSink.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "miniaudio.h"
 
 namespace thl {
 
+namespace {
+// How often the writer thread wakes to drain the ring. At 48 kHz this is
+// ~960 frames per encoder call, well clear of per-callback granularity.
+constexpr int k_writer_poll_interval_ms = 20;
+}  // namespace
+
 struct AudioFileSink::Impl {
     ma_encoder m_encoder{};
     uint32_t m_encoder_channels = 0;
+
+    // Threaded mode only. The audio thread is the sole producer, the writer
+    // thread the sole consumer.
+    ma_pcm_rb m_ring{};
+    bool m_ring_initialised = false;
+    std::thread m_writer;
+    std::atomic<bool> m_writer_running{false};
+
+    // process() calls past their m_recording check. close_file() waits for
+    // this to reach zero before it drains and tears down the ring/encoder.
+    std::atomic<uint32_t> m_blocks_in_flight{0};
+
+    // Encodes everything currently readable from the ring. The ring may hand
+    // out the readable region in two pieces when it wraps, hence the loop.
+    // Returns the number of frames the encoder accepted.
+    uint64_t drain_ring() {
+        uint64_t total = 0;
+        while (ma_pcm_rb_available_read(&m_ring) > 0) {
+            ma_uint32 frames = ma_pcm_rb_available_read(&m_ring);
+            void* data = nullptr;
+            if (ma_pcm_rb_acquire_read(&m_ring, &frames, &data) != MA_SUCCESS || frames == 0) {
+                break;
+            }
+            ma_uint64 written = 0;
+            ma_encoder_write_pcm_frames(&m_encoder, data, frames, &written);
+            ma_pcm_rb_commit_read(&m_ring, frames);
+            total += written;
+        }
+        return total;
+    }
+
+    void run_writer(AudioFileSink& sink) {
+        while (m_writer_running.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(k_writer_poll_interval_ms));
+            const uint64_t written = drain_ring();
+            if (written > 0) {
+                sink.m_frames_written.fetch_add(written, std::memory_order_relaxed);
+            } else if (sink.m_recording.load(std::memory_order_acquire)) {
+                sink.m_underrun_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // Final flush: close_file() stops the writer only after every
+        // process() call in flight has finished, so nothing is pushed after
+        // this and it empties the ring for good.
+        sink.m_frames_written.fetch_add(drain_ring(), std::memory_order_relaxed);
+    }
+
+    // Pushes one interleaved block, all or nothing. Returns false when the
+    // ring has no room for the whole block.
+    bool push_block(const float* input, uint32_t frame_count, uint32_t channels) {
+        if (ma_pcm_rb_available_write(&m_ring) < frame_count) { return false; }
+        uint32_t pushed = 0;
+        while (pushed < frame_count) {
+            ma_uint32 frames = frame_count - pushed;
+            void* data = nullptr;
+            if (ma_pcm_rb_acquire_write(&m_ring, &frames, &data) != MA_SUCCESS || frames == 0) {
+                break;
+            }
+            std::memcpy(data,
+                        input + static_cast<size_t>(pushed) * channels,
+                        static_cast<size_t>(frames) * channels * sizeof(float));
+            ma_pcm_rb_commit_write(&m_ring, frames);
+            pushed += frames;
+        }
+        return pushed == frame_count;
+    }
 };
 
 namespace {
@@ -34,7 +110,9 @@ AudioFileSink::~AudioFileSink() {
 bool AudioFileSink::open_file(const std::string& file_path,
                               uint32_t channels,
                               uint32_t sample_rate,
-                              AudioEncodingFormat format) {
+                              AudioEncodingFormat format,
+                              AudioRecordingMode mode,
+                              float buffer_seconds) {
     close_file();
 
     ma_encoder_config const config =
@@ -42,23 +120,53 @@ bool AudioFileSink::open_file(const std::string& file_path,
 
     ma_result const result = ma_encoder_init_file(file_path.c_str(), &config, &m_impl->m_encoder);
 
-    m_open = (result == MA_SUCCESS);
-    m_impl->m_encoder_channels = m_open ? channels : 0;
+    if (result != MA_SUCCESS) { return false; }
+    m_impl->m_encoder_channels = channels;
+    m_mode = mode;
     m_frames_written.store(0, std::memory_order_release);
-    return m_open;
+    m_overflow_count.store(0, std::memory_order_release);
+    m_underrun_count.store(0, std::memory_order_release);
+
+    if (mode == AudioRecordingMode::Threaded) {
+        const auto ring_frames = static_cast<ma_uint32>(
+            std::max(1.0f, std::ceil(buffer_seconds * static_cast<float>(sample_rate))));
+        if (ma_pcm_rb_init(ma_format_f32, channels, ring_frames, nullptr, nullptr,
+                           &m_impl->m_ring) != MA_SUCCESS) {
+            ma_encoder_uninit(&m_impl->m_encoder);
+            m_impl->m_encoder_channels = 0;
+            return false;
+        }
+        m_impl->m_ring_initialised = true;
+        m_impl->m_writer_running.store(true, std::memory_order_release);
+        m_impl->m_writer = std::thread([this]() { m_impl->run_writer(*this); });
+    }
+    m_open.store(true, std::memory_order_release);
+    return true;
 }
 
 void AudioFileSink::close_file() {
-    if (m_open) {
-        m_recording.store(false, std::memory_order_release);
+    if (m_open.exchange(false, std::memory_order_acq_rel)) {
+        // Pairs with process(): any block that saw m_recording set has
+        // announced itself, so once the count drains none can still push
+        m_recording.store(false, std::memory_order_seq_cst);
+        while (m_impl->m_blocks_in_flight.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+        if (m_impl->m_writer.joinable()) {
+            m_impl->m_writer_running.store(false, std::memory_order_release);
+            m_impl->m_writer.join();
+        }
+        if (m_impl->m_ring_initialised) {
+            ma_pcm_rb_uninit(&m_impl->m_ring);
+            m_impl->m_ring_initialised = false;
+        }
         ma_encoder_uninit(&m_impl->m_encoder);
-        m_open = false;
         m_impl->m_encoder_channels = 0;
     }
 }
 
 void AudioFileSink::start_recording() {
-    if (m_open) {
+    if (m_open.load(std::memory_order_acquire)) {
         m_peak_level.store(0.0f, std::memory_order_release);
         m_recording.store(true, std::memory_order_release);
     }
@@ -75,12 +183,28 @@ void AudioFileSink::process(float* /*outputBuffer*/,
                             uint32_t /*numOutputChannels*/
 ) {
     if (!input_buffer || num_input_channels == 0) { return; }
-    if (!m_open || !m_recording.load(std::memory_order_acquire)) { return; }
+    if (!m_open.load(std::memory_order_acquire)) { return; }
+
+    // Announce the block before checking m_recording, so close_file() never
+    // tears the ring or encoder down underneath it
+    struct InFlight {
+        std::atomic<uint32_t>& m_count;
+        ~InFlight() { m_count.fetch_sub(1, std::memory_order_release); }
+    };
+    m_impl->m_blocks_in_flight.fetch_add(1, std::memory_order_seq_cst);
+    const InFlight in_flight{m_impl->m_blocks_in_flight};
+    if (!m_recording.load(std::memory_order_seq_cst)) { return; }
     if (num_input_channels != m_impl->m_encoder_channels) { return; }
 
-    ma_uint64 frames_written = 0;
-    ma_encoder_write_pcm_frames(&m_impl->m_encoder, input_buffer, frame_count, &frames_written);
-    m_frames_written.fetch_add(frames_written, std::memory_order_relaxed);
+    if (m_mode == AudioRecordingMode::Threaded) {
+        if (!m_impl->push_block(input_buffer, frame_count, num_input_channels)) {
+            m_overflow_count.fetch_add(frame_count, std::memory_order_relaxed);
+        }
+    } else {
+        ma_uint64 frames_written = 0;
+        ma_encoder_write_pcm_frames(&m_impl->m_encoder, input_buffer, frame_count, &frames_written);
+        m_frames_written.fetch_add(frames_written, std::memory_order_relaxed);
+    }
 
     // Compute peak amplitude for this block
     float peak = 0.0f;
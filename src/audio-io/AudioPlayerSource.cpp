@@ -9,11 +9,25 @@
 #include <string>
 #include <utility>
 
+#include "StreamingDataSource.h"
 #include "tanh/audio-io/DataSource.h"
 #include "tanh/core/AtomicSharedPtr.h"
+#include "tanh/core/threading/DeferredReclaimer.h"
 
 namespace thl {
 
+namespace {
+// Hands a reference the control thread just unpublished to the reclaimer.
+// process() reads inside a ReadScope, so this copy outlives every one the
+// audio thread took and the destructor runs on the reclaim thread.
+template <typename T>
+void retire_reference(std::shared_ptr<T> ptr) {
+    if (ptr) {
+        DeferredReclaimer::shared().retire(std::make_unique<std::shared_ptr<T>>(std::move(ptr)));
+    }
+}
+}  // namespace
+
 AudioPlayerSource::AudioPlayerSource() = default;
 
 AudioPlayerSource::~AudioPlayerSource() {
@@ -27,8 +41,9 @@ bool AudioPlayerSource::load_file(const std::string& file_path,
 
     std::scoped_lock const lock(m_state_mutex);
     m_playing.store(false, std::memory_order_release);
-    atomic_store(m_data_source, std::shared_ptr<audio_io::DataSource>(nullptr));
+    clear_data_sources();
     m_loaded.store(false, std::memory_order_release);
+    m_starvation_count.store(0, std::memory_order_release);
 
     m_file_path = file_path;
     m_memory_data = nullptr;
@@ -56,8 +71,9 @@ bool AudioPlayerSource::load_from_memory(const void* data,
 
     std::scoped_lock const lock(m_state_mutex);
     m_playing.store(false, std::memory_order_release);
-    atomic_store(m_data_source, std::shared_ptr<audio_io::DataSource>(nullptr));
+    clear_data_sources();
     m_loaded.store(false, std::memory_order_release);
+    m_starvation_count.store(0, std::memory_order_release);
 
     m_file_path.clear();
     m_memory_data = data;
@@ -80,7 +96,7 @@ void AudioPlayerSource::unload_file() {
     m_playing.store(false, std::memory_order_release);
 
     std::scoped_lock const lock(m_state_mutex);
-    atomic_store(m_data_source, std::shared_ptr<audio_io::DataSource>(nullptr));
+    clear_data_sources();
     m_loaded.store(false, std::memory_order_release);
     m_channels = 0;
     m_sample_rate = 0;
@@ -105,8 +121,11 @@ void AudioPlayerSource::stop() {
     m_playing.store(false, std::memory_order_release);
     m_stop_requested.store(false, std::memory_order_release);
     m_fade_out_counter = 0;
-    auto ds = atomic_load(m_data_source);
-    if (ds) { ds->seek(0); }
+    if (auto stream = atomic_load(m_stream)) {
+        stream->request_seek(0);
+    } else if (auto ds = atomic_load(m_data_source)) {
+        ds->seek(0);
+    }
 }
 
 void AudioPlayerSource::request_stop() {
@@ -116,17 +135,22 @@ void AudioPlayerSource::request_stop() {
 }
 
 void AudioPlayerSource::seek_to_frame(uint64_t frame) {
-    auto ds = atomic_load(m_data_source);
-    if (ds) { ds->seek(frame); }
+    if (auto stream = atomic_load(m_stream)) {
+        stream->request_seek(frame);
+    } else if (auto ds = atomic_load(m_data_source)) {
+        ds->seek(frame);
+    }
 }
 
 uint64_t AudioPlayerSource::get_current_frame() const {
+    if (auto stream = atomic_load(m_stream)) { return stream->get_cursor(); }
     auto ds = atomic_load(m_data_source);
     if (!ds) { return 0; }
     return ds->get_cursor();
 }
 
 uint64_t AudioPlayerSource::get_total_frames() const {
+    if (auto stream = atomic_load(m_stream)) { return stream->get_total_frames(); }
     auto ds = atomic_load(m_data_source);
     if (!ds) { return 0; }
     return ds->get_total_frames();
@@ -137,6 +161,20 @@ void AudioPlayerSource::set_finished_callback(FinishedCallback callback) {
     atomic_store(m_finished_callback, std::move(ptr));
 }
 
+void AudioPlayerSource::set_playback_mode(AudioPlaybackMode mode, float buffer_seconds) {
+    std::scoped_lock const lock(m_state_mutex);
+    m_mode = mode;
+    m_buffer_seconds = buffer_seconds;
+    if (!m_loaded.load(std::memory_order_acquire)) { return; }
+
+    bool const was_playing = m_playing.load(std::memory_order_acquire);
+    m_playing.store(false, std::memory_order_release);
+
+    if (rebuild_data_source(m_channels, m_sample_rate, get_current_frame()) && was_playing) {
+        m_playing.store(true, std::memory_order_release);
+    }
+}
+
 void AudioPlayerSource::prepare_to_play(uint32_t sample_rate, uint32_t /*bufferSize*/) {
     if (sample_rate == 0) { return; }
 
@@ -145,9 +183,14 @@ void AudioPlayerSource::prepare_to_play(uint32_t sample_rate, uint32_t /*bufferS
     if (m_file_path.empty() && m_memory_data == nullptr) { return; }
 
     uint64_t initial_frame = 0;
-    auto ds = atomic_load(m_data_source);
-    if (ds && ds->get_sample_rate() == sample_rate && ds->get_channel_count() == m_channels) {
-        initial_frame = ds->get_cursor();
+    if (auto stream = atomic_load(m_stream)) {
+        if (stream->get_sample_rate() == sample_rate && stream->get_channel_count() == m_channels) {
+            initial_frame = stream->get_cursor();
+        }
+    } else if (auto ds = atomic_load(m_data_source)) {
+        if (ds->get_sample_rate() == sample_rate && ds->get_channel_count() == m_channels) {
+            initial_frame = ds->get_cursor();
+        }
     }
 
     bool const was_playing = m_playing.load(std::memory_order_acquire);
@@ -169,12 +212,28 @@ void AudioPlayerSource::process(float* output_buffer,
         return;
     }
 
-    auto ds = atomic_load(m_data_source);
-    if (!ds) { return; }
+    // Keeps a source unpublished mid-block from being destroyed on this thread
+    const auto read_scope = DeferredReclaimer::shared().read_scope();
 
-    if (num_output_channels != ds->get_channel_count()) { return; }
+    uint64_t frames_read = 0;
+    bool finished = false;
+    if (auto stream = atomic_load(m_stream)) {
+        if (num_output_channels != stream->get_channel_count()) { return; }
 
-    uint64_t const frames_read = ds->read_pcm_frames(output_buffer, frame_count);
+        auto status = audio_io::StreamingDataSource::ReadStatus::Ok;
+        frames_read = stream->read_pcm_frames(output_buffer, frame_count, status);
+        if (status == audio_io::StreamingDataSource::ReadStatus::Starved) {
+            m_starvation_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        finished = status == audio_io::StreamingDataSource::ReadStatus::EndOfStream;
+    } else if (auto ds = atomic_load(m_data_source)) {
+        if (num_output_channels != ds->get_channel_count()) { return; }
+
+        frames_read = ds->read_pcm_frames(output_buffer, frame_count);
+        finished = frames_read < frame_count;
+    } else {
+        return;
+    }
 
     if (frames_read < frame_count) {
         std::memset(output_buffer + frames_read * num_output_channels,
@@ -219,7 +278,7 @@ void AudioPlayerSource::process(float* output_buffer,
         return;
     }
 
-    if (frames_read < frame_count) {
+    if (finished) {
         m_playing.store(false, std::memory_order_release);
         auto callback = atomic_load(m_finished_callback);
         if (callback) { (*callback)(); }
@@ -254,10 +313,37 @@ bool AudioPlayerSource::rebuild_data_source(uint32_t decoded_channels,
 
     if (!ds->is_valid()) { return false; }
 
-    if (initial_frame > 0) { ds->seek(initial_frame); }
+    auto previous_stream = atomic_load(m_stream);
+    auto previous_ds = atomic_load(m_data_source);
+
+    if (m_mode == AudioPlaybackMode::Streaming) {
+        // The decoder thread takes sole ownership of the data source.
+        auto stream = std::make_shared<audio_io::StreamingDataSource>(
+            std::move(*ds), m_buffer_seconds, initial_frame);
+        if (!stream->start()) { return false; }
+        atomic_store(m_data_source, std::shared_ptr<audio_io::DataSource>(nullptr));
+        atomic_store(m_stream, std::move(stream));
+    } else {
+        if (initial_frame > 0) { ds->seek(initial_frame); }
+        atomic_store(m_data_source, std::move(ds));
+        atomic_store(m_stream, std::shared_ptr<audio_io::StreamingDataSource>(nullptr));
+    }
 
-    atomic_store(m_data_source, std::move(ds));
+    // Join the old decoder here rather than wherever its last reference dies.
+    if (previous_stream) { previous_stream->stop(); }
+    retire_reference(std::move(previous_stream));
+    retire_reference(std::move(previous_ds));
     return true;
 }
 
+void AudioPlayerSource::clear_data_sources() {
+    auto stream = atomic_load(m_stream);
+    auto ds = atomic_load(m_data_source);
+    atomic_store(m_data_source, std::shared_ptr<audio_io::DataSource>(nullptr));
+    atomic_store(m_stream, std::shared_ptr<audio_io::StreamingDataSource>(nullptr));
+    if (stream) { stream->stop(); }
+    retire_reference(std::move(stream));
+    retire_reference(std::move(ds));
+}
+
 }  // namespace thl
@@ -0,0 +1,222 @@
+#include "StreamingDataSource.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+namespace thl::audio_io {
+
+namespace {
+// Upper bound on frames decoded per ring write. Large enough to amortise the
+// decoder's per-call overhead, small enough to react to seeks promptly.
+constexpr ma_uint32 k_decode_chunk_frames = 4096;
+// Sleep between polls when the ring is full or the source is exhausted.
+constexpr int k_decoder_poll_interval_ms = 5;
+}  // namespace
+
+StreamingDataSource::StreamingDataSource(DataSource&& source,
+                                         float buffer_seconds,
+                                         uint64_t initial_frame)
+    : m_source(std::move(source)) {
+    if (!m_source.is_valid()) { return; }
+
+    m_channels = m_source.get_channel_count();
+    m_sample_rate = m_source.get_sample_rate();
+    m_total_frames = m_source.get_total_frames();
+
+    const auto ring_frames = static_cast<ma_uint32>(
+        std::max(1.0f, std::ceil(buffer_seconds * static_cast<float>(m_sample_rate))));
+    if (ma_pcm_rb_init(ma_format_f32, m_channels, ring_frames, nullptr, nullptr, &m_ring) !=
+        MA_SUCCESS) {
+        return;
+    }
+    m_ring_initialised = true;
+    m_min_decode_frames = std::max<ma_uint32>(1, std::min(k_decode_chunk_frames, ring_frames / 4));
+
+    if (initial_frame > 0) { m_source.seek(initial_frame); }
+    m_segment_frame.store(initial_frame, std::memory_order_relaxed);
+    m_cursor.store(initial_frame, std::memory_order_relaxed);
+}
+
+StreamingDataSource::~StreamingDataSource() {
+    stop();
+    if (m_ring_initialised) { ma_pcm_rb_uninit(&m_ring); }
+}
+
+bool StreamingDataSource::start() {
+    if (!m_ring_initialised || m_decoder.joinable()) { return false; }
+
+    // Prefill so that playback can start without an initial starvation.
+    while (decode_chunk()) {}
+
+    m_running.store(true, std::memory_order_release);
+    m_decoder = std::thread([this]() { run_decoder(); });
+    return true;
+}
+
+void StreamingDataSource::stop() {
+    m_running.store(false, std::memory_order_release);
+    if (m_decoder.joinable()) { m_decoder.join(); }
+}
+
+void StreamingDataSource::request_seek(uint64_t frame) {
+    m_pending_seek.store(frame, std::memory_order_release);
+}
+
+uint64_t StreamingDataSource::get_cursor() const {
+    const uint64_t pending = m_pending_seek.load(std::memory_order_acquire);
+    if (pending != k_no_seek) { return pending; }
+    return m_cursor.load(std::memory_order_acquire);
+}
+
+// ── Audio thread ────────────────────────────────────────────────────────────
+
+uint64_t StreamingDataSource::read_pcm_frames(float* output,
+                                              uint64_t frame_count,
+                                              ReadStatus& status) {
+    apply_pending_seek();
+
+    if (m_decoder_seek.load(std::memory_order_acquire) != k_no_seek) {
+        status = ReadStatus::Seeking;
+        return 0;
+    }
+
+    // Load the end marker before sampling the ring: once it is visible, every
+    // frame up to it has been committed.
+    const uint64_t eof_at = m_eof_at.load(std::memory_order_acquire);
+    const uint64_t base = m_segment_base.load(std::memory_order_relaxed);
+    if (m_consumed < base) { discard(base - m_consumed); }
+    if (m_consumed < base) {
+        status = ReadStatus::Seeking;
+        return 0;
+    }
+
+    uint64_t copied = 0;
+    while (copied < frame_count) {
+        auto frames = static_cast<ma_uint32>(
+            std::min<uint64_t>(frame_count - copied, k_decode_chunk_frames));
+        void* data = nullptr;
+        if (ma_pcm_rb_acquire_read(&m_ring, &frames, &data) != MA_SUCCESS || frames == 0) {
+            break;
+        }
+        std::memcpy(output + copied * m_channels,
+                    data,
+                    static_cast<size_t>(frames) * m_channels * sizeof(float));
+        ma_pcm_rb_commit_read(&m_ring, frames);
+        copied += frames;
+    }
+
+    m_consumed += copied;
+    m_cursor.store(m_segment_frame.load(std::memory_order_relaxed) + (m_consumed - base),
+                   std::memory_order_release);
+
+    if (copied == frame_count) {
+        status = ReadStatus::Ok;
+    } else if (eof_at != k_no_seek && m_consumed >= eof_at) {
+        status = ReadStatus::EndOfStream;
+    } else if (m_consumed == base) {
+        // The decoder has re-seeked but not delivered the segment's first
+        // chunk yet; still part of the seek, not starvation.
+        status = ReadStatus::Seeking;
+    } else {
+        status = ReadStatus::Starved;
+    }
+    return copied;
+}
+
+void StreamingDataSource::apply_pending_seek() {
+    const uint64_t target = m_pending_seek.exchange(k_no_seek, std::memory_order_acq_rel);
+    if (target == k_no_seek) { return; }
+
+    // Forward seeks that land inside the buffered window just skip frames.
+    if (m_decoder_seek.load(std::memory_order_acquire) == k_no_seek) {
+        const uint64_t base = m_segment_base.load(std::memory_order_relaxed);
+        if (m_consumed < base) { discard(base - m_consumed); }
+        if (m_consumed >= base) {
+            const uint64_t position =
+                m_segment_frame.load(std::memory_order_relaxed) + (m_consumed - base);
+            const uint64_t buffered = ma_pcm_rb_available_read(&m_ring);
+            if (target >= position && target - position <= buffered) {
+                discard(target - position);
+                m_cursor.store(target, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    // Out of range: the decoder re-seeks the source and starts a new segment.
+    m_cursor.store(target, std::memory_order_release);
+    m_decoder_seek.store(target, std::memory_order_release);
+}
+
+uint64_t StreamingDataSource::discard(uint64_t frames) {
+    uint64_t skipped = 0;
+    while (skipped < frames) {
+        auto chunk = static_cast<ma_uint32>(
+            std::min<uint64_t>(frames - skipped, k_decode_chunk_frames));
+        void* data = nullptr;
+        if (ma_pcm_rb_acquire_read(&m_ring, &chunk, &data) != MA_SUCCESS || chunk == 0) { break; }
+        ma_pcm_rb_commit_read(&m_ring, chunk);
+        skipped += chunk;
+    }
+    m_consumed += skipped;
+    return skipped;
+}
+
+// ── Decoder thread ──────────────────────────────────────────────────────────
+
+void StreamingDataSource::run_decoder() {
+    while (m_running.load(std::memory_order_acquire)) {
+        service_seek_request();
+        if (!decode_chunk()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(k_decoder_poll_interval_ms));
+        }
+    }
+}
+
+void StreamingDataSource::service_seek_request() {
+    uint64_t target = m_decoder_seek.load(std::memory_order_acquire);
+    while (target != k_no_seek) {
+        m_source.seek(target);
+        m_eof_at.store(k_no_seek, std::memory_order_relaxed);
+        m_segment_base.store(m_pushed, std::memory_order_relaxed);
+        m_segment_frame.store(target, std::memory_order_relaxed);
+        // The audio thread may have replaced the target meanwhile; if so,
+        // go round again with the newer one.
+        if (m_decoder_seek.compare_exchange_strong(
+                target, k_no_seek, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            break;
+        }
+    }
+}
+
+bool StreamingDataSource::decode_chunk() {
+    if (m_eof_at.load(std::memory_order_relaxed) != k_no_seek) { return false; }
+
+    ma_uint32 frames = std::min(ma_pcm_rb_available_write(&m_ring), k_decode_chunk_frames);
+    if (frames < m_min_decode_frames) { return false; }
+
+    void* data = nullptr;
+    if (ma_pcm_rb_acquire_write(&m_ring, &frames, &data) != MA_SUCCESS || frames == 0) {
+        return false;
+    }
+    const uint64_t decoded = m_source.read_pcm_frames(static_cast<float*>(data), frames);
+    ma_pcm_rb_commit_write(&m_ring, static_cast<ma_uint32>(decoded));
+    m_pushed += decoded;
+
+    // A streaming resource-manager source can return a short read while its
+    // pages are still loading, so only a cursor at the end means EOF.
+    if (decoded < frames) {
+        const bool at_end = m_total_frames > 0 ? m_source.get_cursor() >= m_total_frames
+                                               : decoded == 0;
+        if (at_end) { m_eof_at.store(m_pushed, std::memory_order_release); }
+    }
+    return decoded > 0;
+}
+
+}  // namespace thl::audio_io
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <tanh/audio-io/DataSource.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+#include "miniaudio.h"
+
+namespace thl::audio_io {
+
+/**
+ * Decoder thread + lock-free PCM ring in front of a DataSource.
+ *
+ * The decoder thread is the only code that touches the DataSource after
+ * start(): it decodes (and resamples) into a preallocated ma_pcm_rb ahead of
+ * playback. The audio thread only copies out of the ring. Control threads
+ * talk to the audio thread through a single pending-seek slot, and the audio
+ * thread forwards out-of-range seeks to the decoder through another one, so
+ * every ring pointer keeps exactly one writer.
+ *
+ * Frame bookkeeping uses "stream indices": the running count of frames ever
+ * pushed into (or consumed from) the ring. A decoder-side seek starts a new
+ * segment at the current push index; frames pushed before it are stale and
+ * the audio thread discards them without playing them.
+ */
+class StreamingDataSource {
+public:
+    enum class ReadStatus {
+        Ok,           ///< The full block was delivered.
+        Starved,      ///< The decoder fell behind; the block is short.
+        Seeking,      ///< Waiting for the decoder to serve an out-of-range seek.
+        EndOfStream,  ///< The last decoded frame has been delivered.
+    };
+
+    StreamingDataSource(DataSource&& source, float buffer_seconds, uint64_t initial_frame);
+    ~StreamingDataSource();
+
+    StreamingDataSource(const StreamingDataSource&) = delete;
+    StreamingDataSource& operator=(const StreamingDataSource&) = delete;
+
+    /// Prefills the ring on the calling thread, then starts the decoder thread.
+    bool start();
+
+    /// Stops and joins the decoder thread. Idempotent. Call from a control
+    /// thread so that the join never lands on the audio thread.
+    void stop();
+
+    /// Control thread: request playback to continue from `frame`. Served from
+    /// the ring by the next read_pcm_frames() when the frame is buffered.
+    void request_seek(uint64_t frame);
+
+    /// Audio thread: copy up to frame_count interleaved frames into output.
+    /// Wait-free; never decodes. Returns the number of frames copied.
+    uint64_t read_pcm_frames(float* output, uint64_t frame_count, ReadStatus& status);
+
+    /// Playback position in source frames (pending seek target if any).
+    uint64_t get_cursor() const;
+
+    uint32_t get_channel_count() const { return m_channels; }
+    uint32_t get_sample_rate() const { return m_sample_rate; }
+    uint64_t get_total_frames() const { return m_total_frames; }
+
+private:
+    static constexpr uint64_t k_no_seek = std::numeric_limits<uint64_t>::max();
+
+    void run_decoder();
+    void service_seek_request();
+    bool decode_chunk();
+    void apply_pending_seek();
+    uint64_t discard(uint64_t frames);
+
+    DataSource m_source;
+    uint32_t m_channels = 0;
+    uint32_t m_sample_rate = 0;
+    uint64_t m_total_frames = 0;
+
+    ma_pcm_rb m_ring{};
+    bool m_ring_initialised = false;
+    uint32_t m_min_decode_frames = 0;
+
+    std::thread m_decoder;
+    std::atomic<bool> m_running{false};
+
+    // Control thread → audio thread.
+    std::atomic<uint64_t> m_pending_seek{k_no_seek};
+    // Audio thread → decoder thread.
+    std::atomic<uint64_t> m_decoder_seek{k_no_seek};
+
+    // Current segment, written by the decoder only while m_decoder_seek is
+    // pending and published by clearing it.
+    std::atomic<uint64_t> m_segment_base{0};
+    std::atomic<uint64_t> m_segment_frame{0};
+    // Stream index at which the decoder hit the end of the source.
+    std::atomic<uint64_t> m_eof_at{k_no_seek};
+
+    uint64_t m_pushed = 0;    // decoder thread only
+    uint64_t m_consumed = 0;  // audio thread only
+    std::atomic<uint64_t> m_cursor{0};
+};
+
+}  // namespace thl::audio_io
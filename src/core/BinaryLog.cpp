@@ -0,0 +1,258 @@
+#include <tanh/core/BinaryLog.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(THL_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace thl::Logger {
+
+namespace {
+
+constexpr std::array<char, 8> k_magic = {'T', 'H', 'L', 'B', 'L', 'O', 'G', '1'};
+constexpr std::uint32_t k_version = 1;
+constexpr std::size_t k_header_size = 8 + 4 + 4 + 8;
+constexpr std::size_t k_record_fixed_size = 4 + 8 + 8 + 8 + 4 + 2 + 2 + 4;
+constexpr std::string_view k_extension = ".tlb";
+
+// Little-endian field access; every supported target is little-endian, so
+// memcpy is the encoding.
+template <typename T>
+std::byte* put(std::byte* out, T value) {
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template <typename T>
+T get(const std::byte* in) {
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    return value;
+}
+
+std::byte* put_bytes(std::byte* out, const std::string& text) {
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+std::string segment_name(std::string_view prefix, std::uint64_t index) {
+    std::array<char, 32> digits{};
+    std::snprintf(digits.data(), digits.size(), "%06llu", static_cast<unsigned long long>(index));
+    return std::string(prefix) + "-" + digits.data() + std::string(k_extension);
+}
+
+// The index of a file named <prefix>-<digits>.tlb. Anything else (another
+// prefix sharing this one's start, a stray file) is not a segment.
+std::optional<std::uint64_t> segment_index(std::string_view name, std::string_view prefix) {
+    if (name.size() <= prefix.size() + 1 + k_extension.size() || !name.starts_with(prefix) ||
+        name[prefix.size()] != '-' || !name.ends_with(k_extension)) {
+        return std::nullopt;
+    }
+    const std::string_view digits =
+        name.substr(prefix.size() + 1, name.size() - prefix.size() - 1 - k_extension.size());
+    std::uint64_t index = 0;
+    const auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), index);
+    if (error != std::errc{} || end != digits.data() + digits.size()) { return std::nullopt; }
+    return index;
+}
+
+// Field lengths are capped so they fit the u16 / u32 record fields.
+std::size_t capped(const std::string& text, std::size_t limit) {
+    return std::min(text.size(), limit);
+}
+
+}  // namespace
+
+std::size_t binary_record_size(const LogRecord& record) {
+    return k_record_fixed_size + capped(record.m_source, UINT16_MAX) +
+           capped(record.m_group, UINT16_MAX) + capped(record.m_message, UINT32_MAX);
+}
+
+// ── Writer ──────────────────────────────────────────────────────────────────
+
+BinaryLogWriter::BinaryLogWriter(Options options) : m_options(std::move(options)) {
+    // Continue numbering after segments left by a previous run
+    m_segments = list_binary_log_segments(m_options.m_directory, m_options.m_prefix);
+    if (!m_segments.empty()) {
+        const std::string last = std::filesystem::path(m_segments.back()).filename().string();
+        m_next_index = segment_index(last, m_options.m_prefix).value_or(0) + 1;
+    }
+}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    close_segment();
+}
+
+bool BinaryLogWriter::write(const LogRecord& record) {
+    const std::size_t size = binary_record_size(record);
+    if (size + k_header_size > m_options.m_segment_size) { return false; }
+
+    // Keep room for the 4-byte end marker after the record
+    if (m_map != nullptr && m_offset + size + 4 > m_options.m_segment_size) { close_segment(); }
+    if (m_map == nullptr && !open_segment()) { return false; }
+
+    std::byte* out = m_map + m_offset;
+    out = put(out, static_cast<std::uint32_t>(size));
+    out = put(out, record.m_seq);
+    out = put(out, record.m_monotonic_ns);
+    out = put(out, record.m_timestamp_ms);
+    out = put(out, record.m_level);
+    const std::string source = record.m_source.substr(0, UINT16_MAX);
+    const std::string group = record.m_group.substr(0, UINT16_MAX);
+    out = put(out, static_cast<std::uint16_t>(source.size()));
+    out = put(out, static_cast<std::uint16_t>(group.size()));
+    out = put(out, static_cast<std::uint32_t>(capped(record.m_message, UINT32_MAX)));
+    out = put_bytes(out, source);
+    out = put_bytes(out, group);
+    std::memcpy(out, record.m_message.data(), capped(record.m_message, UINT32_MAX));
+    m_offset += size;
+    return true;
+}
+
+void BinaryLogWriter::flush() {
+    if (m_map == nullptr) { return; }
+#if !defined(THL_PLATFORM_WINDOWS)
+    msync(m_map, m_offset, MS_ASYNC);
+#else
+    std::ofstream(m_path, std::ios::binary | std::ios::trunc)
+        .write(reinterpret_cast<const char*>(m_stage.data()), static_cast<std::streamsize>(m_offset));
+#endif
+}
+
+bool BinaryLogWriter::open_segment() {
+    std::error_code ec;
+    std::filesystem::create_directories(m_options.m_directory, ec);
+    m_path = (std::filesystem::path(m_options.m_directory) /
+              segment_name(m_options.m_prefix, m_next_index))
+                 .string();
+
+#if !defined(THL_PLATFORM_WINDOWS)
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0) { return false; }
+    if (::ftruncate(m_fd, static_cast<off_t>(m_options.m_segment_size)) != 0) {
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    void* map = ::mmap(nullptr, m_options.m_segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (map == MAP_FAILED) {
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    m_map = static_cast<std::byte*>(map);
+#else
+    m_stage.assign(m_options.m_segment_size, std::byte{0});
+    m_map = m_stage.data();
+#endif
+
+    std::byte* out = m_map;
+    std::memcpy(out, k_magic.data(), k_magic.size());
+    out = put(out + k_magic.size(), k_version);
+    out = put(out, static_cast<std::uint32_t>(k_header_size));
+    put(out, m_next_index);
+    m_offset = k_header_size;
+
+    ++m_next_index;
+    m_segments.push_back(m_path);
+    while (m_options.m_max_segments > 0 && m_segments.size() > m_options.m_max_segments) {
+        std::filesystem::remove(m_segments.front(), ec);
+        m_segments.erase(m_segments.begin());
+    }
+    return true;
+}
+
+void BinaryLogWriter::close_segment() {
+    if (m_map == nullptr) { return; }
+
+#if !defined(THL_PLATFORM_WINDOWS)
+    // Shrink the file to its data plus the end marker (already zero)
+    const std::size_t used = std::min(m_offset + 4, m_options.m_segment_size);
+    ::munmap(m_map, m_options.m_segment_size);
+    if (::ftruncate(m_fd, static_cast<off_t>(used)) != 0) {
+        // Leave the zero-filled tail; readers stop at the end marker
+    }
+    ::close(m_fd);
+    m_fd = -1;
+#else
+    flush();
+#endif
+    m_map = nullptr;
+    m_offset = 0;
+}
+
+// ── Reader ──────────────────────────────────────────────────────────────────
+
+std::vector<std::string> list_binary_log_segments(const std::string& directory,
+                                                  std::string_view prefix) {
+    std::vector<std::pair<std::uint64_t, std::string>> indexed;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (const auto index = segment_index(name, prefix)) {
+            indexed.emplace_back(*index, entry.path().string());
+        }
+    }
+    // By index, so numbering past the zero padding stays chronological
+    std::sort(indexed.begin(), indexed.end());
+
+    std::vector<std::string> segments;
+    segments.reserve(indexed.size());
+    for (auto& [index, path] : indexed) { segments.push_back(std::move(path)); }
+    return segments;
+}
+
+std::vector<LogRecord> read_binary_log(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) { throw std::runtime_error("cannot open binary log: " + path); }
+    std::vector<char> raw((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const auto* data = reinterpret_cast<const std::byte*>(raw.data());
+
+    if (raw.size() < k_header_size || std::memcmp(raw.data(), k_magic.data(), k_magic.size()) != 0 ||
+        get<std::uint32_t>(data + 8) != k_version) {
+        throw std::runtime_error("not a binary log segment: " + path);
+    }
+
+    std::vector<LogRecord> records;
+    std::size_t offset = get<std::uint32_t>(data + 12);
+    while (offset + 4 <= raw.size()) {
+        const auto size = get<std::uint32_t>(data + offset);
+        if (size < k_record_fixed_size || offset + size > raw.size()) { break; }
+
+        const std::byte* in_record = data + offset + 4;
+        LogRecord record;
+        record.m_seq = get<std::uint64_t>(in_record);
+        record.m_monotonic_ns = get<std::uint64_t>(in_record + 8);
+        record.m_timestamp_ms = get<std::int64_t>(in_record + 16);
+        record.m_level = get<std::uint32_t>(in_record + 24);
+        const auto source_len = get<std::uint16_t>(in_record + 28);
+        const auto group_len = get<std::uint16_t>(in_record + 30);
+        const auto message_len = get<std::uint32_t>(in_record + 32);
+        if (k_record_fixed_size + source_len + group_len + message_len != size) { break; }
+
+        const char* text = raw.data() + offset + k_record_fixed_size;
+        record.m_source.assign(text, source_len);
+        record.m_group.assign(text + source_len, group_len);
+        record.m_message.assign(text + source_len + group_len, message_len);
+        records.push_back(std::move(record));
+        offset += size;
+    }
+    return records;
+}
+
+}  // namespace thl::Logger
@@ -0,0 +1,106 @@
+#include <tanh/core/threading/DeferredReclaimer.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace thl {
+
+DeferredReclaimer::DeferredReclaimer() : DeferredReclaimer(Options{}) {}
+
+DeferredReclaimer::DeferredReclaimer(Options options)
+    : m_options(options), m_queue(options.m_capacity) {
+    m_pending.reserve(m_queue.capacity());
+
+    if (m_options.m_reclaim_thread) {
+        m_reclaimer = std::thread([this] { reclaim_loop(); });
+    }
+}
+
+DeferredReclaimer::~DeferredReclaimer() {
+    {
+        std::scoped_lock const lock(m_stop_mutex);
+        m_stop = true;
+    }
+    m_stop_cv.notify_all();
+    if (m_reclaimer.joinable()) { m_reclaimer.join(); }
+
+    // No reader is left, so everything still queued is unreachable
+    Retired retired{};
+    while (m_queue.try_pop(retired)) { retired.m_destroy(retired.m_object); }
+    for (const auto& r : m_overflow) { r.m_destroy(r.m_object); }
+    for (const auto& r : m_pending) { r.m_destroy(r.m_object); }
+}
+
+DeferredReclaimer& DeferredReclaimer::shared() {
+    static DeferredReclaimer instance;
+    return instance;
+}
+
+bool DeferredReclaimer::try_retire(void* object, Destroy destroy) TANH_NONBLOCKING_FUNCTION {
+    if (object == nullptr) { return true; }
+
+    // Scopes entered from here on load the next epoch and cannot see object
+    const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (!m_queue.try_push({object, destroy, epoch})) { return false; }
+    m_num_pending.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void DeferredReclaimer::retire(void* object, Destroy destroy) {
+    if (try_retire(object, destroy)) { return; }
+
+    const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::scoped_lock const lock(m_overflow_mutex);
+        m_overflow.push_back({object, destroy, epoch});
+    }
+    m_num_pending.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t DeferredReclaimer::collect() {
+    std::scoped_lock const lock(m_collect_mutex);
+
+    Retired retired{};
+    while (m_queue.try_pop(retired)) { m_pending.push_back(retired); }
+    {
+        std::scoped_lock const overflow_lock(m_overflow_mutex);
+        m_pending.insert(m_pending.end(), m_overflow.begin(), m_overflow.end());
+        m_overflow.clear();
+    }
+    if (m_pending.empty()) { return 0; }
+
+    // Pairs with the fence in ReadScope
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_unslotted_readers.load(std::memory_order_acquire) != 0) { return 0; }
+
+    uint64_t oldest = m_epoch.load(std::memory_order_seq_cst);
+    for (const auto& reader : m_reader_epochs) {
+        const uint64_t epoch = reader.load(std::memory_order_acquire);
+        if (epoch != 0 && epoch < oldest) { oldest = epoch; }
+    }
+
+    // A scope that entered in epoch E may hold anything retired in E or later
+    auto expired = std::partition(m_pending.begin(), m_pending.end(), [&](const Retired& r) {
+        return r.m_epoch >= oldest;
+    });
+    const auto count = static_cast<size_t>(m_pending.end() - expired);
+    for (auto it = expired; it != m_pending.end(); ++it) { it->m_destroy(it->m_object); }
+    m_pending.erase(expired, m_pending.end());
+
+    m_num_pending.fetch_sub(count, std::memory_order_relaxed);
+    m_num_reclaimed.fetch_add(count, std::memory_order_relaxed);
+    return count;
+}
+
+void DeferredReclaimer::reclaim_loop() {
+    std::unique_lock lock(m_stop_mutex);
+    while (!m_stop) {
+        m_stop_cv.wait_for(lock, m_options.m_reclaim_interval, [this] { return m_stop; });
+        if (m_stop) { return; }
+        lock.unlock();
+        collect();
+        lock.lock();
+    }
+}
+
+}  // namespace thl
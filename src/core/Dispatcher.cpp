@@ -1,10 +1,35 @@
 #include <tanh/core/Dispatcher.h>
 
+#include <cstring>
 #include <mutex>
 #include <string>
 
 namespace thl {
 
+Dispatcher::Dispatcher() : Dispatcher(Options{}) {}
+
+Dispatcher::Dispatcher(Options options)
+    : m_options(options)
+    , m_free_slots(options.m_capacity)
+    , m_pending(options.m_capacity) {
+    // Both queues round up identically; every slot starts out free
+    const size_t slots = m_free_slots.capacity();
+    m_payloads.resize(slots * m_options.m_max_payload_size);
+    for (uint32_t slot = 0; slot < slots; ++slot) { m_free_slots.try_push(slot); }
+    m_batch.reserve(slots);
+
+    if (m_options.m_delivery_thread) {
+        m_delivery = std::thread([this] { delivery_loop(); });
+    }
+}
+
+Dispatcher::~Dispatcher() {
+    m_stop.store(true, std::memory_order_relaxed);
+    if (m_delivery.joinable()) { m_delivery.join(); }
+}
+
+// ── Synchronous string events ───────────────────────────────────────────────
+
 void Dispatcher::add_listener(const std::string& event, DispatcherListener* listener) {
     std::scoped_lock const lock(m_mutex);
     m_listeners[event].push_back(listener);
@@ -14,6 +39,10 @@ void Dispatcher::remove_listener(DispatcherListener* listener) {
     std::scoped_lock const lock(m_mutex);
 
     for (auto& [event, listeners] : m_listeners) { std::erase(listeners, listener); }
+    for (auto& subscriptions : m_subscriptions) {
+        std::erase_if(subscriptions,
+                      [&](const Subscription& s) { return s.m_listener == listener; });
+    }
 }
 
 void Dispatcher::dispatch(const std::string& event, const std::string& data) {
@@ -25,4 +54,93 @@ void Dispatcher::dispatch(const std::string& event, const std::string& data) {
     }
 }
 
+// ── Posted events ───────────────────────────────────────────────────────────
+
+Dispatcher::EventId Dispatcher::intern(std::string_view name) {
+    std::scoped_lock const lock(m_mutex);
+
+    std::string key(name);
+    auto it = m_event_ids.find(key);
+    if (it != m_event_ids.end()) { return it->second; }
+
+    const auto id = static_cast<EventId>(m_event_names.size());
+    m_event_names.push_back(key);
+    m_subscriptions.emplace_back();
+    m_event_ids.emplace(std::move(key), id);
+    return id;
+}
+
+std::string Dispatcher::event_name(EventId event) const {
+    std::scoped_lock const lock(m_mutex);
+    return event < m_event_names.size() ? m_event_names[event] : std::string();
+}
+
+void Dispatcher::add_listener(EventId event, DispatcherListener* listener, Delivery delivery) {
+    std::scoped_lock const lock(m_mutex);
+    if (event >= m_subscriptions.size()) { return; }
+    m_subscriptions[event].push_back({listener, delivery});
+}
+
+bool Dispatcher::post(EventId event, std::span<const std::byte> payload) TANH_NONBLOCKING_FUNCTION {
+    uint32_t slot = 0;
+    if (payload.size() > m_options.m_max_payload_size || !m_free_slots.try_pop(slot)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (!payload.empty()) {
+        std::memcpy(m_payloads.data() + slot * m_options.m_max_payload_size,
+                    payload.data(),
+                    payload.size());
+    }
+
+    // Cannot fail: there are as many queue cells as slots
+    m_pending.try_push({event, slot, static_cast<uint32_t>(payload.size())});
+    return true;
+}
+
+size_t Dispatcher::pump() {
+    std::scoped_lock const lock(m_mutex);
+
+    m_batch.clear();
+    Message message{};
+    while (m_batch.size() < m_batch.capacity() && m_pending.try_pop(message)) {
+        m_batch.push_back(message);
+    }
+    if (m_batch.empty()) { return 0; }
+
+    m_last_index.resize(m_subscriptions.size());
+    for (uint32_t i = 0; i < m_batch.size(); ++i) {
+        if (m_batch[i].m_event < m_last_index.size()) { m_last_index[m_batch[i].m_event] = i; }
+    }
+
+    size_t delivered = 0;
+    for (uint32_t i = 0; i < m_batch.size(); ++i) {
+        const Message& m = m_batch[i];
+        if (m.m_event < m_subscriptions.size()) {
+            // data() rather than operator[]: with a zero payload size the
+            // vector is empty and every event carries an empty payload
+            const std::span<const std::byte> payload(
+                m_payloads.data() + m.m_slot * m_options.m_max_payload_size, m.m_size);
+            for (const auto& subscription : m_subscriptions[m.m_event]) {
+                if (subscription.m_delivery == Delivery::Latest && m_last_index[m.m_event] != i) {
+                    continue;  // Superseded later in this batch
+                }
+                subscription.m_listener->on_event(m.m_event, payload);
+                ++delivered;
+            }
+        }
+        m_free_slots.try_push(m.m_slot);
+    }
+    return delivered;
+}
+
+void Dispatcher::delivery_loop() {
+    while (!m_stop.load(std::memory_order_relaxed)) {
+        pump();
+        std::this_thread::sleep_for(m_options.m_delivery_interval);
+    }
+    pump();
+}
+
 }  // namespace thl
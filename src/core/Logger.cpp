@@ -1,5 +1,8 @@
+#include <tanh/core/BinaryLog.h>
 #include <tanh/core/Logger.h>
+#include <tanh/core/threading/MPMCQueue.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
@@ -7,13 +10,16 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <ios>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #if defined(THL_PLATFORM_ANDROID)
@@ -286,6 +292,7 @@ struct LoggerState {
     Callback m_callback;
 
     std::size_t m_early_buffer_capacity = 64;
+    std::size_t m_rt_ring_capacity = 256;
     std::vector<LogRecord> m_early_callback_buffer;
     std::vector<LogRecord> m_early_file_buffer;
 
@@ -294,6 +301,13 @@ struct LoggerState {
     std::mutex m_file_mutex;
     std::string m_file_path;
     std::ofstream m_file_stream;
+
+    // Protects the binary writer.  Lock ordering: config_mutex before
+    // binary_mutex.
+    std::mutex m_binary_mutex;
+    bool m_binary_enabled = false;
+    BinaryLogWriter::Options m_binary_options;
+    std::unique_ptr<BinaryLogWriter> m_binary_writer;
 };
 
 LoggerState& state() {
@@ -322,6 +336,22 @@ bool emit_file(const LogRecord& record) {
     return true;
 }
 
+// ---------------------------------------------------------------------------
+// Binary sink
+// ---------------------------------------------------------------------------
+
+bool emit_binary(const LogRecord& record) {
+    auto& s = state();
+    std::scoped_lock const lock(s.m_binary_mutex);
+
+    if (s.m_binary_options.m_directory.empty()) { return false; }
+
+    if (!s.m_binary_writer) {
+        s.m_binary_writer = std::make_unique<BinaryLogWriter>(s.m_binary_options);
+    }
+    return s.m_binary_writer->write(record);
+}
+
 // ---------------------------------------------------------------------------
 // Dispatch
 // ---------------------------------------------------------------------------
@@ -377,6 +407,7 @@ void dispatch_record(const LogRecord& record) {
     bool platform_on = false;
     bool console_on = false;
     bool file_on = false;
+    bool binary_on = false;
     bool callback_on = false;
     std::size_t early_cap = 0;
     Callback callback_copy;
@@ -385,6 +416,7 @@ void dispatch_record(const LogRecord& record) {
         platform_on = state().m_platform_enabled;
         console_on = state().m_console_enabled;
         file_on = state().m_file_enabled;
+        binary_on = state().m_binary_enabled;
         callback_on = state().m_callback_enabled;
         early_cap = state().m_early_buffer_capacity;
         callback_copy = state().m_callback;
@@ -417,7 +449,12 @@ void dispatch_record(const LogRecord& record) {
         }
     }
 
-    // 4. Callback sink (gated by callback_enabled + re-entrancy guard).
+    // 4. Binary sink (acquires binary_mutex internally).
+    if (binary_on) {
+        if (emit_binary(record)) { any_sink_ran = true; }
+    }
+
+    // 5. Callback sink (gated by callback_enabled + re-entrancy guard).
     if (callback_copy && callback_on) {
         try {
             CallbackDispatchScope const scope;
@@ -439,10 +476,228 @@ void dispatch_record(const LogRecord& record) {
         }
     }
 
-    // 5. Last-resort fallback if every sink was disabled or failed.
+    // 6. Last-resort fallback if every sink was disabled or failed.
     if (!any_sink_ran) { write_to_default_sink(record); }
 }
 
+// ---------------------------------------------------------------------------
+// Real-time front end
+// ---------------------------------------------------------------------------
+
+using RtRing = MPMCQueue<RtRecord>;
+
+constexpr std::size_t k_rt_shared_ring_capacity = 1024;
+constexpr auto k_rt_drain_interval = std::chrono::milliseconds(2);
+
+struct RtRingSlot {
+    explicit RtRingSlot(std::size_t capacity) : m_ring(capacity) {}
+    RtRing m_ring;
+    std::atomic<bool> m_closed{false};  // owning thread exited
+};
+
+class RtLogger {
+public:
+    RtLogger() {
+        // Construct the sink state first so that it outlives this object
+        state();
+    }
+
+    ~RtLogger() {
+        stop();
+        drain();
+    }
+
+    // Start the drain thread if it is not running. Never called from a
+    // static initializer, so loading the library starts no thread.
+    void start() {
+        std::scoped_lock const lock(m_mutex);
+        if (m_drainer.joinable()) { return; }
+        m_stop.store(false, std::memory_order_relaxed);
+        m_drainer = std::thread([this] {
+            while (!m_stop.load(std::memory_order_relaxed)) {
+                drain();
+                std::this_thread::sleep_for(k_rt_drain_interval);
+            }
+        });
+    }
+
+    void stop() {
+        std::thread drainer;
+        {
+            std::scoped_lock const lock(m_mutex);
+            m_stop.store(true, std::memory_order_relaxed);
+            drainer = std::move(m_drainer);
+        }
+        if (drainer.joinable()) { drainer.join(); }
+    }
+
+    RtLogger(const RtLogger&) = delete;
+    RtLogger& operator=(const RtLogger&) = delete;
+
+    bool submit(const RtRecord& record, RtRingSlot* own) noexcept {
+        const bool pushed = own != nullptr ? own->m_ring.try_push(record)
+                                           : m_shared.try_push(record);
+        (pushed ? m_submitted : m_dropped).fetch_add(1, std::memory_order_relaxed);
+        return pushed;
+    }
+
+    std::shared_ptr<RtRingSlot> register_ring(std::size_t capacity) {
+        auto ring = std::make_shared<RtRingSlot>(capacity);
+        {
+            std::scoped_lock const lock(m_mutex);
+            m_rings.push_back(ring);
+        }
+        start();
+        return ring;
+    }
+
+    // Single drainer at a time; formatting and sinks run outside m_mutex so
+    // that registration never waits on a slow sink.
+    void drain() {
+        std::scoped_lock const drain_lock(m_drain_mutex);
+
+        std::vector<std::shared_ptr<RtRingSlot>> rings;
+        {
+            std::scoped_lock const lock(m_mutex);
+            // Forget rings whose thread exited once they are empty
+            std::erase_if(m_rings, [this](const std::shared_ptr<RtRingSlot>& ring) {
+                if (!ring->m_closed.load(std::memory_order_acquire)) { return false; }
+                drain_ring(ring->m_ring);
+                return true;
+            });
+            rings = m_rings;
+        }
+
+        drain_ring(m_shared);
+        for (const auto& ring : rings) { drain_ring(ring->m_ring); }
+
+        const std::uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+        if (dropped != m_reported_dropped) {
+            const std::string message = "real-time logger dropped " +
+                                        std::to_string(dropped - m_reported_dropped) +
+                                        " records (ring full)";
+            m_reported_dropped = dropped;
+            dispatch_record(make_record(static_cast<std::uint32_t>(LogLevel::Warning),
+                                        "native",
+                                        "thl.core.logger",
+                                        message.c_str()));
+        }
+    }
+
+    RtStats stats() const {
+        return {.m_submitted = m_submitted.load(std::memory_order_relaxed),
+                .m_dropped = m_dropped.load(std::memory_order_relaxed)};
+    }
+
+private:
+    static void drain_ring(RtRing& ring) {
+        RtRecord rt_record;
+        while (ring.try_pop(rt_record)) {
+            try {
+                const std::string message = format_rt_message(rt_record);
+                LogRecord record = make_record(rt_record.m_level, "native", rt_record.m_group,
+                                               message.c_str());
+
+                // Restamp with the time the record was logged, not drained
+                const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count();
+                const auto age_ms =
+                    (static_cast<std::int64_t>(now_ns) -
+                     static_cast<std::int64_t>(rt_record.m_monotonic_ns)) / 1'000'000;
+                record.m_timestamp_ms -= age_ms;
+                record.m_monotonic_ns = rt_record.m_monotonic_ns;
+                dispatch_record(record);
+            } catch (...) {
+                write_to_stderr_fallback(rt_record.m_level, "native", rt_record.m_group,
+                                         rt_record.m_format);
+            }
+        }
+    }
+
+    RtRing m_shared{k_rt_shared_ring_capacity};
+    std::atomic<std::uint64_t> m_submitted{0};
+    std::atomic<std::uint64_t> m_dropped{0};
+    std::uint64_t m_reported_dropped = 0;  // guarded by m_drain_mutex
+
+    std::mutex m_mutex;  // m_rings + drainer start/stop
+    std::mutex m_drain_mutex;
+    std::vector<std::shared_ptr<RtRingSlot>> m_rings;
+    std::atomic<bool> m_stop{false};
+    std::thread m_drainer;
+};
+
+RtLogger& rt_logger() {
+    static RtLogger instance;
+    return instance;
+}
+
+// Construct the logger (its rings, not its drain thread) at load time, so
+// the first rt_submit() from an audio thread does not allocate.
+[[maybe_unused]] const bool k_rt_logger_constructed = (rt_logger(), true);
+
+// The calling thread's ring. The raw pointer is trivially destructible so
+// rt_submit() never triggers TLS destructor registration; the owner exists
+// only on registered threads and closes the ring when the thread exits, so
+// the drainer can forget it after emptying it.
+thread_local RtRingSlot* t_rt_ring = nullptr;
+
+struct RtThreadRingOwner {
+    std::shared_ptr<RtRingSlot> m_slot;
+    ~RtThreadRingOwner() {
+        t_rt_ring = nullptr;
+        if (m_slot) { m_slot->m_closed.store(true, std::memory_order_release); }
+    }
+};
+
+// Expand one conversion spec (without the leading '%') for argument @p i.
+void append_rt_conversion(std::string& out,
+                          const std::string& spec,
+                          char conversion,
+                          const RtRecord& record,
+                          std::uint32_t& next_arg) {
+    if (next_arg >= record.m_num_args) {
+        out += "<missing>";
+        return;
+    }
+    const std::uint32_t i = next_arg++;
+    const RtArgValue value = record.m_args[i];
+
+    std::array<char, 64> buffer{};
+    int written = 0;
+    switch (conversion) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'c': {
+            long long integer = 0;
+            switch (record.m_arg_types[i]) {
+                case RtArgType::Int: integer = value.m_int; break;
+                case RtArgType::Uint: integer = static_cast<long long>(value.m_uint); break;
+                case RtArgType::Float: integer = static_cast<long long>(value.m_float); break;
+            }
+            const std::string full = "%" + spec + "ll" + conversion;
+            written = std::snprintf(buffer.data(), buffer.size(), full.c_str(), integer);
+            break;
+        }
+        default: {
+            double real = 0.0;
+            switch (record.m_arg_types[i]) {
+                case RtArgType::Int: real = static_cast<double>(value.m_int); break;
+                case RtArgType::Uint: real = static_cast<double>(value.m_uint); break;
+                case RtArgType::Float: real = value.m_float; break;
+            }
+            const std::string full = "%" + spec + conversion;
+            written = std::snprintf(buffer.data(), buffer.size(), full.c_str(), real);
+            break;
+        }
+    }
+    if (written > 0) { out.append(buffer.data(), std::min<std::size_t>(written, buffer.size() - 1)); }
+}
+
 }  // namespace
 
 // ---------------------------------------------------------------------------
@@ -460,6 +715,7 @@ void set_config(const LoggerConfig& config) {
         s.m_file_enabled = config.m_file_enabled;
         s.m_callback_enabled = config.m_callback_enabled;
         s.m_early_buffer_capacity = config.m_early_buffer_capacity;
+        s.m_rt_ring_capacity = config.m_rt_ring_capacity;
 
         // Drain the file early buffer when a path becomes available.
         if (config.m_file_enabled && !config.m_file_path.empty()) {
@@ -476,8 +732,26 @@ void set_config(const LoggerConfig& config) {
         s.m_file_path = config.m_file_path;
     }
 
+    {
+        std::scoped_lock const lock(s.m_config_mutex, s.m_binary_mutex);
+        const BinaryLogWriter::Options options{config.m_binary_directory,
+                                               "thl",
+                                               config.m_binary_segment_size,
+                                               config.m_binary_max_segments};
+        const bool options_changed = options.m_directory != s.m_binary_options.m_directory ||
+                                     options.m_segment_size != s.m_binary_options.m_segment_size ||
+                                     options.m_max_segments != s.m_binary_options.m_max_segments;
+        // Closing the writer truncates its segment; the next record reopens
+        if (options_changed || !config.m_binary_enabled) { s.m_binary_writer.reset(); }
+        s.m_binary_options = options;
+        s.m_binary_enabled = config.m_binary_enabled;
+    }
+
     // Replay buffered records into the file sink now that the path is set.
     for (const auto& record : file_buffered) { emit_file(record); }
+
+    // A configured logger delivers real-time records too
+    rt_logger().start();
 }
 
 LoggerConfig get_config() {
@@ -490,11 +764,19 @@ LoggerConfig get_config() {
         config.m_file_enabled = s.m_file_enabled;
         config.m_callback_enabled = s.m_callback_enabled;
         config.m_early_buffer_capacity = s.m_early_buffer_capacity;
+        config.m_rt_ring_capacity = s.m_rt_ring_capacity;
     }
     {
         std::scoped_lock const lock(s.m_file_mutex);
         config.m_file_path = s.m_file_path;
     }
+    {
+        std::scoped_lock const lock(s.m_config_mutex, s.m_binary_mutex);
+        config.m_binary_enabled = s.m_binary_enabled;
+        config.m_binary_directory = s.m_binary_options.m_directory;
+        config.m_binary_segment_size = s.m_binary_options.m_segment_size;
+        config.m_binary_max_segments = s.m_binary_options.m_max_segments;
+    }
     return config;
 }
 
@@ -615,4 +897,79 @@ void debug(const char* group, const char* message) {
     log(LogLevel::Debug, group, message);
 }
 
+// ---------------------------------------------------------------------------
+// Public API -- real-time logging
+// ---------------------------------------------------------------------------
+
+bool rt_submit(RtRecord& record) TANH_NONBLOCKING_FUNCTION {
+    if (!should_log_compiled(record.m_level)) { return true; }
+    record.m_monotonic_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+    return rt_logger().submit(record, t_rt_ring);
+}
+
+void rt_register_thread() {
+    if (t_rt_ring != nullptr) { return; }
+
+    std::size_t capacity = 0;
+    {
+        std::scoped_lock const lock(state().m_config_mutex);
+        capacity = state().m_rt_ring_capacity;
+    }
+    static thread_local RtThreadRingOwner owner;
+    owner.m_slot = rt_logger().register_ring(capacity);
+    t_rt_ring = owner.m_slot.get();
+}
+
+void rt_start() {
+    rt_logger().start();
+}
+
+void rt_stop() {
+    rt_logger().stop();
+    rt_logger().drain();
+}
+
+void rt_flush() {
+    rt_logger().drain();
+}
+
+RtStats rt_stats() {
+    return rt_logger().stats();
+}
+
+std::string format_rt_message(const RtRecord& record) {
+    std::string out;
+    if (record.m_format == nullptr) { return out; }
+
+    std::uint32_t next_arg = 0;
+    for (const char* c = record.m_format; *c != '\0'; ++c) {
+        if (*c != '%') {
+            out += *c;
+            continue;
+        }
+        if (*(c + 1) == '%') {
+            out += '%';
+            ++c;
+            continue;
+        }
+
+        // Flags, width and precision are kept; length modifiers are replaced
+        // by the record's own argument width.
+        std::string spec;
+        ++c;
+        while (*c != '\0' && std::strchr("-+ #0123456789.", *c) != nullptr) { spec += *c++; }
+        while (*c != '\0' && std::strchr("hljztL", *c) != nullptr) { ++c; }
+        if (*c == '\0') { break; }
+        if (std::strchr("diuxXocfFeEgGaA", *c) != nullptr) {
+            append_rt_conversion(out, spec, *c, record, next_arg);
+        } else {
+            out += '?';  // Non-numeric conversion (%s, %p, ...)
+        }
+    }
+    return out;
+}
+
 }  // namespace thl::Logger
@@ -0,0 +1,58 @@
+#include <tanh/core/threading/RCU.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace thl {
+
+namespace {
+
+// Claims are rare (once per thread), so a mutex-guarded table is enough.
+// Generations are published atomically for generation_of().
+std::mutex g_slot_mutex;
+std::array<std::atomic<uint64_t>, RCUReaderSlot::k_count> g_slot_generations{};
+uint64_t g_next_generation = 1;
+
+void release_slot(uint32_t index) {
+    const std::scoped_lock lock(g_slot_mutex);
+    g_slot_generations[index].store(0, std::memory_order_relaxed);
+}
+
+// Returns the calling thread's slot to the pool when the thread exits.
+struct SlotRelease {
+    uint32_t m_index = RCUReaderSlot::k_count;
+    ~SlotRelease() {
+        if (m_index < RCUReaderSlot::k_count) { release_slot(m_index); }
+    }
+};
+
+thread_local SlotRelease t_slot_release;
+
+}  // namespace
+
+RCUReaderSlot RCUReaderSlot::claim() {
+    RCUReaderSlot slot;
+    slot.m_claimed = true;
+    {
+        const std::scoped_lock lock(g_slot_mutex);
+        for (uint32_t i = 0; i < k_count; ++i) {
+            if (g_slot_generations[i].load(std::memory_order_relaxed) == 0) {
+                slot.m_index = i;
+                slot.m_generation = g_next_generation++;
+                g_slot_generations[i].store(slot.m_generation, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    t_slot_release.m_index = slot.m_index;
+    return slot;
+}
+
+uint64_t RCUReaderSlot::generation_of(uint32_t index) noexcept {
+    if (index >= k_count) { return 0; }
+    return g_slot_generations[index].load(std::memory_order_relaxed);
+}
+
+}  // namespace thl
@@ -0,0 +1,120 @@
+#include <tanh/core/threading/WorkerPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+#if defined(THL_PLATFORM_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace thl {
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+void pin_current_thread(size_t cpu) {
+#if defined(THL_PLATFORM_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    // Best effort: a restricted cpuset or container may refuse the mask.
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+}  // namespace
+
+WorkerPool::WorkerPool(Options options) : m_spin_iterations(options.m_spin_iterations) {
+    const size_t num_cpus = std::max<size_t>(1, std::thread::hardware_concurrency());
+    m_workers.reserve(options.m_num_workers);
+    for (size_t i = 0; i < options.m_num_workers; ++i) {
+        m_workers.emplace_back([this, i, pin = options.m_pin_threads, num_cpus]() {
+            if (pin) { pin_current_thread((i + 1) % num_cpus); }
+            worker_loop();
+        });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    m_stop.store(true, std::memory_order_seq_cst);
+    m_generation.fetch_add(1, std::memory_order_seq_cst);
+    m_generation.notify_all();
+    for (auto& worker : m_workers) { worker.join(); }
+}
+
+void WorkerPool::run(size_t count, JobFunction function, void* context) TANH_NONBLOCKING_FUNCTION {
+    if (count == 0) { return; }
+    if (m_workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) { function(context, i); }
+        return;
+    }
+
+    m_count = count;
+    m_function = function;
+    m_context = context;
+    m_next_index.store(0, std::memory_order_relaxed);
+    const uint64_t generation = m_generation.fetch_add(1, std::memory_order_seq_cst) + 1;
+    // Only pay for the futex wake when somebody is actually asleep.
+    if (m_sleeping.load(std::memory_order_seq_cst) > 0) { m_generation.notify_all(); }
+
+    execute_jobs();
+
+    // Every index has been claimed. Close the generation so that late
+    // wakers stay out, then wait for workers still running a claimed index.
+    m_closed_generation.store(generation, std::memory_order_seq_cst);
+    while (m_active.load(std::memory_order_seq_cst) != 0) { cpu_relax(); }
+}
+
+void WorkerPool::execute_jobs() {
+    for (;;) {
+        const size_t index = m_next_index.fetch_add(1, std::memory_order_relaxed);
+        if (index >= m_count) { return; }
+        m_function(m_context, index);
+    }
+}
+
+void WorkerPool::worker_loop() {
+    uint64_t seen = 0;
+    for (;;) {
+        // Spin first: the next block's job usually arrives within a period.
+        uint64_t current = m_generation.load(std::memory_order_acquire);
+        for (uint32_t i = 0; current == seen && i < m_spin_iterations; ++i) {
+            cpu_relax();
+            current = m_generation.load(std::memory_order_acquire);
+        }
+        if (current == seen) {
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            m_generation.wait(seen, std::memory_order_seq_cst);
+            m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            current = m_generation.load(std::memory_order_acquire);
+        }
+        seen = current;
+
+        if (m_stop.load(std::memory_order_acquire)) { return; }
+
+        // Announce before touching the job, then re-check that the caller has
+        // not already closed this generation (and possibly started the next).
+        m_active.fetch_add(1, std::memory_order_seq_cst);
+        if (m_closed_generation.load(std::memory_order_seq_cst) < seen) { execute_jobs(); }
+        m_active.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+}  // namespace thl
@@ -4,6 +4,7 @@
 #include <span>
 
 #include "tanh/dsp/audio/AudioBufferView.h"
+#include "tanh/dsp/utils/ChangePointMask.h"
 #include "tanh/utils/RealtimeSanitizer.h"
 
 namespace thl::dsp {
@@ -20,6 +21,20 @@ void BaseProcessor::process_modulated(const thl::dsp::audio::AudioBufferView& bu
     split_and_process(buffer, change_points);
 }
 
+// Bitset counterpart of the index-list split below, walking set bits with ctz
+void BaseProcessor::split_and_process(const thl::dsp::audio::AudioBufferView& buffer,
+                                      const utils::ChangePointMask& change_points)
+    TANH_NONBLOCKING_FUNCTION {
+    uint32_t pos = 0;
+    const auto total = static_cast<uint32_t>(buffer.get_num_frames());
+    change_points.for_each([&](uint32_t cp) {
+        if (cp <= pos || cp >= total) { return; }
+        process(buffer.sub_block(pos, cp - pos), pos);
+        pos = cp;
+    });
+    if (pos < total) { process(buffer.sub_block(pos, total - pos), pos); }
+}
+
 void BaseProcessor::split_and_process(const thl::dsp::audio::AudioBufferView& buffer,
                                       std::span<const uint32_t> change_points)
     TANH_NONBLOCKING_FUNCTION {
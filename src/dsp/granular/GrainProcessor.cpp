@@ -18,11 +18,7 @@ GrainProcessorImpl::GrainProcessorImpl(audio::AudioDataStore& audio_store)
     : m_audio_store(audio_store)
     , m_random_generator(std::random_device{}())
     , m_uni_dist(0.0f, 1.0f) {
-    // Prepare grain container
-    m_grains.resize(m_max_grains);
-
-    // Initialize all grains as inactive
-    for (auto& grain : m_grains) { grain.m_active = false; }
+    m_grains.prepare(m_max_grains);
 }
 
 GrainProcessorImpl::~GrainProcessorImpl() = default;
@@ -48,8 +44,12 @@ void GrainProcessorImpl::set_visualization_update_rate(float fps) {
     }
 }
 
+void GrainProcessorImpl::set_max_grains(size_t max_grains) {
+    m_max_grains = std::max<size_t>(max_grains, 1);
+}
+
 void GrainProcessorImpl::reset_grains() {
-    for (auto& grain : m_grains) { grain.m_active = false; }
+    m_grains.release_all();
     m_sequential_position = 0;
     m_next_grain_time = 0;
     m_last_playing_state = false;
@@ -63,9 +63,11 @@ void GrainProcessorImpl::prepare(const double& sample_rate,
     m_sample_rate = sample_rate;
     m_channels = num_channels;
 
-    for (auto& grain : m_grains) {
-        grain.m_envelope.set_sample_rate(static_cast<float>(m_sample_rate));
-    }
+    // Live grains were set up for the old sample rate. Finish them so
+    // listeners get on_grain_finished, and reallocate only when the
+    // polyphony changed; trigger_grain() sets up each new grain's envelope
+    m_grains.for_each([this](Grain& grain) { finish_grain(grain); });
+    if (m_grains.capacity() != m_max_grains) { m_grains.prepare(m_max_grains); }
     m_next_grain_time = 0;
 
     m_envelope.set_sample_rate(static_cast<float>(m_sample_rate));
@@ -117,19 +119,22 @@ void GrainProcessorImpl::process(thl::dsp::audio::AudioBufferView buffer,
     if (!m_envelope.is_active() || !m_audio_store.is_loaded()) {
         // Deactivate any lingering grains and notify visualization
         if (!m_viz_listeners.empty()) {
-            for (size_t gi = 0; gi < m_grains.size(); ++gi) {
-                if (m_grains[gi].m_active) {
-                    m_grains[gi].m_active = false;
-                    for (auto* l : m_viz_listeners) { l->on_grain_finished(static_cast<int>(gi)); }
-                }
-            }
+            m_grains.for_each([this](Grain& grain) {
+                const auto gi = static_cast<int>(m_grains.index_of(&grain));
+                m_grains.release(&grain);
+                for (auto* l : m_viz_listeners) { l->on_grain_finished(gi); }
+            });
             for (auto* l : m_viz_listeners) { l->on_master_envelope_updated(0.f); }
         }
         return;
     }
 
-    // Process existing grains and generate new ones
-    update_grains(channel_ptrs.data(), num_samples, modulation_offset);
+    // Process existing grains and generate new ones. The read section keeps
+    // the sample data alive across a concurrent reload.
+    {
+        const auto read = m_audio_store.begin_read();
+        update_grains(read.buffer(), channel_ptrs.data(), num_samples, modulation_offset);
+    }
 
     // Apply master volume
     for (size_t i = 0; i < num_samples; i++) {
@@ -179,10 +184,10 @@ void GrainProcessorImpl::update_envelope_if_needed(uint32_t modulation_offset) {
     }
 }
 
-void GrainProcessorImpl::update_grains(float** buffer,
+void GrainProcessorImpl::update_grains(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                                       float** buffer,
                                        size_t n_buffer_frames,
                                        uint32_t modulation_offset) {
-    const auto& audio_data = m_audio_store.get_buffer();
     float const density = get_parameter<float>(Density, modulation_offset);
 
     // Calculate how frequently we should trigger new grains
@@ -232,7 +237,7 @@ void GrainProcessorImpl::update_grains(float** buffer,
     for (unsigned int i = 0; i < n_buffer_frames; i++) {
         // Check if it's time to trigger a new grain
         if (m_next_grain_time <= 0) {
-            trigger_grain(sample_index, modulation_offset);
+            trigger_grain(audio_data, sample_index, modulation_offset);
             m_next_grain_time = m_min_grain_interval - 1;
         } else {
             m_next_grain_time--;
@@ -242,10 +247,7 @@ void GrainProcessorImpl::update_grains(float** buffer,
         std::array<float, k_max_channel_support> channel_accum{};
 
         // Process all active grains
-        for (size_t gi = 0; gi < m_grains.size(); ++gi) {
-            auto& grain = m_grains[gi];
-            if (!grain.m_active) { continue; }
-
+        m_grains.for_each([&](Grain& grain) {
             // Hann window envelope for amplitude control
             float const normalized_position = static_cast<float>(grain.m_current_position) /
                                               static_cast<float>(grain.m_grain_size);
@@ -253,9 +255,8 @@ void GrainProcessorImpl::update_grains(float** buffer,
 
             // Check if the grain should be deactivated
             if (!grain.m_envelope.is_active() || normalized_position >= 1.0f) {
-                grain.m_active = false;
-                for (auto* l : m_viz_listeners) { l->on_grain_finished(static_cast<int>(gi)); }
-                continue;
+                finish_grain(grain);
+                return;
             }
 
             // Calculate the current position in the source audio
@@ -271,7 +272,7 @@ void GrainProcessorImpl::update_grains(float** buffer,
                     float mono_sample = 0.0f;
                     for (size_t ch = 0; ch < source_channels; ++ch) {
                         float s = 0.0f;
-                        read_sample(source_pos, grain.m_sample_index, ch, s);
+                        read_sample(audio_data, source_pos, grain.m_sample_index, ch, s);
                         mono_sample += s;
                     }
                     if (source_channels > 1) { mono_sample /= static_cast<float>(source_channels); }
@@ -282,9 +283,9 @@ void GrainProcessorImpl::update_grains(float** buffer,
                 }
                 case ChannelMode::TrueStereo: {
                     float s0 = 0.0f, s1 = 0.0f;
-                    read_sample(source_pos, grain.m_sample_index, 0, s0);
+                    read_sample(audio_data, source_pos, grain.m_sample_index, 0, s0);
                     if (source_channels > 1) {
-                        read_sample(source_pos, grain.m_sample_index, 1, s1);
+                        read_sample(audio_data, source_pos, grain.m_sample_index, 1, s1);
                     } else {
                         s1 = s0;
                     }
@@ -297,7 +298,7 @@ void GrainProcessorImpl::update_grains(float** buffer,
                     size_t const out_channels = std::min(m_channels, source_channels);
                     for (size_t ch = 0; ch < out_channels; ++ch) {
                         float s = 0.0f;
-                        read_sample(source_pos, grain.m_sample_index, ch, s);
+                        read_sample(audio_data, source_pos, grain.m_sample_index, ch, s);
                         // Even channels (0,2,...) get left energy, odd channels
                         // (1,3,...) get right energy
                         float const energy = (ch % 2 == 0) ? (1.0f - position_spread) * 2.0f
@@ -313,11 +314,8 @@ void GrainProcessorImpl::update_grains(float** buffer,
             grain.m_current_position++;
 
             // Deactivate if grain is finished
-            if (grain.m_current_position >= grain.m_grain_size) {
-                grain.m_active = false;
-                for (auto* l : m_viz_listeners) { l->on_grain_finished(static_cast<int>(gi)); }
-            }
-        }
+            if (grain.m_current_position >= grain.m_grain_size) { finish_grain(grain); }
+        });
 
         // Write to output buffer (planar layout)
         for (size_t ch = 0; ch < m_channels; ++ch) { buffer[ch][i] = channel_accum[ch]; }
@@ -336,9 +334,8 @@ void GrainProcessorImpl::update_grains(float** buffer,
             float const master_env = m_envelope.get_current_level();
             for (auto* l : m_viz_listeners) { l->on_master_envelope_updated(master_env); }
 
-            for (size_t gi = 0; gi < m_grains.size(); ++gi) {
-                auto& grain = m_grains[gi];
-                if (!grain.m_active) { continue; }
+            m_grains.for_each([&](Grain& grain) {
+                const auto gi = static_cast<int>(m_grains.index_of(&grain));
                 float const current_pos =
                     (static_cast<float>(grain.m_start_position) +
                      static_cast<float>(grain.m_current_position) * grain.m_velocity) /
@@ -347,90 +344,89 @@ void GrainProcessorImpl::update_grains(float** buffer,
                                                   static_cast<float>(grain.m_grain_size);
                 float const envelope = grain.m_envelope.process_at_position(normalized_position);
                 for (auto* l : m_viz_listeners) {
-                    l->on_grain_updated(static_cast<int>(gi), current_pos, envelope);
+                    l->on_grain_updated(gi, current_pos, envelope);
                 }
-            }
+            });
         }
     }
 }
 
-void GrainProcessorImpl::trigger_grain(const size_t sample_index, uint32_t modulation_offset) {
-    const auto& audio_data = m_audio_store.get_buffer();
-
-    // Find an inactive grain slot
-    for (size_t gi = 0; gi < m_grains.size(); ++gi) {
-        auto& grain = m_grains[gi];
-        if (!grain.m_active) {
-            if (sample_index >= audio_data.size() || audio_data[sample_index].empty()) { return; }
-
-            // Get parameters needed for grain_size setup
-            float const grain_size_param = get_parameter<float>(Size, modulation_offset);
-            float const size_temperature = get_parameter<float>(TemperatureSize, modulation_offset);
-
-            size_t grain_size = calculate_grain_size(grain_size_param, size_temperature);
-
-            float velocity = get_parameter<float>(Velocity, modulation_offset);
-            float const velocity_temperature =
-                get_parameter<float>(TemperatureVelocity, modulation_offset);
-            velocity = calculate_velocity(velocity, velocity_temperature);
-
-            // Apply sample start/end/loop region
-            size_t const total_frames = audio_data[sample_index].get_num_frames();
-            auto region = compute_sample_region(total_frames, modulation_offset);
-            if (region.size() == 0) { return; }
-
-            auto effective_grain_size =
-                static_cast<size_t>(std::ceil(static_cast<float>(grain_size) * velocity));
-
-            float const position_temperature = apply_temperature_ramp(
-                get_parameter<float>(TemperaturePosition, modulation_offset));
-            long const start_position = calculate_start_position(region, position_temperature);
-
-            // Truncate grain if it would overshoot past region end
-            long const end_frame = static_cast<long>(region.m_end);
-            long const grain_end = start_position + static_cast<long>(effective_grain_size);
-            if (grain_end > end_frame) {
-                effective_grain_size =
-                    static_cast<size_t>(std::max(0L, end_frame - start_position));
-                if (effective_grain_size == 0) { return; }
-                grain_size = std::max(
-                    size_t(1),
-                    static_cast<size_t>(static_cast<float>(effective_grain_size) / velocity));
-            }
+void GrainProcessorImpl::trigger_grain(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                                       const size_t sample_index,
+                                       uint32_t modulation_offset) {
 
-            // Setup the grain
-            grain.m_start_position = start_position;
-            grain.m_current_position = 0;
-            grain.m_grain_size = grain_size;
-            grain.m_velocity = velocity;
-            grain.m_active = true;
-            grain.m_sample_index = sample_index;
-            grain.m_position_spread = m_uni_dist(m_random_generator);
-
-            // Get the grain duration in milliseconds
-            float const grain_duration_ms =
-                (static_cast<float>(grain_size) / static_cast<float>(m_sample_rate)) * 1000.0f;
-
-            // Configure the Hann window envelope
-            grain.m_envelope.set_sample_rate(static_cast<float>(m_sample_rate));
-            grain.m_envelope.set_duration(grain_duration_ms);
-            grain.m_envelope.start();
-
-            // Notify visualization listeners
-            for (auto* l : m_viz_listeners) {
-                auto total = static_cast<float>(total_frames);
-                l->on_grain_triggered(static_cast<int>(gi),
-                                      static_cast<float>(start_position) / total,
-                                      static_cast<float>(effective_grain_size) / total,
-                                      velocity,
-                                      grain_duration_ms);
-            }
+    // Every grain slot is busy
+    if (m_grains.full()) { return; }
+    if (sample_index >= audio_data.size() || audio_data[sample_index].empty()) { return; }
 
-            return;
-        }
+    // Get parameters needed for grain_size setup
+    float const grain_size_param = get_parameter<float>(Size, modulation_offset);
+    float const size_temperature = get_parameter<float>(TemperatureSize, modulation_offset);
+
+    size_t grain_size = calculate_grain_size(grain_size_param, size_temperature);
+
+    float velocity = get_parameter<float>(Velocity, modulation_offset);
+    float const velocity_temperature = get_parameter<float>(TemperatureVelocity, modulation_offset);
+    velocity = calculate_velocity(velocity, velocity_temperature);
+
+    // Apply sample start/end/loop region
+    size_t const total_frames = audio_data[sample_index].get_num_frames();
+    auto region = compute_sample_region(total_frames, modulation_offset);
+    if (region.size() == 0) { return; }
+
+    auto effective_grain_size =
+        static_cast<size_t>(std::ceil(static_cast<float>(grain_size) * velocity));
+
+    float const position_temperature =
+        apply_temperature_ramp(get_parameter<float>(TemperaturePosition, modulation_offset));
+    long const start_position = calculate_start_position(region, position_temperature);
+
+    // Truncate grain if it would overshoot past region end
+    long const end_frame = static_cast<long>(region.m_end);
+    long const grain_end = start_position + static_cast<long>(effective_grain_size);
+    if (grain_end > end_frame) {
+        effective_grain_size = static_cast<size_t>(std::max(0L, end_frame - start_position));
+        if (effective_grain_size == 0) { return; }
+        grain_size = std::max(
+            size_t(1), static_cast<size_t>(static_cast<float>(effective_grain_size) / velocity));
+    }
+
+    // Setup the grain
+    Grain& grain = *m_grains.acquire();
+    grain.m_start_position = start_position;
+    grain.m_current_position = 0;
+    grain.m_grain_size = grain_size;
+    grain.m_velocity = velocity;
+    grain.m_sample_index = sample_index;
+    grain.m_position_spread = m_uni_dist(m_random_generator);
+
+    // Get the grain duration in milliseconds
+    float const grain_duration_ms =
+        (static_cast<float>(grain_size) / static_cast<float>(m_sample_rate)) * 1000.0f;
+
+    // Configure the Hann window envelope
+    grain.m_envelope.set_sample_rate(static_cast<float>(m_sample_rate));
+    grain.m_envelope.set_duration(grain_duration_ms);
+    grain.m_envelope.start();
+
+    // Notify visualization listeners
+    const auto gi = static_cast<int>(m_grains.index_of(&grain));
+    for (auto* l : m_viz_listeners) {
+        auto total = static_cast<float>(total_frames);
+        l->on_grain_triggered(gi,
+                              static_cast<float>(start_position) / total,
+                              static_cast<float>(effective_grain_size) / total,
+                              velocity,
+                              grain_duration_ms);
     }
 }
 
+void GrainProcessorImpl::finish_grain(Grain& grain) {
+    const auto gi = static_cast<int>(m_grains.index_of(&grain));
+    m_grains.release(&grain);
+    for (auto* l : m_viz_listeners) { l->on_grain_finished(gi); }
+}
+
 size_t GrainProcessorImpl::calculate_grain_size(float grain_size_param, float temperature) {
     auto min_size = static_cast<size_t>(k_min_grain_size * m_sample_rate);
     auto max_size = static_cast<size_t>(k_max_grain_size * m_sample_rate);
@@ -529,14 +525,13 @@ GrainProcessorImpl::SampleRegion GrainProcessorImpl::compute_sample_region(
     return SampleRegion{start, end, loop};
 }
 
-void GrainProcessorImpl::read_sample(float position,
+void GrainProcessorImpl::read_sample(const std::vector<thl::dsp::audio::AudioBuffer>& audio_data,
+                                     float position,
                                      size_t sample_index,
                                      size_t source_channel,
                                      float& out_sample) {
     out_sample = 0.0f;
 
-    const auto& audio_data = m_audio_store.get_buffer();
-
     // Bounds checking
     if (sample_index >= audio_data.size() || audio_data[sample_index].empty()) { return; }
 
@@ -48,7 +48,7 @@ using ::thl::dsp::utils::ParameterInterpolator;
 void RingsModalResonator::prepare(float sample_rate) {
     m_sample_rate = sample_rate;
 
-    for (auto& i : m_f) { i.reset(); }
+    m_f.reset();
 
     set_frequency(220.0f / m_sample_rate);
     set_structure(0.25f);
@@ -80,7 +80,7 @@ int32_t RingsModalResonator::compute_filters() {
         } else {
             num_modes = i + 1;
         }
-        m_f[i].set_f_q<Approximation::Fast>(partial_frequency, 1.0f + partial_frequency * q);
+        m_f.set_f_q<Approximation::Fast>(i, partial_frequency, 1.0f + partial_frequency * q);
         stretch_factor += stiff;
         if (stiff < 0.0f) {
             // Make sure that the partials do not fold back into negative
@@ -114,21 +114,20 @@ void RingsModalResonator::process(const thl::dsp::audio::ConstAudioBufferView& i
     }
     int32_t const num_modes = m_num_modes;
 
+    // Modes are processed in pairs, so an odd count also runs the next one.
+    const int32_t num_processed = std::min(num_modes + (num_modes & 1), k_max_modes);
+
     ParameterInterpolator position(m_previous_position, m_position, size);
     while (size--) {
         CosineOscillator amplitudes;
         amplitudes.prepare<thl::dsp::utils::CosineOscillatorMode::Approximate>(position.next());
+        amplitudes.start();
+        for (int32_t i = 0; i < num_processed; ++i) { m_amplitudes[i] = amplitudes.next(); }
 
         float const input = *in_ptr++ * 0.125f;
         float odd = 0.0f;
         float even = 0.0f;
-        amplitudes.start();
-        for (int32_t i = 0; i < num_modes;) {
-            odd +=
-                amplitudes.next() * m_f[i++].process<thl::dsp::filter::FilterMode::BandPass>(input);
-            even +=
-                amplitudes.next() * m_f[i++].process<thl::dsp::filter::FilterMode::BandPass>(input);
-        }
+        m_f.process(input, m_amplitudes.data(), static_cast<size_t>(num_processed), odd, even);
         *out_ptr++ = odd;
         *aux_ptr++ = even;
     }
@@ -2,123 +2,285 @@
 
 #include <tanh/state/ModulationScope.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <span>
 #include <vector>
 
 namespace thl::modulation {
 
-InputEventQueue::InputEventQueue(thl::modulation::ModulationScope scope, size_t queue_capacity)
-    : m_event_queue(queue_capacity), m_queue_capacity(queue_capacity), m_scope(scope) {}
+namespace {
+// Dispositions stored in drain_timed()'s offsets next to real block offsets (>= 0).
+constexpr int64_t k_offset_untimed = -1;
+constexpr int64_t k_offset_retain = std::numeric_limits<int64_t>::max();
+constexpr int64_t k_offset_drop = std::numeric_limits<int64_t>::min();
+}  // namespace
+
+InputEventQueue::InputEventQueue(thl::modulation::ModulationScope scope,
+                                 size_t queue_capacity,
+                                 size_t pending_capacity)
+    : m_event_queue(queue_capacity)
+    , m_queue_capacity(queue_capacity)
+    , m_pending_capacity(pending_capacity)
+    , m_scope(scope) {}
 
 void InputEventQueue::prepare(uint32_t num_voices) {
     // Global scope carries the mono stream only — per-voice buckets are not
     // allocated regardless of the num_voices argument (the matrix passes
     // voice_count(global) == 1, which would otherwise spuriously allocate a
-    // voice bucket that push_voice_* can never reach). Non-global: size the
-    // voice-bucket array to match the scope's voice count.
-    if (has_mono()) {
-        m_num_voices = 0;
-        m_voice_indices.clear();
-    } else {
-        m_num_voices = num_voices;
-        m_voice_indices.resize(m_num_voices);
-    }
+    // voice bucket that push_voice_* can never reach). Non-global: one
+    // bucket per voice of the scope.
+    m_num_voices = has_mono() ? 0 : num_voices;
 
-    // Pre-reserve every audio-thread-local vector so drain_spread never
-    // allocates on the hot path. Worst case: all drained events target the
-    // same stream, so each bucket needs queue_capacity capacity.
-    m_drain_buffer.clear();
-    m_drain_buffer.reserve(m_queue_capacity);
+    // Size the scratch arena for the worst case so neither drain allocates:
+    // every event of a drain in the same stream. drain_timed() sees the
+    // carried-over events plus a full SPSC queue, and needs three int64
+    // arrays for them (offsets, due samples and the overflow cut).
+    const size_t timed_capacity = m_pending_capacity + m_queue_capacity;
+    m_scratch.clear_requirements();
+    m_scratch.reserve<Event>(m_queue_capacity);
+    m_scratch.reserve<size_t>(num_streams() * timed_capacity);
+    m_scratch.reserve<uint32_t>(num_streams());
+    m_scratch.reserve<int64_t>(3 * timed_capacity);
+    m_scratch.prepare();
 
-    if (has_mono()) {
-        m_mono_indices.clear();
-        m_mono_indices.reserve(m_queue_capacity);
-    }
-
-    for (auto& bucket : m_voice_indices) {
-        bucket.clear();
-        bucket.reserve(m_queue_capacity);
-    }
+    m_pending.clear();
+    m_pending.reserve(timed_capacity);
+    m_num_dropped_late = 0;
+    m_num_dropped_overflow = 0;
 }
 
-bool InputEventQueue::push_mono_value(float value) {
+bool InputEventQueue::push_mono_value(float value, Timestamp time) {
     assert(has_mono() && "push_mono_value on a voice-only queue");
     Event const e{.m_type = EventType::Value,
                   .m_is_mono = true,
                   .m_voice = 0,
                   .m_active = false,
-                  .m_value = value};
+                  .m_value = value,
+                  .m_time = time};
     return m_event_queue.try_enqueue(e);
 }
 
-bool InputEventQueue::push_mono_active(bool active) {
+bool InputEventQueue::push_mono_active(bool active, Timestamp time) {
     assert(has_mono() && "push_mono_active on a voice-only queue");
     Event const e{.m_type = EventType::Active,
                   .m_is_mono = true,
                   .m_voice = 0,
                   .m_active = active,
-                  .m_value = 0.0f};
+                  .m_value = 0.0f,
+                  .m_time = time};
     return m_event_queue.try_enqueue(e);
 }
 
-bool InputEventQueue::push_voice_value(uint32_t voice, float value) {
+bool InputEventQueue::push_voice_value(uint32_t voice, float value, Timestamp time) {
     assert(m_num_voices > 0 && "push_voice_value on a mono-only queue");
     assert(voice < m_num_voices && "voice index out of range");
     Event const e{.m_type = EventType::Value,
                   .m_is_mono = false,
                   .m_voice = static_cast<uint8_t>(voice),
                   .m_active = false,
-                  .m_value = value};
+                  .m_value = value,
+                  .m_time = time};
     return m_event_queue.try_enqueue(e);
 }
 
-bool InputEventQueue::push_voice_active(uint32_t voice, bool active) {
+bool InputEventQueue::push_voice_active(uint32_t voice, bool active, Timestamp time) {
     assert(m_num_voices > 0 && "push_voice_active on a mono-only queue");
     assert(voice < m_num_voices && "voice index out of range");
     Event const e{.m_type = EventType::Active,
                   .m_is_mono = false,
                   .m_voice = static_cast<uint8_t>(voice),
                   .m_active = active,
-                  .m_value = 0.0f};
+                  .m_value = 0.0f,
+                  .m_time = time};
     return m_event_queue.try_enqueue(e);
 }
 
-size_t InputEventQueue::drain_spread(uint32_t block_size, const OnEvent& cb) {
-    // 1. Snapshot the SPSC queue into pre-reserved scratch (no allocation).
-    m_drain_buffer.clear();
-    Event evt{};  // NOLINT(misc-const-correctness) — mutated by try_dequeue
-    while (m_event_queue.try_dequeue(evt)) { m_drain_buffer.push_back(evt); }
-    if (m_drain_buffer.empty()) { return 0; }
+InputEventQueue::Buckets InputEventQueue::make_buckets(size_t stride) {
+    Buckets buckets;
+    buckets.m_stride = stride;
+    buckets.m_indices = m_scratch.allocate<size_t>(num_streams() * stride);
+    buckets.m_counts = m_scratch.allocate<uint32_t>(num_streams());
+    std::fill(buckets.m_counts.begin(), buckets.m_counts.end(), 0U);
+    return buckets;
+}
 
-    // 2. Bucket events by stream (mono or per-voice). Stable within bucket.
-    if (has_mono()) { m_mono_indices.clear(); }
-    for (auto& bucket : m_voice_indices) { bucket.clear(); }
+void InputEventQueue::add_to_bucket(Buckets& buckets, const Event& e, size_t index) const {
+    size_t stream = 0;
+    if (e.m_is_mono) {
+        if (!has_mono()) { return; }
+    } else {
+        if (e.m_voice >= m_num_voices) { return; }
+        stream = e.m_voice;
+    }
+    buckets.m_indices[stream * buckets.m_stride + buckets.m_counts[stream]++] = index;
+}
 
-    for (size_t i = 0; i < m_drain_buffer.size(); ++i) {
-        const Event& e = m_drain_buffer[i];
-        if (e.m_is_mono) {
-            if (has_mono()) { m_mono_indices.push_back(i); }
-        } else {
-            if (e.m_voice < m_num_voices) { m_voice_indices[e.m_voice].push_back(i); }
-        }
+size_t InputEventQueue::drain_spread(uint32_t block_size, const OnEvent& cb) {
+    m_scratch.reset();
+
+    // 1. Snapshot the SPSC queue into the scratch arena (no allocation).
+    const std::span<Event> drained = m_scratch.allocate<Event>(m_queue_capacity);
+    size_t num_drained = 0;
+    while (num_drained < drained.size() && m_event_queue.try_dequeue(drained[num_drained])) {
+        ++num_drained;
     }
+    if (num_drained == 0) { return 0; }
+
+    // 2. Bucket events by stream (mono or per-voice). Stable within bucket.
+    Buckets buckets = make_buckets(m_queue_capacity);
+    for (size_t i = 0; i < num_drained; ++i) { add_to_bucket(buckets, drained[i], i); }
 
     // 3. Spread within each bucket independently. FIFO preserved per stream.
-    auto dispatch_bucket = [&](const std::vector<size_t>& idx) {
+    for (size_t stream = 0; stream < num_streams(); ++stream) {
+        const std::span<size_t> idx = buckets.bucket(stream);
         const size_t n = idx.size();
-        if (n == 0) { return; }
         for (size_t i = 0; i < n; ++i) {
             const auto offset = static_cast<uint32_t>((i * static_cast<size_t>(block_size)) / n);
-            cb(m_drain_buffer[idx[i]], offset);
+            cb(drained[idx[i]], offset);
         }
-    };
+    }
+
+    return num_drained;
+}
 
-    if (has_mono()) { dispatch_bucket(m_mono_indices); }
-    for (uint32_t v = 0; v < m_num_voices; ++v) { dispatch_bucket(m_voice_indices[v]); }
+size_t InputEventQueue::drain_timed(uint32_t block_size,
+                                    const BlockTiming& timing,
+                                    const OnEvent& cb) {
+    // 1. Append the whole SPSC queue to the carried-over events. At most
+    //    pending_capacity events are carried over, so a full queue always
+    //    fits the reservation and no due event is left behind in it.
+    const size_t timed_capacity = m_pending_capacity + m_queue_capacity;
+    Event evt{};  // NOLINT(misc-const-correctness) — mutated by try_dequeue
+    while (m_pending.size() < timed_capacity && m_event_queue.try_dequeue(evt)) {
+        m_pending.push_back(evt);
+    }
+    if (m_pending.empty()) { return 0; }
+    m_scratch.reset();
+
+    // 2. Resolve each event's offset within this block, or its disposition.
+    const auto block_end = static_cast<int64_t>(block_size);
+    const int64_t latency =
+        timing.m_late_policy == LatePolicy::Defer ? static_cast<int64_t>(timing.m_defer_latency) : 0;
+
+    const std::span<int64_t> offsets = m_scratch.allocate<int64_t>(m_pending.size());
+    const std::span<int64_t> due = m_scratch.allocate<int64_t>(m_pending.size());
+    size_t num_retained = 0;
+    for (size_t i = 0; i < m_pending.size(); ++i) {
+        const Event& e = m_pending[i];
+        int64_t offset = k_offset_untimed;
+        switch (e.m_time.m_base) {
+            case Timestamp::Base::None: break;
+            case Timestamp::Base::Sample:
+                offset = static_cast<int64_t>(e.m_time.m_sample) -
+                         static_cast<int64_t>(timing.m_block_start_sample) + latency;
+                break;
+            case Timestamp::Base::Host:
+                assert(timing.m_sample_rate > 0.0 && "host timestamps need a sample rate");
+                offset = std::llround((e.m_time.m_host_seconds -
+                                       timing.m_block_start_host_seconds) *
+                                      timing.m_sample_rate) +
+                         latency;
+                break;
+        }
+        due[i] = offset;
+        if (e.m_time.m_base != Timestamp::Base::None) {
+            if (offset >= block_end) {
+                offset = k_offset_retain;
+                ++num_retained;
+            } else if (offset < 0) {
+                if (timing.m_late_policy == LatePolicy::Drop) {
+                    offset = k_offset_drop;
+                    ++m_num_dropped_late;
+                } else {
+                    offset = 0;
+                }
+            }
+        }
+        offsets[i] = offset;
+    }
+
+    // 3. Bucket this block's events by stream. Stable within bucket.
+    Buckets buckets = make_buckets(timed_capacity);
+    for (size_t i = 0; i < m_pending.size(); ++i) {
+        if (offsets[i] == k_offset_retain || offsets[i] == k_offset_drop) { continue; }
+        add_to_bucket(buckets, m_pending[i], i);
+    }
+
+    // 4. Per bucket: spread the untimed events as drain_spread does, then
+    //    order by offset (insertion sort — stable, in place, and buckets are
+    //    short and mostly sorted already) and dispatch.
+    size_t dispatched = 0;
+    for (size_t stream = 0; stream < num_streams(); ++stream) {
+        const std::span<size_t> idx = buckets.bucket(stream);
+        const size_t n = idx.size();
+        if (n == 0) { continue; }
+
+        size_t num_untimed = 0;
+        for (const size_t i : idx) {
+            if (offsets[i] == k_offset_untimed) { ++num_untimed; }
+        }
+        size_t k = 0;
+        for (const size_t i : idx) {
+            if (offsets[i] != k_offset_untimed) { continue; }
+            offsets[i] = static_cast<int64_t>((k++ * static_cast<size_t>(block_size)) / num_untimed);
+        }
+
+        for (size_t a = 1; a < n; ++a) {
+            const size_t moving = idx[a];
+            size_t b = a;
+            while (b > 0 && offsets[idx[b - 1]] > offsets[moving]) {
+                idx[b] = idx[b - 1];
+                --b;
+            }
+            idx[b] = moving;
+        }
+
+        for (const size_t i : idx) { cb(m_pending[i], static_cast<uint32_t>(offsets[i])); }
+        dispatched += n;
+    }
+
+    // 5. Keep only the events due in a later block, in arrival order. Events
+    //    addressed to a stream this queue does not have are discarded, as in
+    //    drain_spread. Past pending_capacity, the latest-due events go:
+    //    everything due before the cut is kept, and ties at the cut are kept
+    //    in arrival order while there is room.
+    int64_t cut = k_offset_retain;
+    size_t room_at_cut = m_pending_capacity;
+    if (num_retained > m_pending_capacity) {
+        m_num_dropped_overflow += num_retained - m_pending_capacity;
+        if (m_pending_capacity == 0) {
+            cut = k_offset_drop;
+        } else {
+            const std::span<int64_t> retained_due = m_scratch.allocate<int64_t>(num_retained);
+            size_t r = 0;
+            for (size_t i = 0; i < m_pending.size(); ++i) {
+                if (offsets[i] == k_offset_retain) { retained_due[r++] = due[i]; }
+            }
+            const auto nth = retained_due.begin() + static_cast<ptrdiff_t>(m_pending_capacity - 1);
+            std::nth_element(retained_due.begin(), nth, retained_due.end());
+            cut = *nth;
+            room_at_cut -= static_cast<size_t>(
+                std::count_if(retained_due.begin(), nth, [cut](int64_t d) { return d < cut; }));
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < m_pending.size(); ++i) {
+        if (offsets[i] != k_offset_retain || due[i] > cut) { continue; }
+        if (due[i] == cut) {
+            if (room_at_cut == 0) { continue; }
+            --room_at_cut;
+        }
+        m_pending[kept++] = m_pending[i];
+    }
+    m_pending.resize(kept);
 
-    return m_drain_buffer.size();
+    return dispatched;
 }
 
 }  // namespace thl::modulation
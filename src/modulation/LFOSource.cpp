@@ -67,6 +67,15 @@ float LFOSourceImpl::generate_sample_basic(float phase, LFOWaveform waveform, fl
 }
 
 void LFOSourceImpl::process(size_t num_samples, size_t offset) {
+    // The output only changes on decimation ticks, so a whole-block render
+    // describes itself as one constant segment per tick (plus the value held
+    // over from the previous block when sample 0 is not a tick). Slow or
+    // heavily decimated LFOs fit in a handful of segments. Partial renders
+    // (the cyclic path's per-sample calls, short blocks) describe nothing.
+    const bool describe_segments = offset == 0 && num_samples == block_size();
+    if (describe_segments && num_samples > 0 && m_samples_until_update != 0) {
+        declare_output_segment(0, m_last_output);
+    }
     for (size_t i = offset; i < offset + num_samples; ++i) {
         const auto sample_idx = static_cast<uint32_t>(i);
 
@@ -144,6 +153,7 @@ void LFOSourceImpl::process(size_t num_samples, size_t offset) {
             m_last_output = std::clamp(shaped * depth * m_fade_in_value, -1.0f, 1.0f);
             m_samples_until_update = decimation == 0 ? 1 : decimation;
             record_change_point(sample_idx);
+            if (describe_segments) { declare_output_segment(sample_idx, m_last_output); }
         }
         --m_samples_until_update;
 
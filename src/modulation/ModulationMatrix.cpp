@@ -4,15 +4,18 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <optional>
+#include <span>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -24,6 +27,8 @@
 #include <vector>
 
 #include "tanh/core/Logger.h"
+#include "tanh/core/threading/WorkerPool.h"
+#include "tanh/dsp/utils/ChangePointMask.h"
 #include "tanh/modulation/ModulationRouting.h"
 #include "tanh/modulation/ResolvedRouting.h"
 #include "tanh/modulation/ResolvedTarget.h"
@@ -31,7 +36,9 @@
 #include "tanh/state/ModulationScope.h"
 #include "tanh/state/Parameter.h"
 #include "tanh/state/ParameterDefinitions.h"
+#include "tanh/state/BinarySnapshot.h"
 #include "tanh/state/State.h"
+#include "tanh/dsp/utils/SimdFloat.h"
 #include "tanh/utils/RealtimeSanitizer.h"
 
 using namespace thl::modulation;
@@ -42,20 +49,24 @@ float ResolvedTarget::read_base_as_float() const TANH_NONBLOCKING_FUNCTION {
     if (!m_record) { return 0.0f; }
     switch (m_type) {
         case thl::ParameterType::Float:
-            return m_record->m_cache.m_atomic_float.load(std::memory_order_relaxed);
+            return m_record->m_cache.m_atomic_float->load(std::memory_order_relaxed);
         case thl::ParameterType::Double:
             return static_cast<float>(
-                m_record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                m_record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
         case thl::ParameterType::Int:
             return static_cast<float>(
-                m_record->m_cache.m_atomic_int.load(std::memory_order_relaxed));
+                m_record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
         case thl::ParameterType::Bool:
-            return m_record->m_cache.m_atomic_bool.load(std::memory_order_relaxed) ? 1.0f : 0.0f;
+            return m_record->m_cache.m_atomic_bool->load(std::memory_order_relaxed) ? 1.0f : 0.0f;
         default: return 0.0f;
     }
 }
 
-ModulationMatrix::ModulationMatrix(thl::State& state) : m_state(state) {
+ModulationMatrix::ModulationMatrix(thl::State& state)
+    : ModulationMatrix(state, thl::DeferredReclaimer::shared()) {}
+
+ModulationMatrix::ModulationMatrix(thl::State& state, thl::DeferredReclaimer& reclaimer)
+    : m_state(state), m_reclaimer(reclaimer) {
     // Pre-register Global scope at id 0 with voice_count == 1. The name is
     // the reserved "global" string from k_global_scope_name —
     // hosts cannot register it (register_scope rejects "global").
@@ -146,7 +157,7 @@ thl::modulation::ModulationScope ModulationMatrix::register_scope(std::string_vi
                                   voice_count,
                                   m_scopes[i].m_voice_count);
                 m_scopes[i].m_voice_count = voice_count;
-                rebuild_schedule_with_lock();
+                request_rebuild_with_lock();
             }
             return ModulationScope{.m_id = static_cast<uint16_t>(i), .m_name = m_scopes[i].m_name};
         }
@@ -229,7 +240,7 @@ void ModulationMatrix::set_voice_count(ModulationScope scope, uint32_t new_voice
             source->prepare(m_sample_rate, m_samples_per_block, new_voice_count);
         }
     }
-    rebuild_schedule_with_lock();
+    request_rebuild_with_lock();
 }
 
 thl::modulation::ModulationScope ModulationMatrix::resolve_parameter_scope_with_lock(
@@ -283,7 +294,7 @@ void ModulationMatrix::prepare(double sample_rate, size_t samples_per_block) {
 }
 
 void ModulationMatrix::process(size_t num_samples) TANH_NONBLOCKING_FUNCTION {
-    const auto scope = m_config.read_scope();
+    const auto scope = read_scope();
     process_with_scope(scope.data(), num_samples);
 }
 
@@ -298,8 +309,14 @@ void ModulationMatrix::process_with_scope(const ProcessingConfig& config,
     //    clear_output_active() / clear_voice_output_active() from it.
     //
     //    Runs *before* pre_process_block so event-driven sources that write
-    //    CPs during draining don't have them immediately wiped.
-    for (auto* source : config.m_all_sources) { source->clear_per_block(); }
+    //    CPs during draining don't have them immediately wiped. Piecewise-
+    //    constant output descriptions are always dropped here; a source
+    //    re-declares them from pre_process_block() / process() for the block
+    //    it renders.
+    for (auto* source : config.m_all_sources) {
+        source->clear_output_segments();
+        source->clear_per_block();
+    }
 
     // 2. Drain pass — every registered source consumes its event queue and
     //    freezes per-block input state (values + masks + CPs). Runs exactly
@@ -311,10 +328,23 @@ void ModulationMatrix::process_with_scope(const ProcessingConfig& config,
 
     // 3. Target per-block reset. Targets are pure aggregators of multiple
     //    sources; everything they hold is block-local and must be cleared.
+    //    Only voices written during the previous block touch their dense
+    //    storage; idle targets reset a few per-voice scalars.
     for (auto* target : config.m_active_targets) { target->clear_per_block(); }
 
-    // 4. Execute schedule steps
-    for (const auto& step : config.m_schedule) {
+    // 4. Execute schedule steps. With a worker pool attached, render waves
+    //    (runs of independent BulkSteps) are rendered in parallel and joined
+    //    before their routings are applied; everything else runs serially.
+    auto wave = config.m_render_waves.begin();
+    const auto waves_end = config.m_worker_pool != nullptr ? config.m_render_waves.end() : wave;
+    for (size_t s = 0; s < config.m_schedule.size();) {
+        if (wave != waves_end && wave->m_first_step == s) {
+            process_render_wave_with_scope(config, *wave, num_samples);
+            s += wave->m_num_steps;
+            ++wave;
+            continue;
+        }
+        const auto& step = config.m_schedule[s++];
         if (auto* bulk = std::get_if<BulkStep>(&step)) {
             process_source_bulk_with_scope(config, bulk->m_source, num_samples);
         } else if (auto* cyclic = std::get_if<CyclicStep>(&step)) {
@@ -335,6 +365,15 @@ void ModulationMatrix::process_with_scope(const ProcessingConfig& config,
     m_num_processed_samples += num_samples;
 }
 
+void ModulationMatrix::set_worker_pool(thl::WorkerPool* pool) {
+    std::scoped_lock const lock(m_writer_mutex);
+    m_worker_pool = pool;
+    // Wait out in-flight blocks so no audio block still holds the previous
+    // pool when this returns.
+    rebuild_schedule_with_lock();
+    m_config.synchronize();
+}
+
 void ModulationMatrix::add_source(const std::string_view id, ModulationSource* source) {
     std::scoped_lock const lock(m_writer_mutex);
 
@@ -368,11 +407,11 @@ void ModulationMatrix::add_source(const std::string_view id, ModulationSource* s
     auto it = m_sources.find(id);
     if (it != m_sources.end()) {
         it->second = source;
-        rebuild_schedule_with_lock();
+        request_rebuild_with_lock();
         return;
     }
     m_sources.emplace(std::string(id), source);
-    rebuild_schedule_with_lock();
+    request_rebuild_with_lock();
 }
 
 void ModulationMatrix::remove_source(const std::string_view id) {
@@ -439,7 +478,7 @@ uint32_t ModulationMatrix::add_routing(const ModulationRouting& routing) {
     const uint32_t id = m_next_routing_id++;
     m_user_routings.push_back(routing);
     m_user_routings.back().m_id = id;
-    rebuild_schedule_with_lock();
+    request_rebuild_with_lock();
     return id;
 }
 
@@ -448,14 +487,14 @@ void ModulationMatrix::remove_routing(std::string_view source_id, std::string_vi
     std::erase_if(m_user_routings, [&](const ModulationRouting& r) {
         return r.m_source_id == source_id && r.m_target_id == target_id;
     });
-    rebuild_schedule_with_lock();
+    request_rebuild_with_lock();
 }
 
 void ModulationMatrix::remove_routing(uint32_t routing_id) {
     std::scoped_lock const lock(m_writer_mutex);
     std::erase_if(m_user_routings,
                   [&](const ModulationRouting& r) { return r.m_id == routing_id; });
-    rebuild_schedule_with_lock();
+    request_rebuild_with_lock();
 }
 
 // ── Private routing helpers ──────────────────────────────────────────────────
@@ -629,11 +668,33 @@ void ModulationMatrix::rebuild_schedule() {
     rebuild_schedule_with_lock();
 }
 
+ModulationMatrix::Batch ModulationMatrix::begin_batch() {
+    std::scoped_lock const lock(m_writer_mutex);
+    ++m_batch_depth;
+    return Batch(this);
+}
+
+void ModulationMatrix::end_batch() {
+    std::scoped_lock const lock(m_writer_mutex);
+    if (--m_batch_depth > 0 || !m_rebuild_pending) { return; }
+    rebuild_schedule_with_lock();
+}
+
+void ModulationMatrix::request_rebuild_with_lock() {
+    if (m_batch_depth > 0) {
+        m_rebuild_pending = true;
+        return;
+    }
+    rebuild_schedule_with_lock();
+}
+
 std::vector<ScheduleStep> ModulationMatrix::get_schedule() const {
     return m_config.read([](const ProcessingConfig& config) { return config.m_schedule; });
 }
 
 void ModulationMatrix::rebuild_schedule_with_lock() {
+    m_rebuild_pending = false;
+
     // ── Pass 1: Validate routings by scope and collect per-target needs ──
     //
     // Scope validity table (src.scope × tgt.scope):
@@ -931,6 +992,38 @@ void ModulationMatrix::rebuild_schedule_with_lock() {
     std::vector<ScheduleStep> new_schedule;
     build_schedule_from_graph(source_ids, adj, has_self_edge, new_schedule);
 
+    // Group runs of consecutive BulkSteps into render waves. A step joins the
+    // current wave when its source opts into concurrent rendering, has
+    // routings (unrouted sources are never rendered), and does not depend on
+    // any source already in the wave; otherwise it starts a new wave or, if
+    // ineligible, ends the current one.
+    std::unordered_set<const ModulationSource*> routed_sources;
+    for (const auto& r : new_routings) { routed_sources.insert(r.m_source); }
+    std::unordered_map<const ModulationSource*, const std::string*> source_id_of;
+    for (auto& [id, source] : m_sources) { source_id_of[source] = &id; }
+
+    std::vector<RenderWave> new_render_waves;
+    std::unordered_set<std::string> wave_members;
+    for (size_t s = 0; s < new_schedule.size(); ++s) {
+        const auto* bulk = std::get_if<BulkStep>(&new_schedule[s]);
+        if (bulk == nullptr || !routed_sources.contains(bulk->m_source) ||
+            !bulk->m_source->supports_concurrent_render()) {
+            wave_members.clear();
+            continue;
+        }
+        const std::string& id = *source_id_of.at(bulk->m_source);
+        const auto& deps = adj[id];
+        const bool depends_on_wave = std::any_of(deps.begin(), deps.end(), [&](const auto& dep) {
+            return wave_members.contains(dep);
+        });
+        if (wave_members.empty() || depends_on_wave) {
+            new_render_waves.push_back({.m_first_step = s, .m_num_steps = 0});
+            wave_members.clear();
+        }
+        ++new_render_waves.back().m_num_steps;
+        wave_members.insert(id);
+    }
+
     // Collect active target pointers — only targets with resolved routings
     std::vector<ResolvedTarget*> new_active_targets;
     new_active_targets.reserve(target_info.size());
@@ -951,20 +1044,20 @@ void ModulationMatrix::rebuild_schedule_with_lock() {
         config.m_schedule = std::move(new_schedule);
         config.m_active_targets = std::move(new_active_targets);
         config.m_all_sources = std::move(new_all_sources);
+        config.m_render_waves = std::move(new_render_waves);
+        config.m_worker_pool = m_worker_pool;
         config.m_routings_by_source.clear();
         for (const auto& r : config.m_routings) {
             config.m_routings_by_source[r.m_source].push_back(&r);
         }
     });
 
-    // Drain retired buffers. After m_config.update() the old ProcessingConfig
-    // is retired into the RCU's deferred-reclamation list; after synchronize()
-    // returns, every in-flight audio block that was still inside a ReadScope
-    // has left it, so the target-owned buffer pointers they may have read are
-    // guaranteed to be past their last use. Only then is it safe to destroy
-    // the retired VoiceBuffers / MonoBuffers instances.
-    m_config.synchronize();
+    // Hand retired buffers to the reclaimer. They were unpublished above, so
+    // it destroys them once every ReadScope that could have loaded them has
+    // closed — the writer never waits for the audio thread.
     for (auto& [id, target] : m_targets) {
+        for (auto& buffers : target.m_voice_retired) { m_reclaimer.retire(std::move(buffers)); }
+        for (auto& buffers : target.m_mono_retired) { m_reclaimer.retire(std::move(buffers)); }
         target.m_voice_retired.clear();
         target.m_mono_retired.clear();
     }
@@ -1209,6 +1302,295 @@ inline float compute_replace_value(const ResolvedRouting& routing,
     return src_sample * routing.m_depth_abs_precomputed.load(std::memory_order_relaxed);
 }
 
+// ── Block kernels ────────────────────────────────────────────────────────────
+//
+// Vector paths for the common case of a fully-active source. Every sample is
+// live, so the per-sample Replace state machine above collapses to
+// block-constant bookkeeping (phase start, held value, freshness) plus a
+// data-parallel write. Mask-gated sources keep the per-sample helpers: their
+// held / freshness state depends on the previous sample.
+
+using thl::dsp::utils::simd::FloatBatch;
+
+// Replace value as an affine map of the source sample, with the routing's
+// atomics loaded once per block. Evaluates exactly like
+// compute_replace_value(): offset + (src * depth) * range.
+struct ReplaceAffine {
+    float m_offset;
+    float m_depth;
+    float m_range;
+
+    [[nodiscard]] float operator()(float src) const { return m_offset + src * m_depth * m_range; }
+};
+
+inline ReplaceAffine load_replace_affine(const ResolvedRouting& routing) TANH_NONBLOCKING_FUNCTION {
+    if (routing.m_has_replace_range.load(std::memory_order_relaxed)) {
+        const float raw_depth = routing.m_depth.load(std::memory_order_relaxed);
+        const float rmin = routing.m_replace_range_min.load(std::memory_order_relaxed);
+        const float rmax = routing.m_replace_range_max.load(std::memory_order_relaxed);
+        const float span = rmax - rmin;
+        if (raw_depth >= 0.0f) { return {rmin, std::abs(raw_depth), span}; }
+        return {rmax, std::abs(raw_depth), -span};
+    }
+    return {0.0f, routing.m_depth_abs_precomputed.load(std::memory_order_relaxed), 1.0f};
+}
+
+// out[i] += in[i] * depth
+inline void additive_kernel(float* out,
+                            const float* in,
+                            float depth,
+                            size_t n) TANH_NONBLOCKING_FUNCTION {
+    const FloatBatch d = FloatBatch::broadcast(depth);
+    size_t i = 0;
+    for (; i + FloatBatch::k_width <= n; i += FloatBatch::k_width) {
+        (FloatBatch::load(out + i) + FloatBatch::load(in + i) * d).store(out + i);
+    }
+    for (; i < n; ++i) { out[i] += in[i] * depth; }
+}
+
+// out[i] += in[i] * depth where active[i]. The byte mask is widened to a 0/1
+// lane factor so the accumulation stays branch-free.
+inline void additive_gated_kernel(float* out,
+                                  const float* in,
+                                  const uint8_t* active,
+                                  float depth,
+                                  size_t n) TANH_NONBLOCKING_FUNCTION {
+    const FloatBatch d = FloatBatch::broadcast(depth);
+    float gate[FloatBatch::k_width];
+    size_t i = 0;
+    for (; i + FloatBatch::k_width <= n; i += FloatBatch::k_width) {
+        for (size_t j = 0; j < FloatBatch::k_width; ++j) {
+            gate[j] = active[i + j] != 0 ? 1.0f : 0.0f;
+        }
+        const FloatBatch contribution = FloatBatch::load(in + i) * d * FloatBatch::load(gate);
+        (FloatBatch::load(out + i) + contribution).store(out + i);
+    }
+    for (; i < n; ++i) {
+        if (active[i]) { out[i] += in[i] * depth; }
+    }
+}
+
+using OutputSegments = std::span<const ModulationSource::OutputSegment>;
+
+// Calls fn(begin, end, value) for every declared output segment, clipped to
+// [0, n).
+template <typename Fn>
+inline void for_each_output_segment(OutputSegments segments,
+                                    size_t n,
+                                    Fn&& fn) TANH_NONBLOCKING_FUNCTION {
+    for (size_t k = 0; k < segments.size(); ++k) {
+        const size_t begin = segments[k].m_start;
+        if (begin >= n) { break; }
+        const size_t end =
+            k + 1 < segments.size() ? std::min<size_t>(segments[k + 1].m_start, n) : n;
+        fn(begin, end, segments[k].m_value);
+    }
+}
+
+// Value of the segment covering sample n - 1 (n > 0).
+inline float last_segment_value(OutputSegments segments, size_t n) TANH_NONBLOCKING_FUNCTION {
+    float value = segments.front().m_value;
+    for (const auto& segment : segments) {
+        if (segment.m_start >= n) { break; }
+        value = segment.m_value;
+    }
+    return value;
+}
+
+// additive_kernel for a piecewise-constant source: out[i] += value * depth
+// per segment, without reading the source buffer.
+inline void additive_segments_kernel(float* out,
+                                     OutputSegments segments,
+                                     float depth,
+                                     size_t n) TANH_NONBLOCKING_FUNCTION {
+    for_each_output_segment(segments, n, [&](size_t begin, size_t end, float value) {
+        const float contribution = value * depth;
+        const FloatBatch c = FloatBatch::broadcast(contribution);
+        size_t i = begin;
+        for (; i + FloatBatch::k_width <= end; i += FloatBatch::k_width) {
+            (FloatBatch::load(out + i) + c).store(out + i);
+        }
+        for (; i < end; ++i) { out[i] += contribution; }
+    });
+}
+
+// Single-Replace write for a piecewise-constant source: one fill per segment.
+inline void replace_segments_kernel(float* replace_buf,
+                                    uint8_t* active_buf,
+                                    OutputSegments segments,
+                                    const ReplaceAffine& affine,
+                                    size_t n) TANH_NONBLOCKING_FUNCTION {
+    for_each_output_segment(segments, n, [&](size_t begin, size_t end, float value) {
+        std::fill(replace_buf + begin, replace_buf + end, affine(value));
+    });
+    std::memset(active_buf, 1, n);
+}
+
+// out[i] = affine(in[i])
+inline void replace_values_kernel(float* out,
+                                  const float* in,
+                                  const ReplaceAffine& affine,
+                                  size_t n) TANH_NONBLOCKING_FUNCTION {
+    const FloatBatch offset = FloatBatch::broadcast(affine.m_offset);
+    const FloatBatch depth = FloatBatch::broadcast(affine.m_depth);
+    const FloatBatch range = FloatBatch::broadcast(affine.m_range);
+    size_t i = 0;
+    for (; i + FloatBatch::k_width <= n; i += FloatBatch::k_width) {
+        (offset + FloatBatch::load(in + i) * depth * range).store(out + i);
+    }
+    for (; i < n; ++i) { out[i] = affine(in[i]); }
+}
+
+// Bitmask over [0, count), count ≤ 64, of the samples where a writer with
+// (prio, fresh) beats the per-sample watermark — the same predicate as in
+// apply_replace_sample.
+inline uint64_t replace_wins_mask(const uint32_t* priority_buf,
+                                  const uint64_t* freshness_buf,
+                                  uint32_t prio,
+                                  uint64_t fresh,
+                                  size_t count) TANH_NONBLOCKING_FUNCTION {
+    uint64_t mask = 0;
+    for (size_t j = 0; j < count; ++j) {
+        const bool wins = (prio > priority_buf[j]) |
+                          ((prio == priority_buf[j]) & (fresh >= freshness_buf[j]));
+        mask |= static_cast<uint64_t>(wins) << j;
+    }
+    return mask;
+}
+
+// Fully-active Replace write of one block into one (mono or voice) buffer
+// set. Single-Replace targets (priority_buf == nullptr) write
+// unconditionally; contended targets resolve 64-sample chunks through
+// replace_wins_mask, taking a dense path when one writer wins the chunk
+// outright and a ctz walk otherwise.
+inline void replace_block_kernel(float* replace_buf,
+                                 uint8_t* active_buf,
+                                 uint32_t* priority_buf,
+                                 uint64_t* freshness_buf,
+                                 const float* in,
+                                 const ReplaceAffine& affine,
+                                 uint32_t prio,
+                                 uint64_t fresh,
+                                 size_t n) TANH_NONBLOCKING_FUNCTION {
+    if (priority_buf == nullptr) {
+        replace_values_kernel(replace_buf, in, affine, n);
+        std::memset(active_buf, 1, n);
+        return;
+    }
+
+    constexpr size_t k_chunk = 64;
+    for (size_t base = 0; base < n; base += k_chunk) {
+        const size_t count = std::min(k_chunk, n - base);
+        const uint64_t all = count == k_chunk ? ~uint64_t{0} : (uint64_t{1} << count) - 1;
+
+        // Priorities decide most chunks on their own: a min/max reduction
+        // (which vectorizes) settles "wins everywhere" / "loses everywhere"
+        // before any per-sample freshness compare.
+        const auto [lo, hi] = std::minmax_element(priority_buf + base, priority_buf + base + count);
+        uint64_t mask = 0;
+        if (prio > *hi) {
+            mask = all;
+        } else if (prio == *lo && prio == *hi) {
+            // Uniform priority: freshness alone decides, and it is usually
+            // uniform per chunk too (one earlier writer).
+            const auto [f_lo, f_hi] =
+                std::minmax_element(freshness_buf + base, freshness_buf + base + count);
+            if (fresh >= *f_hi) {
+                mask = all;
+            } else if (fresh >= *f_lo) {
+                mask = replace_wins_mask(
+                    priority_buf + base, freshness_buf + base, prio, fresh, count);
+            }
+        } else if (prio >= *lo) {
+            mask = replace_wins_mask(priority_buf + base, freshness_buf + base, prio, fresh, count);
+        }
+        if (mask == 0) { continue; }
+
+        if (mask == all) {
+            replace_values_kernel(replace_buf + base, in + base, affine, count);
+            std::memset(active_buf + base, 1, count);
+            std::fill_n(priority_buf + base, count, prio);
+            std::fill_n(freshness_buf + base, count, fresh);
+            continue;
+        }
+        for (uint64_t m = mask; m != 0; m &= m - 1) {
+            const size_t i = base + static_cast<size_t>(std::countr_zero(m));
+            replace_buf[i] = affine(in[i]);
+            active_buf[i] = 1;
+            priority_buf[i] = prio;
+            freshness_buf[i] = fresh;
+        }
+    }
+}
+
+// ORs the source change points below num_samples into num_targets packed
+// change-point bitsets laid out target_stride words apart. Points are
+// accumulated per word, so each target word is touched once per run of
+// points that share it rather than once per point. Returns whether any bit
+// was written, so callers can mark the targets dirty.
+inline bool merge_change_points(const std::vector<uint32_t>& points,
+                                size_t num_samples,
+                                uint64_t* words,
+                                size_t num_targets,
+                                size_t target_stride) TANH_NONBLOCKING_FUNCTION {
+    constexpr size_t k_bits = thl::dsp::utils::k_change_point_word_bits;
+    size_t word = SIZE_MAX;
+    uint64_t bits = 0;
+    bool wrote = false;
+    const auto flush = [&] {
+        if (bits == 0) { return; }
+        for (size_t t = 0; t < num_targets; ++t) { words[t * target_stride + word] |= bits; }
+        wrote = true;
+    };
+    for (const uint32_t cp : points) {
+        if (cp >= num_samples) { continue; }
+        if (cp / k_bits != word) {
+            flush();
+            word = cp / k_bits;
+            bits = 0;
+        }
+        bits |= uint64_t{1} << (cp % k_bits);
+    }
+    flush();
+    return wrote;
+}
+
+// Block-level equivalent of num_samples calls to apply_replace_sample with
+// src_active = true: advances the routing's mono state from the block's last
+// source sample and returns the freshness every sample is written with.
+inline uint64_t advance_replace_state_mono(const ResolvedRouting& routing,
+                                           const ReplaceAffine& affine,
+                                           float last_in,
+                                           size_t num_samples,
+                                           uint64_t block_offset) TANH_NONBLOCKING_FUNCTION {
+    if (!routing.m_was_active_prev) { routing.m_active_phase_start = block_offset; }
+    routing.m_was_active_prev = true;
+    routing.m_last_active_sample = block_offset + num_samples - 1;
+    routing.m_held_value = affine(last_in);
+    routing.m_held_mono_active = true;
+    return k_live_freshness_bit | routing.m_active_phase_start;
+}
+
+// Per-voice counterpart of advance_replace_state_mono. The freshness vectors
+// only exist on contended targets.
+inline uint64_t advance_replace_state_voice(const ResolvedRouting& routing,
+                                            const ReplaceAffine& affine,
+                                            float last_in,
+                                            size_t num_samples,
+                                            uint64_t block_offset,
+                                            uint32_t voice,
+                                            bool contended) TANH_NONBLOCKING_FUNCTION {
+    routing.m_held_voice_values[voice] = affine(last_in);
+    routing.m_held_voice_active[voice] = 1;
+    if (!contended) { return 0; }
+    if (routing.m_voice_was_active_prev[voice] == 0) {
+        routing.m_voice_active_phase_start[voice] = block_offset;
+    }
+    routing.m_voice_was_active_prev[voice] = 1;
+    routing.m_voice_last_active_sample[voice] = block_offset + num_samples - 1;
+    return k_live_freshness_bit | routing.m_voice_active_phase_start[voice];
+}
+
 // GlobalToGlobal: write to mono additive or mono replace buffer.
 //
 // Flag-gate rationale (applies to every apply_routing_* helper and to the
@@ -1218,8 +1600,8 @@ inline float compute_replace_value(const ResolvedRouting& routing,
 //   1. writer atomically publishes fresh VoiceBuffers / MonoBuffers on each
 //      target (with the new set of m_has_additive / m_has_replace flags);
 //   2. writer publishes the new ProcessingConfig via m_config.update;
-//   3. writer calls m_config.synchronize() to drain in-flight readers;
-//   4. writer reclaims retired buffers.
+//   3. writer retires the old buffers to the DeferredReclaimer;
+//   4. the reclaimer destroys them once in-flight readers have left.
 //
 // Between steps 1 and 2, an audio block that entered its RCU read scope
 // before step 2 is still executing the *old* routings — a routing that was
@@ -1227,12 +1609,12 @@ inline float compute_replace_value(const ResolvedRouting& routing,
 // loads already points at the *new* buffer (step 1 already happened). If the
 // new buffer's flag set has shrunk (e.g. the last Additive routing for this
 // target was removed, so m_has_additive went true → false), the old routing
-// will try to touch m_additive_storage / m_change_point_flags_storage etc.
+// will try to touch m_additive_storage / m_change_point_bits_storage etc.
 // that were never allocated on the new buffer → assert / UB.
 //
 // Gating on the flags we just loaded from the atomic-published buffer turns
 // that stale write into a safe no-op. Correctness for the *next* block is
-// restored automatically because step 3 guarantees it sees the new config.
+// restored automatically: any block that starts after step 2 sees the new config.
 void apply_routing_global_to_global(const ResolvedRouting& routing,
                                     const ModulationSource* source,
                                     size_t num_samples,
@@ -1240,37 +1622,68 @@ void apply_routing_global_to_global(const ResolvedRouting& routing,
     auto* mb = routing.m_target->m_mono.load(std::memory_order_acquire);
     if (mb == nullptr) { return; }
     const auto& src_output = source->get_output_buffer();
+    // A block-constant, fully-active source folds into a still-uniform
+    // target as one value; a piecewise-constant one is applied per segment;
+    // anything else goes through the dense buffers.
+    const OutputSegments segments =
+        source->is_fully_active() ? source->output_segments() : OutputSegments{};
+    const bool uniform = segments.size() == 1 && !mb->m_dense;
     if (routing.m_combine_mode == CombineMode::Additive) {
         if (!mb->m_has_additive) { return; }
         const float depth = routing.m_depth_abs_precomputed.load(std::memory_order_relaxed);
-        if (source->is_fully_active()) {
-            for (size_t i = 0; i < num_samples; ++i) {
-                mb->m_additive_buffer[i] += src_output[i] * depth;
-            }
+        if (depth == 0.0f) { return; }
+        if (uniform) {
+            mb->m_uniform_additive += segments.front().m_value * depth;
+            return;
+        }
+        mb->make_dense();
+        if (!segments.empty()) {
+            additive_segments_kernel(mb->m_additive_buffer.data(), segments, depth, num_samples);
+        } else if (source->is_fully_active()) {
+            additive_kernel(mb->m_additive_buffer.data(), src_output.data(), depth, num_samples);
         } else {
-            for (size_t i = 0; i < num_samples; ++i) {
-                if (source->get_output_active_at(static_cast<uint32_t>(i))) {
-                    mb->m_additive_buffer[i] += src_output[i] * depth;
-                }
-            }
+            additive_gated_kernel(mb->m_additive_buffer.data(),
+                                  src_output.data(),
+                                  source->get_output_active().data(),
+                                  depth,
+                                  num_samples);
         }
     } else {
         if (!mb->m_has_replace) { return; }
         uint32_t* prio_buf = mb->m_has_replace_priority ? mb->m_replace_priority.data() : nullptr;
         uint64_t* fresh_buf = mb->m_has_replace_priority ? mb->m_replace_freshness.data() : nullptr;
         if (source->is_fully_active()) {
-            for (size_t i = 0; i < num_samples; ++i) {
-                apply_replace_sample(routing,
-                                     mb->m_replace_buffer.data(),
-                                     mb->m_replace_active.data(),
-                                     prio_buf,
-                                     fresh_buf,
-                                     i,
-                                     block_offset,
-                                     compute_replace_value(routing, src_output[i]),
-                                     true);
+            if (num_samples == 0) { return; }
+            const ReplaceAffine affine = load_replace_affine(routing);
+            const float last_in = segments.empty() ? src_output[num_samples - 1]
+                                                   : last_segment_value(segments, num_samples);
+            const uint64_t fresh =
+                advance_replace_state_mono(routing, affine, last_in, num_samples, block_offset);
+            if (prio_buf == nullptr && uniform) {
+                mb->m_uniform_replace = affine(segments.front().m_value);
+                mb->m_uniform_replace_active = true;
+                return;
+            }
+            mb->make_dense();
+            if (prio_buf == nullptr && !segments.empty()) {
+                replace_segments_kernel(mb->m_replace_buffer.data(),
+                                        mb->m_replace_active.data(),
+                                        segments,
+                                        affine,
+                                        num_samples);
+                return;
             }
+            replace_block_kernel(mb->m_replace_buffer.data(),
+                                 mb->m_replace_active.data(),
+                                 prio_buf,
+                                 fresh_buf,
+                                 src_output.data(),
+                                 affine,
+                                 routing.m_replace_priority,
+                                 fresh,
+                                 num_samples);
         } else {
+            mb->make_dense();
             for (size_t i = 0; i < num_samples; ++i) {
                 const bool active = source->get_output_active_at(static_cast<uint32_t>(i));
                 apply_replace_sample(routing,
@@ -1295,52 +1708,77 @@ void apply_routing_scoped_to_scoped(const ResolvedRouting& routing,
     auto* vb = routing.m_target->m_voice.load(std::memory_order_acquire);
     if (vb == nullptr) { return; }
     const uint32_t nv = std::min(source->num_voices(), vb->m_num_voices);
+    // Per-voice counterpart of the segment handling in
+    // apply_routing_global_to_global.
+    const auto segments_of = [&](uint32_t v) {
+        return source->is_fully_active() ? source->voice_output_segments(v) : OutputSegments{};
+    };
     if (routing.m_combine_mode == CombineMode::Additive) {
         // See flag-gate rationale on apply_routing_mono_to_mono.
         if (!vb->m_has_additive) { return; }
         const float depth = routing.m_depth_abs_precomputed.load(std::memory_order_relaxed);
-        if (source->is_fully_active()) {
-            for (uint32_t v = 0; v < nv; ++v) {
-                const float* in = source->voice_output(v);
-                float* out = vb->additive_voice(v);
-                for (size_t i = 0; i < num_samples; ++i) { out[i] += in[i] * depth; }
+        if (depth == 0.0f) { return; }
+        for (uint32_t v = 0; v < nv; ++v) {
+            const OutputSegments segments = segments_of(v);
+            if (segments.size() == 1 && !vb->is_dense(v)) {
+                vb->m_uniform_additive[v] += segments.front().m_value * depth;
+                continue;
             }
-        } else {
-            for (uint32_t v = 0; v < nv; ++v) {
-                const float* in = source->voice_output(v);
-                const uint8_t* src_active = source->voice_output_active(v);
-                float* out = vb->additive_voice(v);
-                for (size_t i = 0; i < num_samples; ++i) {
-                    if (src_active[i]) { out[i] += in[i] * depth; }
-                }
+            vb->make_dense(v);
+            if (!segments.empty()) {
+                additive_segments_kernel(vb->additive_voice(v), segments, depth, num_samples);
+            } else if (source->is_fully_active()) {
+                additive_kernel(vb->additive_voice(v), source->voice_output(v), depth, num_samples);
+            } else {
+                additive_gated_kernel(vb->additive_voice(v),
+                                      source->voice_output(v),
+                                      source->voice_output_active(v),
+                                      depth,
+                                      num_samples);
             }
         }
     } else {
         if (!vb->m_has_replace) { return; }
         if (source->is_fully_active()) {
-            for (uint32_t v = 0; v < nv; ++v) {
+            if (num_samples == 0) { return; }
+            const ReplaceAffine affine = load_replace_affine(routing);
+            const bool contended = vb->m_has_replace_priority;
+            const uint32_t held_nv =
+                std::min(nv, static_cast<uint32_t>(routing.m_held_voice_values.size()));
+            for (uint32_t v = 0; v < held_nv; ++v) {
                 const float* in = source->voice_output(v);
-                float* out = vb->replace_voice(v);
-                uint8_t* active = vb->replace_active_voice(v);
-                uint32_t* prio =
-                    vb->m_has_replace_priority ? vb->replace_priority_voice(v) : nullptr;
-                uint64_t* fresh =
-                    vb->m_has_replace_priority ? vb->replace_freshness_voice(v) : nullptr;
-                for (size_t i = 0; i < num_samples; ++i) {
-                    apply_replace_sample_voice(routing,
-                                               out,
-                                               active,
-                                               prio,
-                                               fresh,
-                                               i,
-                                               block_offset,
-                                               compute_replace_value(routing, in[i]),
-                                               true,
-                                               v);
+                const OutputSegments segments = segments_of(v);
+                const float last_in = segments.empty() ? in[num_samples - 1]
+                                                       : last_segment_value(segments, num_samples);
+                const uint64_t fresh = advance_replace_state_voice(
+                    routing, affine, last_in, num_samples, block_offset, v, contended);
+                if (!contended && segments.size() == 1 && !vb->is_dense(v)) {
+                    vb->m_uniform_replace[v] = affine(segments.front().m_value);
+                    vb->m_uniform_replace_active[v] = 1;
+                    continue;
+                }
+                vb->make_dense(v);
+                if (!contended && !segments.empty()) {
+                    replace_segments_kernel(vb->replace_voice(v),
+                                            vb->replace_active_voice(v),
+                                            segments,
+                                            affine,
+                                            num_samples);
+                    continue;
                 }
+                replace_block_kernel(vb->replace_voice(v),
+                                     vb->replace_active_voice(v),
+                                     contended ? vb->replace_priority_voice(v) : nullptr,
+                                     contended ? vb->replace_freshness_voice(v) : nullptr,
+                                     in,
+                                     affine,
+                                     routing.m_replace_priority,
+                                     fresh,
+                                     num_samples);
             }
         } else {
             for (uint32_t v = 0; v < nv; ++v) {
+                vb->make_dense(v);
                 const float* in = source->voice_output(v);
                 const uint8_t* src_active = source->voice_output_active(v);
                 float* out = vb->replace_voice(v);
@@ -1374,48 +1812,70 @@ void apply_routing_global_to_scoped(const ResolvedRouting& routing,
     const auto& src_output = source->get_output_buffer();
     auto* vb = routing.m_target->m_voice.load(std::memory_order_acquire);
     if (vb == nullptr) { return; }
+    const OutputSegments segments =
+        source->is_fully_active() ? source->output_segments() : OutputSegments{};
+    const bool constant = segments.size() == 1;
     if (routing.m_combine_mode == CombineMode::Additive) {
         if (!vb->m_has_additive) { return; }
         const float depth = routing.m_depth_abs_precomputed.load(std::memory_order_relaxed);
-        if (source->is_fully_active()) {
-            for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
-                float* out = vb->additive_voice(v);
-                for (size_t i = 0; i < num_samples; ++i) { out[i] += src_output[i] * depth; }
+        if (depth == 0.0f) { return; }
+        for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
+            if (constant && !vb->is_dense(v)) {
+                vb->m_uniform_additive[v] += segments.front().m_value * depth;
+                continue;
             }
-        } else {
-            for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
-                float* out = vb->additive_voice(v);
-                for (size_t i = 0; i < num_samples; ++i) {
-                    if (source->get_output_active_at(static_cast<uint32_t>(i))) {
-                        out[i] += src_output[i] * depth;
-                    }
-                }
+            vb->make_dense(v);
+            if (!segments.empty()) {
+                additive_segments_kernel(vb->additive_voice(v), segments, depth, num_samples);
+            } else if (source->is_fully_active()) {
+                additive_kernel(vb->additive_voice(v), src_output.data(), depth, num_samples);
+            } else {
+                additive_gated_kernel(vb->additive_voice(v),
+                                      src_output.data(),
+                                      source->get_output_active().data(),
+                                      depth,
+                                      num_samples);
             }
         }
     } else {
         if (!vb->m_has_replace) { return; }
         if (source->is_fully_active()) {
+            // A mono source carries one mono state for every voice it feeds.
+            if (num_samples == 0 || vb->m_num_voices == 0) { return; }
+            const ReplaceAffine affine = load_replace_affine(routing);
+            const float last_in = segments.empty() ? src_output[num_samples - 1]
+                                                   : last_segment_value(segments, num_samples);
+            const uint64_t fresh =
+                advance_replace_state_mono(routing, affine, last_in, num_samples, block_offset);
+            const bool contended = vb->m_has_replace_priority;
             for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
-                float* out = vb->replace_voice(v);
-                uint8_t* active = vb->replace_active_voice(v);
-                uint32_t* prio =
-                    vb->m_has_replace_priority ? vb->replace_priority_voice(v) : nullptr;
-                uint64_t* fresh =
-                    vb->m_has_replace_priority ? vb->replace_freshness_voice(v) : nullptr;
-                for (size_t i = 0; i < num_samples; ++i) {
-                    apply_replace_sample(routing,
-                                         out,
-                                         active,
-                                         prio,
-                                         fresh,
-                                         i,
-                                         block_offset,
-                                         compute_replace_value(routing, src_output[i]),
-                                         true);
+                if (constant && !contended && !vb->is_dense(v)) {
+                    vb->m_uniform_replace[v] = affine(segments.front().m_value);
+                    vb->m_uniform_replace_active[v] = 1;
+                    continue;
                 }
+                vb->make_dense(v);
+                if (!contended && !segments.empty()) {
+                    replace_segments_kernel(vb->replace_voice(v),
+                                            vb->replace_active_voice(v),
+                                            segments,
+                                            affine,
+                                            num_samples);
+                    continue;
+                }
+                replace_block_kernel(vb->replace_voice(v),
+                                     vb->replace_active_voice(v),
+                                     contended ? vb->replace_priority_voice(v) : nullptr,
+                                     contended ? vb->replace_freshness_voice(v) : nullptr,
+                                     src_output.data(),
+                                     affine,
+                                     routing.m_replace_priority,
+                                     fresh,
+                                     num_samples);
             }
         } else {
             for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
+                vb->make_dense(v);
                 float* out = vb->replace_voice(v);
                 uint8_t* active = vb->replace_active_voice(v);
                 uint32_t* prio =
@@ -1450,9 +1910,11 @@ void apply_modulation_sample_mono(const ResolvedRouting& routing,
     if (routing.m_combine_mode == CombineMode::Additive) {
         if (!mb->m_has_additive) { return; }
         const float depth = routing.m_depth_abs_precomputed.load(std::memory_order_relaxed);
+        mb->make_dense();
         if (src_active) { mb->m_additive_buffer[i] += src_sample * depth; }
     } else {
         if (!mb->m_has_replace) { return; }
+        mb->make_dense();
         uint32_t* prio_buf = mb->m_has_replace_priority ? mb->m_replace_priority.data() : nullptr;
         uint64_t* fresh_buf = mb->m_has_replace_priority ? mb->m_replace_freshness.data() : nullptr;
         apply_replace_sample(routing,
@@ -1477,13 +1939,15 @@ void ModulationMatrix::process_source_bulk_with_scope(const ProcessingConfig& co
     auto it = config.m_routings_by_source.find(source);
     if (it == config.m_routings_by_source.end()) { return; }
 
-    const uint64_t block_offset = m_num_processed_samples;
-
     // Per-source state reset has already happened in process_with_scope step 1
     // (clear_per_block) and step 2 (pre_process_block may have repopulated
     // masks + CPs). Do NOT re-clear here — that would discard event-driven
     // sources' freshly drained input.
+    render_source(source, num_samples);
+    apply_source_routings_with_scope(source, it->second, num_samples);
+}
 
+void ModulationMatrix::render_source(ModulationSource* source, size_t num_samples) {
     // Source scope dictates which process variant to call:
     //   - global scope  → one mono process(num_samples)
     //   - scoped source → process_voice(v, num_samples) per voice
@@ -1496,8 +1960,53 @@ void ModulationMatrix::process_source_bulk_with_scope(const ProcessingConfig& co
             source->process_voice(v, num_samples);
         }
     }
+}
+
+void ModulationMatrix::process_render_wave_with_scope(const ProcessingConfig& config,
+                                                      const RenderWave& wave,
+                                                      size_t num_samples) {
+    auto wave_source = [&](size_t i) {
+        return std::get_if<BulkStep>(&config.m_schedule[wave.m_first_step + i])->m_source;
+    };
+
+    // One job per (source, voice) on a fixed stride of max_voices; padding
+    // jobs past a source's own voice count are no-ops. A global source
+    // renders in its voice-0 job.
+    uint32_t max_voices = 1;
+    for (size_t i = 0; i < wave.m_num_steps; ++i) {
+        const ModulationSource* source = wave_source(i);
+        if (!source->is_global()) { max_voices = std::max(max_voices, source->num_voices()); }
+    }
+
+    auto render_job = [&](size_t job) {
+        ModulationSource* source = wave_source(job / max_voices);
+        const auto voice = static_cast<uint32_t>(job % max_voices);
+        if (source->is_global()) {
+            if (voice == 0) { source->process(num_samples); }
+        } else if (voice < source->num_voices()) {
+            source->process_voice(voice, num_samples);
+        }
+    };
+    config.m_worker_pool->parallel_for(wave.m_num_steps * max_voices, render_job);
+
+    // Joined. Wave members do not modulate each other, so applying their
+    // routings after all renders matches the serial interleaving exactly.
+    for (size_t i = 0; i < wave.m_num_steps; ++i) {
+        ModulationSource* source = wave_source(i);
+        auto it = config.m_routings_by_source.find(source);
+        if (it != config.m_routings_by_source.end()) {
+            apply_source_routings_with_scope(source, it->second, num_samples);
+        }
+    }
+}
 
-    for (const auto* routing : it->second) {
+void ModulationMatrix::apply_source_routings_with_scope(
+    ModulationSource* source,
+    const std::vector<const ResolvedRouting*>& routings,
+    size_t num_samples) {
+    const uint64_t block_offset = m_num_processed_samples;
+
+    for (const auto* routing : routings) {
         if (routing->m_skip_during_gesture &&
             routing->m_target->m_record->m_in_gesture.load(std::memory_order_relaxed)) {
             continue;
@@ -1520,15 +2029,19 @@ void ModulationMatrix::process_source_bulk_with_scope(const ProcessingConfig& co
             case RoutingMode::CrossScope: break;  // rejected at schedule-build time
         }
 
-        // Propagate change points to target flags. m_change_point_flags[_storage]
+        // Propagate change points to target flags. m_change_point_bits[_storage]
         // is only allocated when at least one of m_has_additive / m_has_replace
         // is set; guard so old-config routings landing on a flag-shrunken buffer
         // become a no-op instead of writing to empty storage.
         if (routing->m_routing_mode == RoutingMode::GlobalToGlobal) {
             if (auto* mb = routing->m_target->m_mono.load(std::memory_order_acquire);
                 mb != nullptr && (mb->m_has_additive || mb->m_has_replace)) {
-                for (const uint32_t cp : source->get_change_points()) {
-                    if (cp < num_samples) { mb->m_change_point_flags[cp] = 1; }
+                if (merge_change_points(source->get_change_points(),
+                                        num_samples,
+                                        mb->m_change_point_bits.data(),
+                                        1,
+                                        0)) {
+                    mb->m_dirty = true;
                 }
             }
         } else if (routing->m_routing_mode == RoutingMode::ScopedToScoped) {
@@ -1536,10 +2049,12 @@ void ModulationMatrix::process_source_bulk_with_scope(const ProcessingConfig& co
                 vb != nullptr && (vb->m_has_additive || vb->m_has_replace)) {
                 const uint32_t nv = std::min(source->num_voices(), vb->m_num_voices);
                 for (uint32_t v = 0; v < nv; ++v) {
-                    const auto& vcp = source->get_voice_change_points(v);
-                    const size_t base = static_cast<size_t>(v) * vb->m_block_size;
-                    for (const uint32_t cp : vcp) {
-                        if (cp < num_samples) { vb->m_change_point_flags_storage[base + cp] = 1; }
+                    if (merge_change_points(source->get_voice_change_points(v),
+                                            num_samples,
+                                            vb->change_point_bits_voice(v),
+                                            1,
+                                            0)) {
+                        vb->mark_dirty(v);
                     }
                 }
             }
@@ -1547,12 +2062,12 @@ void ModulationMatrix::process_source_bulk_with_scope(const ProcessingConfig& co
             if (auto* vb = routing->m_target->m_voice.load(std::memory_order_acquire);
                 vb != nullptr && (vb->m_has_additive || vb->m_has_replace)) {
                 // Broadcast mono change points to all voices
-                for (const uint32_t cp : source->get_change_points()) {
-                    if (cp >= num_samples) { continue; }
-                    for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
-                        const size_t base = static_cast<size_t>(v) * vb->m_block_size;
-                        vb->m_change_point_flags_storage[base + cp] = 1;
-                    }
+                if (merge_change_points(source->get_change_points(),
+                                        num_samples,
+                                        vb->m_change_point_bits_storage.data(),
+                                        vb->m_num_voices,
+                                        vb->m_change_point_words)) {
+                    std::ranges::fill(vb->m_voice_dirty, uint8_t{1});
                 }
             }
         }
@@ -1619,6 +2134,7 @@ void ModulationMatrix::process_cyclic_with_scope(const ProcessingConfig& config,
                             }
                             if (routing->m_combine_mode == CombineMode::Additive) {
                                 if (!vb->m_has_additive) { continue; }
+                                vb->make_dense(v);
                                 if (active) {
                                     const float depth = routing->m_depth_abs_precomputed.load(
                                         std::memory_order_relaxed);
@@ -1626,6 +2142,7 @@ void ModulationMatrix::process_cyclic_with_scope(const ProcessingConfig& config,
                                 }
                             } else {
                                 if (!vb->m_has_replace) { continue; }
+                                vb->make_dense(v);
                                 uint32_t* prio = vb->m_has_replace_priority
                                                      ? vb->replace_priority_voice(v)
                                                      : nullptr;
@@ -1664,8 +2181,12 @@ void ModulationMatrix::process_cyclic_with_scope(const ProcessingConfig& config,
             if (routing->m_routing_mode == RoutingMode::GlobalToGlobal) {
                 if (auto* mb = routing->m_target->m_mono.load(std::memory_order_acquire);
                     mb != nullptr && (mb->m_has_additive || mb->m_has_replace)) {
-                    for (const uint32_t cp : source->get_change_points()) {
-                        if (cp < num_samples) { mb->m_change_point_flags[cp] = 1; }
+                    if (merge_change_points(source->get_change_points(),
+                                            num_samples,
+                                            mb->m_change_point_bits.data(),
+                                            1,
+                                            0)) {
+                        mb->m_dirty = true;
                     }
                 }
             } else if (routing->m_routing_mode == RoutingMode::ScopedToScoped) {
@@ -1673,12 +2194,12 @@ void ModulationMatrix::process_cyclic_with_scope(const ProcessingConfig& config,
                     vb != nullptr && (vb->m_has_additive || vb->m_has_replace)) {
                     const uint32_t nv = std::min(source->num_voices(), vb->m_num_voices);
                     for (uint32_t v = 0; v < nv; ++v) {
-                        const auto& vcp = source->get_voice_change_points(v);
-                        const size_t base = static_cast<size_t>(v) * vb->m_block_size;
-                        for (const uint32_t cp : vcp) {
-                            if (cp < num_samples) {
-                                vb->m_change_point_flags_storage[base + cp] = 1;
-                            }
+                        if (merge_change_points(source->get_voice_change_points(v),
+                                                num_samples,
+                                                vb->change_point_bits_voice(v),
+                                                1,
+                                                0)) {
+                            vb->mark_dirty(v);
                         }
                     }
                 }
@@ -1701,19 +2222,30 @@ void ModulationMatrix::apply_routing_change_points_with_scope(const ResolvedRout
     const bool mb_ok = mb != nullptr && (mb->m_has_additive || mb->m_has_replace);
     const bool vb_ok = vb != nullptr && (vb->m_has_additive || vb->m_has_replace);
     if (!mb_ok && !vb_ok) { return; }
-    for (size_t i = 0; i < num_samples; ++i) {
-        if (routing.m_samples_until_update == 0) {
-            if (mb_ok) { mb->m_change_point_flags[i] = 1; }
-            if (vb_ok) {
-                for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
-                    const size_t base = static_cast<size_t>(v) * vb->m_block_size;
-                    vb->m_change_point_flags_storage[base + i] = 1;
-                }
-            }
-            routing.m_samples_until_update = routing.m_max_decimation;
+
+    // Decimation ticks fall at m_samples_until_update, then every
+    // m_max_decimation samples — step between them instead of counting down
+    // per sample.
+    const size_t stride = routing.m_max_decimation;
+    const size_t first = routing.m_samples_until_update;
+    if (first >= num_samples) {
+        routing.m_samples_until_update -= static_cast<uint32_t>(num_samples);
+        return;
+    }
+    if (mb_ok) {
+        thl::dsp::utils::set_change_points_strided(
+            mb->m_change_point_bits.data(), first, stride, num_samples);
+        mb->m_dirty = true;
+    }
+    if (vb_ok) {
+        for (uint32_t v = 0; v < vb->m_num_voices; ++v) {
+            thl::dsp::utils::set_change_points_strided(
+                vb->change_point_bits_voice(v), first, stride, num_samples);
+            vb->m_voice_dirty[v] = 1;
         }
-        --routing.m_samples_until_update;
     }
+    const size_t last_tick = first + ((num_samples - 1 - first) / stride) * stride;
+    routing.m_samples_until_update = static_cast<uint32_t>(stride - (num_samples - last_tick));
 }
 
 // ── Serialization ───────────────────────────────────────────────────────────
@@ -1810,34 +2342,20 @@ void ModulationMatrix::from_json(const nlohmann::json& json) {
         return r;
     };
 
-    // Helper: after loading routings, assign IDs to any that are missing and
-    // advance m_next_routing_id past the highest loaded ID.
-    auto finalize_ids = [this]() {
-        uint32_t max_id = 0;
-        for (const auto& r : m_user_routings) {
-            if (r.m_id != k_invalid_routing_id && r.m_id > max_id) { max_id = r.m_id; }
-        }
-        m_next_routing_id = max_id + 1;
-        // Assign IDs to routings that didn't have one in the JSON.
-        for (auto& r : m_user_routings) {
-            if (r.m_id == k_invalid_routing_id) { r.m_id = m_next_routing_id++; }
-        }
-    };
-
     // Restore routings
     if (json.contains("modulation_routings") && json["modulation_routings"].is_array()) {
         m_user_routings.clear();
         for (const auto& obj : json["modulation_routings"]) {
             m_user_routings.push_back(parse_routing(obj));
         }
-        finalize_ids();
-        rebuild_schedule_with_lock();
+        finalize_routing_ids_with_lock();
+        request_rebuild_with_lock();
     } else if (json.is_array()) {
         // Bare routings array (from to_json(false))
         m_user_routings.clear();
         for (const auto& obj : json) { m_user_routings.push_back(parse_routing(obj)); }
-        finalize_ids();
-        rebuild_schedule_with_lock();
+        finalize_routing_ids_with_lock();
+        request_rebuild_with_lock();
     }
 
     // Forward parameters to State
@@ -1845,3 +2363,151 @@ void ModulationMatrix::from_json(const nlohmann::json& json) {
         m_state.from_json(json["parameters"]);
     }
 }
+
+void ModulationMatrix::finalize_routing_ids_with_lock() {
+    uint32_t max_id = 0;
+    for (const auto& r : m_user_routings) {
+        if (r.m_id != k_invalid_routing_id && r.m_id > max_id) { max_id = r.m_id; }
+    }
+    m_next_routing_id = max_id + 1;
+    // Assign IDs to routings that didn't have one in the preset.
+    for (auto& r : m_user_routings) {
+        if (r.m_id == k_invalid_routing_id) { r.m_id = m_next_routing_id++; }
+    }
+}
+
+namespace {
+
+constexpr uint8_t k_routing_flag_replace_range = 1 << 0;
+constexpr uint8_t k_routing_flag_skip_during_gesture = 1 << 1;
+constexpr uint8_t k_routing_flag_replace_hold_priority = 1 << 2;
+
+}  // namespace
+
+std::vector<std::byte> ModulationMatrix::to_binary(bool include_state) {
+    std::vector<std::byte> state_blob;
+    if (include_state) { state_blob = m_state.to_binary(); }
+
+    std::scoped_lock const lock(m_writer_mutex);
+
+    size_t string_bytes = 0;
+    for (const auto& r : m_user_routings) {
+        string_bytes += r.m_source_id.size() + r.m_target_id.size();
+    }
+    const size_t routings_end =
+        thl::detail::k_snapshot_header_size +
+        m_user_routings.size() * thl::detail::k_matrix_snapshot_routing_size + string_bytes;
+
+    std::vector<std::byte> out;
+    out.reserve(thl::detail::snapshot_align(routings_end) + state_blob.size());
+
+    thl::detail::SnapshotWriter writer(out);
+    writer.put_bytes(thl::detail::k_matrix_snapshot_magic.data(), thl::detail::k_matrix_snapshot_magic.size());
+    writer.put<uint32_t>(thl::detail::k_snapshot_version);
+    writer.put<uint32_t>(thl::detail::k_snapshot_header_size);
+    writer.put<uint32_t>(static_cast<uint32_t>(m_user_routings.size()));
+    writer.put<uint32_t>(static_cast<uint32_t>(string_bytes));
+    writer.put<uint32_t>(thl::detail::k_matrix_snapshot_routing_size);
+    writer.put<uint32_t>(static_cast<uint32_t>(state_blob.size()));
+
+    uint32_t string_offset = 0;
+    for (const auto& r : m_user_routings) {
+        uint8_t flags = 0;
+        if (r.m_has_replace_range) { flags |= k_routing_flag_replace_range; }
+        if (r.m_skip_during_gesture) { flags |= k_routing_flag_skip_during_gesture; }
+        if (r.m_replace_hold_priority.has_value()) { flags |= k_routing_flag_replace_hold_priority; }
+
+        const auto source_size = static_cast<uint32_t>(r.m_source_id.size());
+        const auto target_size = static_cast<uint32_t>(r.m_target_id.size());
+        writer.put<uint32_t>(r.m_id);
+        writer.put<uint32_t>(string_offset);
+        writer.put<uint32_t>(source_size);
+        writer.put<uint32_t>(string_offset + source_size);
+        writer.put<uint32_t>(target_size);
+        writer.put<float>(r.m_depth);
+        writer.put<uint32_t>(r.m_max_decimation);
+        writer.put<uint32_t>(r.m_replace_priority);
+        writer.put<uint32_t>(r.m_replace_hold_priority.value_or(0));
+        writer.put<float>(r.m_replace_range_min);
+        writer.put<float>(r.m_replace_range_max);
+        writer.put<uint8_t>(static_cast<uint8_t>(r.m_depth_mode));
+        writer.put<uint8_t>(static_cast<uint8_t>(r.m_combine_mode));
+        writer.put<uint8_t>(flags);
+        writer.put<uint8_t>(0);
+        string_offset += source_size + target_size;
+    }
+    for (const auto& r : m_user_routings) {
+        writer.put_bytes(r.m_source_id.data(), r.m_source_id.size());
+        writer.put_bytes(r.m_target_id.data(), r.m_target_id.size());
+    }
+    writer.pad_to_alignment();
+    writer.put_bytes(state_blob.data(), state_blob.size());
+    return out;
+}
+
+void ModulationMatrix::from_binary(std::span<const std::byte> data) {
+    const thl::detail::SnapshotReader reader(data);
+    const size_t header_size = reader.check_header(thl::detail::k_matrix_snapshot_magic);
+    const auto num_routings = reader.get<uint32_t>(16);
+    const auto string_bytes = reader.get<uint32_t>(20);
+    const auto routing_size = reader.get<uint32_t>(24);
+    const auto state_bytes = reader.get<uint32_t>(28);
+    if (routing_size < thl::detail::k_matrix_snapshot_routing_size) {
+        throw thl::SnapshotFormatException("bad routing size");
+    }
+    const size_t strings_offset = header_size + size_t{num_routings} * routing_size;
+    const size_t state_offset = thl::detail::snapshot_align(strings_offset + string_bytes);
+    reader.require(strings_offset, string_bytes);
+
+    auto get_id = [&](size_t offset, size_t size) {
+        if (offset + size > string_bytes) {
+            throw thl::SnapshotFormatException("string out of range");
+        }
+        return std::string(reader.get_string(strings_offset + offset, size));
+    };
+
+    // Parse everything before touching the matrix, so a bad snapshot leaves
+    // the current routings in place
+    std::vector<ModulationRouting> routings;
+    routings.reserve(num_routings);
+    for (size_t i = 0; i < num_routings; ++i) {
+        const size_t offset = header_size + i * routing_size;
+        const auto flags = reader.get<uint8_t>(offset + 46);
+        const auto depth_mode = reader.get<uint8_t>(offset + 44);
+        const auto combine_mode = reader.get<uint8_t>(offset + 45);
+        if (depth_mode > static_cast<uint8_t>(DepthMode::Normalized) ||
+            combine_mode > static_cast<uint8_t>(CombineMode::ReplaceHold)) {
+            throw thl::SnapshotFormatException("unknown routing mode");
+        }
+
+        ModulationRouting r;
+        r.m_id = reader.get<uint32_t>(offset);
+        r.m_source_id = get_id(reader.get<uint32_t>(offset + 4), reader.get<uint32_t>(offset + 8));
+        r.m_target_id =
+            get_id(reader.get<uint32_t>(offset + 12), reader.get<uint32_t>(offset + 16));
+        r.m_depth = reader.get<float>(offset + 20);
+        r.m_max_decimation = reader.get<uint32_t>(offset + 24);
+        r.m_replace_priority = reader.get<uint32_t>(offset + 28);
+        if ((flags & k_routing_flag_replace_hold_priority) != 0) {
+            r.m_replace_hold_priority = reader.get<uint32_t>(offset + 32);
+        }
+        r.m_replace_range_min = reader.get<float>(offset + 36);
+        r.m_replace_range_max = reader.get<float>(offset + 40);
+        r.m_has_replace_range = (flags & k_routing_flag_replace_range) != 0;
+        r.m_skip_during_gesture = (flags & k_routing_flag_skip_during_gesture) != 0;
+        r.m_depth_mode = static_cast<DepthMode>(depth_mode);
+        r.m_combine_mode = static_cast<CombineMode>(combine_mode);
+        routings.push_back(std::move(r));
+    }
+    const auto state_blob = state_bytes > 0 ? reader.subspan(state_offset, state_bytes)
+                                            : std::span<const std::byte>{};
+
+    {
+        std::scoped_lock const lock(m_writer_mutex);
+        m_user_routings = std::move(routings);
+        finalize_routing_ids_with_lock();
+        request_rebuild_with_lock();
+    }
+
+    if (!state_blob.empty()) { m_state.from_binary(state_blob); }
+}
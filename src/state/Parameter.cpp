@@ -34,15 +34,15 @@ T Parameter::to(bool allow_blocking) const TANH_NONBLOCKING_FUNCTION {
             }
             case ParameterType::Double:
                 return std::to_string(
-                    m_record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             case ParameterType::Float:
                 return std::to_string(
-                    m_record->m_cache.m_atomic_float.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_float->load(std::memory_order_relaxed));
             case ParameterType::Int:
                 return std::to_string(
-                    m_record->m_cache.m_atomic_int.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
             case ParameterType::Bool:
-                return m_record->m_cache.m_atomic_bool.load(std::memory_order_relaxed) ? "true"
+                return m_record->m_cache.m_atomic_bool->load(std::memory_order_relaxed) ? "true"
                                                                                        : "false";
             default: return "";
         }
@@ -50,19 +50,19 @@ T Parameter::to(bool allow_blocking) const TANH_NONBLOCKING_FUNCTION {
         switch (m_record->m_def.m_type) {
             case ParameterType::Double:
                 return static_cast<T>(
-                    m_record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             case ParameterType::Float:
                 return static_cast<T>(
-                    m_record->m_cache.m_atomic_float.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_float->load(std::memory_order_relaxed));
             case ParameterType::Int:
                 return static_cast<T>(
-                    m_record->m_cache.m_atomic_int.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
             case ParameterType::Bool:
                 return static_cast<T>(
-                    m_record->m_cache.m_atomic_bool.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_bool->load(std::memory_order_relaxed));
             case ParameterType::String:
                 return static_cast<T>(
-                    m_record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    m_record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             default: return T{};
         }
     }
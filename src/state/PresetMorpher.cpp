@@ -0,0 +1,124 @@
+#include "tanh/state/PresetMorpher.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <span>
+
+#include "tanh/state/Parameter.h"
+#include "tanh/state/ParameterDefinitions.h"
+#include "tanh/state/State.h"
+#include "tanh/state/StateSnapshot.h"
+#include "tanh/utils/RealtimeSanitizer.h"
+
+namespace thl {
+
+void PresetMorpher::prepare() {
+    std::vector<Target> targets;
+    uint64_t generation = 0;
+    {
+        std::scoped_lock const lock(m_state.m_storage_mutex);
+        generation = m_state.m_removal_generation.load(std::memory_order_relaxed);
+        targets.reserve(m_state.m_storage.size());
+        for (const auto& [key, record] : m_state.m_storage) {
+            if (record->m_def.m_type == ParameterType::String) { continue; }
+            targets.push_back({record.get(), record->m_def.m_id, record->m_def.m_type});
+        }
+    }
+    // ID order walks the snapshots' arrays front to back
+    std::ranges::sort(targets, {}, &Target::m_id);
+    m_targets = std::move(targets);
+    m_generation = generation;
+}
+
+bool PresetMorpher::is_stale() const TANH_NONBLOCKING_FUNCTION {
+    return m_state.m_removal_generation.load(std::memory_order_acquire) != m_generation;
+}
+
+bool PresetMorpher::apply(const StateSnapshot& snapshot) TANH_NONBLOCKING_FUNCTION {
+    if (is_stale()) { return false; }
+    const bool mark = deferred();
+    for (const auto& target : m_targets) {
+        const double value = snapshot.value(target.m_id);
+        if (std::isnan(value)) { continue; }
+        if (write(target, value) && mark) { mark_pending(target); }
+    }
+    return true;
+}
+
+bool PresetMorpher::morph(const StateSnapshot& a,
+                          const StateSnapshot& b,
+                          float t) TANH_NONBLOCKING_FUNCTION {
+    if (is_stale()) { return false; }
+    const bool mark = deferred();
+    const double weight = t;
+    for (const auto& target : m_targets) {
+        const double va = a.value(target.m_id);
+        const double vb = b.value(target.m_id);
+        if (std::isnan(va) || std::isnan(vb)) { continue; }
+        if (write(target, va + (vb - va) * weight) && mark) { mark_pending(target); }
+    }
+    return true;
+}
+
+bool PresetMorpher::morph(std::span<const StateSnapshot* const> snapshots,
+                          std::span<const float> weights) TANH_NONBLOCKING_FUNCTION {
+    assert(snapshots.size() == weights.size() && "PresetMorpher: one weight per snapshot");
+    if (is_stale()) { return false; }
+    const size_t count = std::min(snapshots.size(), weights.size());
+
+    double total = 0.0;
+    for (size_t i = 0; i < count; ++i) { total += weights[i]; }
+    if (!(total > 0.0)) { return true; }
+    const double scale = 1.0 / total;
+
+    const bool mark = deferred();
+    for (const auto& target : m_targets) {
+        double value = 0.0;
+        bool complete = true;
+        for (size_t i = 0; i < count; ++i) {
+            const double v = snapshots[i]->value(target.m_id);
+            if (std::isnan(v)) {
+                complete = false;
+                break;
+            }
+            value += v * weights[i];
+        }
+        if (complete && write(target, value * scale) && mark) { mark_pending(target); }
+    }
+    return true;
+}
+
+bool PresetMorpher::write(const Target& target, double value) TANH_NONBLOCKING_FUNCTION {
+    const auto& cache = target.m_record->m_cache;
+
+    // Skip the store when nothing changes, leaving the cache line clean
+    // for readers on other cores
+    auto store_if_changed = [](auto* atomic, auto new_value) {
+        if (atomic->load(std::memory_order_relaxed) == new_value) { return false; }
+        atomic->store(new_value, std::memory_order_relaxed);
+        return true;
+    };
+
+    switch (target.m_type) {
+        case ParameterType::Double: return store_if_changed(cache.m_atomic_double, value);
+        case ParameterType::Float:
+            return store_if_changed(cache.m_atomic_float, static_cast<float>(value));
+        case ParameterType::Int:
+            return store_if_changed(cache.m_atomic_int, static_cast<int>(std::lround(value)));
+        case ParameterType::Bool: return store_if_changed(cache.m_atomic_bool, value >= 0.5);
+        default: return false;
+    }
+}
+
+bool PresetMorpher::deferred() const TANH_NONBLOCKING_FUNCTION {
+    return m_state.get_notification_mode() == State::NotificationMode::Deferred;
+}
+
+void PresetMorpher::mark_pending(const Target& target) TANH_NONBLOCKING_FUNCTION {
+    m_state.mark_pending(target.m_record);
+}
+
+}  // namespace thl
@@ -2,10 +2,13 @@
 
 #include <tanh/core/Logger.h>
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -15,6 +18,7 @@
 #include <utility>
 
 #include "tanh/core/Exports.h"
+#include "tanh/state/BinarySnapshot.h"
 #include "tanh/state/Exceptions.h"
 #include "tanh/state/ModulationScope.h"
 #include "tanh/state/Parameter.h"
@@ -53,18 +57,35 @@ State::State(size_t max_string_size, size_t max_levels)
     // Initialize the StateGroup with this as the root state
     m_root_state = this;
 
+    m_key_tables.push_back(std::make_unique<KeyHashTable>(k_initial_key_table_capacity));
+    m_key_table.store(m_key_tables.back().get(), std::memory_order_release);
+
     State::ensure_thread_registered();
 }
 
 void State::ensure_thread_registered() {
     // Check if this thread is already registered with this State instance
-    if (t_registered_states().find(this) != t_registered_states().end()) [[likely]] {
-        return;  // Already registered
+    const RCUReaderSlot& slot = RCUReaderSlot::current();
+    if (slot.is_valid()) [[likely]] {
+        if (m_registered_slot_generations[slot.m_index].load(std::memory_order_relaxed) ==
+            slot.m_generation) [[likely]] {
+            return;  // Already registered
+        }
+    } else if (t_registered_states().find(this) != t_registered_states().end()) {
+        return;  // Already registered (thread without a reader slot)
     }
     register_reader_thread();
     reserve_temporary_string_buffers();
     ensure_child_groups_registered();
-    t_registered_states().insert(this);
+
+    // register_reader_thread() claimed the slot if one was free
+    const RCUReaderSlot& claimed = RCUReaderSlot::current();
+    if (claimed.is_valid()) {
+        m_registered_slot_generations[claimed.m_index].store(claimed.m_generation,
+                                                             std::memory_order_relaxed);
+    } else {
+        t_registered_states().insert(this);
+    }
 }
 
 void State::register_reader_thread() {
@@ -93,19 +114,114 @@ void State::reserve_temporary_string_buffers() {
 ParameterRecord* State::get_record(std::string_view key) const {
     ParameterRecord* record = nullptr;
     m_string_index_rcu.read([&](const StringIndexMap& idx) {
-        auto it = idx.find(key);
-        if (it != idx.end()) { record = it->second; }
+        if (auto* const* found = idx.find(key)) { record = *found; }
     });
+    if (record == nullptr && sees_open_batch()) {
+        // Created inside this thread's open batch, not yet in the index
+        std::scoped_lock const lock(m_storage_mutex);
+        auto it = m_storage.find(key);
+        if (it != m_storage.end()) { record = it->second.get(); }
+    }
     return record;
 }
 
+ParameterRecord* State::get_record(ParamKey key) const TANH_NONBLOCKING_FUNCTION {
+    const KeyHashTable* table = m_key_table.load(std::memory_order_acquire);
+    // At most half full, so every probe sequence reaches an empty slot
+    for (size_t i = key.hash() & table->m_mask;; i = (i + 1) & table->m_mask) {
+        const auto& slot = table->m_slots[i];
+        ParameterRecord* record = slot.m_record.load(std::memory_order_acquire);
+        if (record == nullptr) { break; }
+        if (record != k_erased_key_record && slot.m_hash.load(std::memory_order_relaxed) == key.hash() &&
+            record->m_key == key.path()) {
+            return record;
+        }
+    }
+    if (sees_open_batch()) {
+        std::scoped_lock const lock(m_storage_mutex);
+        auto it = m_storage.find(key.path());
+        if (it != m_storage.end()) { return it->second.get(); }
+    }
+    return nullptr;
+}
+
+bool State::sees_open_batch() const TANH_NONBLOCKING_FUNCTION {
+    // Uncommitted records stay private to the batch's thread, so lock-free
+    // readers never fall back to the storage mutex
+    return m_batch_open.load(std::memory_order_acquire) &&
+           m_batch_owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
+
+void State::index_key_hash(ParameterRecord* record) {
+    // Caller holds m_storage_mutex — the only writer. Returns whether the
+    // entry took an empty slot rather than reusing an erased one; readers
+    // verify the path, so a reused slot never yields the wrong record.
+    auto insert = [](KeyHashTable& table, uint64_t hash, ParameterRecord* entry) {
+        size_t i = hash & table.m_mask;
+        ParameterRecord* occupant = nullptr;
+        while ((occupant = table.m_slots[i].m_record.load(std::memory_order_relaxed)) != nullptr &&
+               occupant != k_erased_key_record) {
+            i = (i + 1) & table.m_mask;
+        }
+        table.m_slots[i].m_hash.store(hash, std::memory_order_relaxed);
+        table.m_slots[i].m_record.store(entry, std::memory_order_release);
+        return occupant == nullptr;
+    };
+
+    KeyHashTable* table = m_key_tables.back().get();
+    const size_t capacity = table->m_mask + 1;
+    if ((m_num_keyed + 1) * 2 > capacity) {
+        // Rehash without the erased slots, doubling only if the live entries need it
+        size_t live = 0;
+        for (size_t i = 0; i < capacity; ++i) {
+            auto* entry = table->m_slots[i].m_record.load(std::memory_order_relaxed);
+            if (entry != nullptr && entry != k_erased_key_record) { ++live; }
+        }
+        auto rehashed =
+            std::make_unique<KeyHashTable>((live + 1) * 2 > capacity ? capacity * 2 : capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            const auto& slot = table->m_slots[i];
+            auto* entry = slot.m_record.load(std::memory_order_relaxed);
+            if (entry != nullptr && entry != k_erased_key_record) {
+                insert(*rehashed, slot.m_hash.load(std::memory_order_relaxed), entry);
+            }
+        }
+        m_num_keyed = live;
+        table = rehashed.get();
+        m_key_tables.push_back(std::move(rehashed));
+        m_key_table.store(table, std::memory_order_release);
+    }
+
+    if (insert(*table, detail::fnv1a_64(record->m_key), record)) { ++m_num_keyed; }
+}
+
+void State::erase_key_hash(const ParameterRecord* record) {
+    // Caller holds m_storage_mutex. The slot stays non-empty, so probe
+    // sequences running through it stay intact.
+    KeyHashTable& table = *m_key_tables.back();
+    const uint64_t hash = detail::fnv1a_64(record->m_key);
+    for (size_t i = hash & table.m_mask;; i = (i + 1) & table.m_mask) {
+        auto& slot = table.m_slots[i];
+        const ParameterRecord* entry = slot.m_record.load(std::memory_order_relaxed);
+        if (entry == nullptr) { return; }  // Not indexed (batched)
+        if (entry == record) {
+            slot.m_record.store(k_erased_key_record, std::memory_order_release);
+            return;
+        }
+    }
+}
+
 ParameterRecord* State::get_record_by_id(uint32_t id) const {
     ParameterRecord* record = nullptr;
     m_id_index_rcu.read([&](const IdIndexMap& idx) {
-        auto it = idx.find(id);
-        if (it == idx.end()) { throw StateKeyNotFoundException("id:" + std::to_string(id)); }
-        record = it->second;
+        if (auto* const* found = idx.find(id)) { record = *found; }
     });
+    if (record == nullptr && sees_open_batch()) {
+        std::scoped_lock const lock(m_storage_mutex);
+        auto it = m_batched_ids.find(id);
+        if (it != m_batched_ids.end()) { record = it->second; }
+    }
+    if (record == nullptr) { throw StateKeyNotFoundException("id:" + std::to_string(id)); }
     return record;
 }
 
@@ -128,14 +244,14 @@ T State::read_value(ParameterRecord* record, bool allow_blocking) const TANH_NON
             }
             case ParameterType::Double:
                 return std::to_string(
-                    record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             case ParameterType::Float:
                 return std::to_string(
-                    record->m_cache.m_atomic_float.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_float->load(std::memory_order_relaxed));
             case ParameterType::Int:
-                return std::to_string(record->m_cache.m_atomic_int.load(std::memory_order_relaxed));
+                return std::to_string(record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
             case ParameterType::Bool:
-                return record->m_cache.m_atomic_bool.load(std::memory_order_relaxed) ? "true"
+                return record->m_cache.m_atomic_bool->load(std::memory_order_relaxed) ? "true"
                                                                                      : "false";
             default: return "";
         }
@@ -143,18 +259,18 @@ T State::read_value(ParameterRecord* record, bool allow_blocking) const TANH_NON
         switch (param_type) {
             case ParameterType::Double:
                 return static_cast<T>(
-                    record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             case ParameterType::Float:
                 return static_cast<T>(
-                    record->m_cache.m_atomic_float.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_float->load(std::memory_order_relaxed));
             case ParameterType::Int:
-                return static_cast<T>(record->m_cache.m_atomic_int.load(std::memory_order_relaxed));
+                return static_cast<T>(record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
             case ParameterType::Bool:
                 return static_cast<T>(
-                    record->m_cache.m_atomic_bool.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_bool->load(std::memory_order_relaxed));
             case ParameterType::String:
                 return static_cast<T>(
-                    record->m_cache.m_atomic_double.load(std::memory_order_relaxed));
+                    record->m_cache.m_atomic_double->load(std::memory_order_relaxed));
             default: return T{};
         }
     }
@@ -174,22 +290,22 @@ void State::write_value(ParameterRecord* record, const T& value) {
                 std::scoped_lock const lock(m_storage_mutex);
                 record->m_string_value = value;
             }
-            record->m_cache.m_atomic_double.store(d_value, std::memory_order_relaxed);
+            record->m_cache.m_atomic_double->store(d_value, std::memory_order_relaxed);
         } else {
             switch (record->m_def.m_type) {
                 case ParameterType::Double:
-                    record->m_cache.m_atomic_double.store(d_value, std::memory_order_relaxed);
+                    record->m_cache.m_atomic_double->store(d_value, std::memory_order_relaxed);
                     break;
                 case ParameterType::Float:
-                    record->m_cache.m_atomic_float.store(static_cast<float>(d_value),
+                    record->m_cache.m_atomic_float->store(static_cast<float>(d_value),
                                                          std::memory_order_relaxed);
                     break;
                 case ParameterType::Int:
-                    record->m_cache.m_atomic_int.store(static_cast<int>(d_value),
+                    record->m_cache.m_atomic_int->store(static_cast<int>(d_value),
                                                        std::memory_order_relaxed);
                     break;
                 case ParameterType::Bool:
-                    record->m_cache.m_atomic_bool.store(d_value != 0.0, std::memory_order_relaxed);
+                    record->m_cache.m_atomic_bool->store(d_value != 0.0, std::memory_order_relaxed);
                     break;
                 default: break;
             }
@@ -197,26 +313,26 @@ void State::write_value(ParameterRecord* record, const T& value) {
     } else {
         switch (record->m_def.m_type) {
             case ParameterType::Double:
-                record->m_cache.m_atomic_double.store(static_cast<double>(value),
+                record->m_cache.m_atomic_double->store(static_cast<double>(value),
                                                       std::memory_order_relaxed);
                 break;
             case ParameterType::Float:
-                record->m_cache.m_atomic_float.store(static_cast<float>(value),
+                record->m_cache.m_atomic_float->store(static_cast<float>(value),
                                                      std::memory_order_relaxed);
                 break;
             case ParameterType::Int:
-                record->m_cache.m_atomic_int.store(static_cast<int>(value),
+                record->m_cache.m_atomic_int->store(static_cast<int>(value),
                                                    std::memory_order_relaxed);
                 break;
             case ParameterType::Bool:
                 if constexpr (std::is_same_v<T, bool>) {
-                    record->m_cache.m_atomic_bool.store(value, std::memory_order_relaxed);
+                    record->m_cache.m_atomic_bool->store(value, std::memory_order_relaxed);
                 } else {
-                    record->m_cache.m_atomic_bool.store(value != T{0}, std::memory_order_relaxed);
+                    record->m_cache.m_atomic_bool->store(value != T{0}, std::memory_order_relaxed);
                 }
                 break;
             case ParameterType::String:
-                record->m_cache.m_atomic_double.store(static_cast<double>(value),
+                record->m_cache.m_atomic_double->store(static_cast<double>(value),
                                                       std::memory_order_relaxed);
                 break;
             default: break;
@@ -245,6 +361,27 @@ ParameterHandle<T> State::make_handle(ParameterRecord* record) const {
 }
 
 void State::notify_after_write(ParameterRecord* record, ParameterListener* source) {
+    const uint32_t index = record->m_notify_index;
+    if (m_notification_mode.load(std::memory_order_relaxed) == NotificationMode::Deferred &&
+        index != UINT32_MAX) {
+        if (source != nullptr && source->m_strategy == NotifyStrategies::None) { return; }
+        mark_pending(record);
+        return;
+    }
+    notify_now(record, source);
+}
+
+void State::mark_pending(const ParameterRecord* record) TANH_NONBLOCKING_FUNCTION {
+    const uint32_t index = record->m_notify_index;
+    if (index == UINT32_MAX) { return; }
+    // Release pairs with the exchange in dispatch_pending(), which then
+    // sees this write's value
+    const size_t bit = index % k_dirty_chunk_bits;
+    m_dirty_chunks[index / k_dirty_chunk_bits]->m_words[bit / 64].fetch_or(
+        uint64_t{1} << (bit % 64), std::memory_order_release);
+}
+
+void State::notify_now(ParameterRecord* record, ParameterListener* source) {
     // Copy key before notifying (key may point into temp buffer
     // which re-entrant set() calls from listeners would overwrite)
     std::string const key_copy(record->m_key);
@@ -259,6 +396,66 @@ void State::notify_after_write(ParameterRecord* record, ParameterListener* sourc
     }
 }
 
+// ── Deferred notifications ──────────────────────────────────────────────────
+
+void State::assign_notify_index(ParameterRecord* record) {
+    // Caller holds m_storage_mutex, before the record is published
+    uint32_t index = 0;
+    if (!m_free_notify_indices.empty()) {
+        index = m_free_notify_indices.back();
+        m_free_notify_indices.pop_back();
+        m_notify_records[index] = record;
+    } else {
+        index = static_cast<uint32_t>(m_notify_records.size());
+        // Past the dirty set's capacity, writes always notify immediately
+        if (index >= k_max_dirty_chunks * k_dirty_chunk_bits) { return; }
+        auto& chunk = m_dirty_chunks[index / k_dirty_chunk_bits];
+        if (!chunk) { chunk = std::make_unique<DirtyChunk>(); }
+        m_notify_records.push_back(record);
+    }
+    record->m_notify_index = index;
+}
+
+void State::release_notify_index(const ParameterRecord* record) {
+    // Caller holds m_storage_mutex
+    const uint32_t index = record->m_notify_index;
+    if (index == UINT32_MAX) { return; }
+    const size_t bit = index % k_dirty_chunk_bits;
+    m_dirty_chunks[index / k_dirty_chunk_bits]->m_words[bit / 64].fetch_and(
+        ~(uint64_t{1} << (bit % 64)), std::memory_order_relaxed);
+    m_notify_records[index] = nullptr;
+    m_free_notify_indices.push_back(index);
+}
+
+void State::set_notification_mode(NotificationMode mode) {
+    const NotificationMode previous = m_notification_mode.exchange(mode, std::memory_order_relaxed);
+    if (previous == NotificationMode::Deferred && mode == NotificationMode::Immediate) {
+        dispatch_pending();
+    }
+}
+
+size_t State::dispatch_pending() {
+    std::scoped_lock const dispatch_lock(m_dispatch_mutex);
+    m_dispatch_batch.clear();
+    {
+        std::scoped_lock const lock(m_storage_mutex);
+        const size_t num_words = (m_notify_records.size() + 63) / 64;
+        for (size_t w = 0; w < num_words; ++w) {
+            auto& word = m_dirty_chunks[w / k_dirty_chunk_words]->m_words[w % k_dirty_chunk_words];
+            if (word.load(std::memory_order_relaxed) == 0) { continue; }
+            for (uint64_t bits = word.exchange(0, std::memory_order_acquire); bits != 0;
+                 bits &= bits - 1) {
+                const size_t index = w * 64 + static_cast<size_t>(std::countr_zero(bits));
+                if (auto* record = m_notify_records[index]) { m_dispatch_batch.push_back(record); }
+            }
+        }
+    }
+
+    // Outside the storage lock: listeners may write parameters
+    for (auto* record : m_dispatch_batch) { notify_now(record, nullptr); }
+    return m_dispatch_batch.size();
+}
+
 // ── Parameter creation ──────────────────────────────────────────────────────
 
 void State::create_in_root(std::string_view key, ParameterDefinition def) {
@@ -277,51 +474,42 @@ void State::create_in_root(std::string_view key, ParameterDefinition def) {
     }
 
     ParameterRecord* record = nullptr;
+    bool batched = false;
     {
         std::scoped_lock const lock(m_storage_mutex);
         auto new_record = std::make_unique<ParameterRecord>(std::move(def));
-
-        // Set initial value from the definition's default_value
-        switch (new_record->m_def.m_type) {
-            case ParameterType::Double:
-                new_record->m_cache.m_atomic_double.store(
-                    static_cast<double>(new_record->m_def.m_default_value),
-                    std::memory_order_relaxed);
-                break;
-            case ParameterType::Float:
-                new_record->m_cache.m_atomic_float.store(new_record->m_def.m_default_value,
-                                                         std::memory_order_relaxed);
-                break;
-            case ParameterType::Int:
-                new_record->m_cache.m_atomic_int.store(
-                    static_cast<int>(new_record->m_def.m_default_value),
-                    std::memory_order_relaxed);
-                break;
-            case ParameterType::Bool:
-                new_record->m_cache.m_atomic_bool.store(new_record->m_def.m_default_value != 0.0f,
-                                                        std::memory_order_relaxed);
-                break;
-            case ParameterType::String:
-                // String default: store 0.0 in atomic_double
-                new_record->m_cache.m_atomic_double.store(0.0, std::memory_order_relaxed);
-                break;
-            default: break;
-        }
+        // The slot starts at the definition's default_value
+        m_values.allocate(*new_record);
 
         record = new_record.get();
+        assign_notify_index(record);
         auto [it, inserted] = m_storage.emplace(std::string(key), std::move(new_record));
         // Set m_key to point into the map node's key (stable for lifetime of entry)
         record->m_key = it->first;
+        batched = m_batch_depth > 0;
+        if (!batched) { index_key_hash(record); }
     }
 
-    // Publish the new entry in the lock-free string index
-    m_string_index_rcu.update([&](StringIndexMap& idx) { idx[std::string(key)] = record; });
+    if (batched) {
+        // Defer publication to end_batch(), but still reject duplicate IDs now
+        const uint32_t id = record->m_def.m_id;
+        bool const indexed =
+            m_id_index_rcu.read([&](const IdIndexMap& idx) { return idx.contains(id); });
+        std::scoped_lock const lock(m_storage_mutex);
+        if (indexed || !m_batched_ids.emplace(id, record).second) {
+            throw DuplicateParameterIdException(id, key);
+        }
+        m_batched_records.push_back(record);
+    } else {
+        // Publish the new entry in the lock-free string index
+        m_string_index_rcu.update(
+            [&](StringIndexMap& idx) { idx.insert_or_assign(std::string(key), record); });
 
-    // Index by ID
-    m_id_index_rcu.update([&](IdIndexMap& idx) {
-        auto [id_it, id_inserted] = idx.emplace(record->m_def.m_id, record);
-        if (!id_inserted) { throw DuplicateParameterIdException(record->m_def.m_id, key); }
-    });
+        // Index by ID
+        m_id_index_rcu.update([&](IdIndexMap& idx) {
+            if (!idx.insert(record->m_def.m_id, record)) { throw DuplicateParameterIdException(record->m_def.m_id, key); }
+        });
+    }
 
     // Notify listeners — copy key before notifying (re-entrant calls may overwrite temp buffers)
     std::string const key_copy(key);
@@ -369,14 +557,14 @@ void State::create_in_root(std::string_view key, const T& initial_value) {
     auto* record = get_record(key);
     if (record) {
         if constexpr (std::is_same_v<T, double>) {
-            record->m_cache.m_atomic_double.store(initial_value, std::memory_order_relaxed);
+            record->m_cache.m_atomic_double->store(initial_value, std::memory_order_relaxed);
         } else if constexpr (std::is_same_v<T, int>) {
-            record->m_cache.m_atomic_int.store(initial_value, std::memory_order_relaxed);
+            record->m_cache.m_atomic_int->store(initial_value, std::memory_order_relaxed);
         } else if constexpr (std::is_same_v<T, std::string>) {
             std::scoped_lock const lock(m_storage_mutex);
             record->m_string_value = initial_value;
             const double d_value = parse_string_as_double(initial_value);
-            record->m_cache.m_atomic_double.store(d_value, std::memory_order_relaxed);
+            record->m_cache.m_atomic_double->store(d_value, std::memory_order_relaxed);
         }
     }
 }
@@ -399,6 +587,18 @@ void State::set_in_root(std::string_view key, const char* value, ParameterListen
     set_in_root(key, std::string(value), source);
 }
 
+template <typename T>
+void State::set_in_root(ParamKey key, const T& value, ParameterListener* source) {
+    auto* record = get_record(key);
+    if (!record) { throw StateKeyNotFoundException(key.path()); }
+    write_value(record, value);
+    notify_after_write(record, source);
+}
+
+void State::set_in_root(ParamKey key, const char* value, ParameterListener* source) {
+    set_in_root(key, std::string(value), source);
+}
+
 // ── Parameter access ────────────────────────────────────────────────────────
 
 template <typename T>
@@ -408,6 +608,13 @@ T State::get_from_root(std::string_view key, bool allow_blocking) const TANH_NON
     return read_value<T>(record, allow_blocking);
 }
 
+template <typename T>
+T State::get_from_root(ParamKey key, bool allow_blocking) const TANH_NONBLOCKING_FUNCTION {
+    auto* record = get_record(key);
+    if (!record) { throw StateKeyNotFoundException(key.path()); }
+    return read_value<T>(record, allow_blocking);
+}
+
 Parameter State::get_parameter_from_root(std::string_view key) const {
     auto* record = get_record(key);
     if (!record) { throw StateKeyNotFoundException(key); }
@@ -499,9 +706,7 @@ void State::from_json(const nlohmann::json& json_data, ParameterListener* source
     ensure_thread_registered();
 
     auto check_parameter_exists = [this](std::string_view key) {
-        bool const exists = m_string_index_rcu.read(
-            [&](const StringIndexMap& idx) { return idx.find(key) != idx.end(); });
-        if (!exists) { throw StateKeyNotFoundException(key); }
+        if (get_record(key) == nullptr) { throw StateKeyNotFoundException(key); }
     };
 
     std::function<void(const nlohmann::json&, std::string_view)> update_parameters;
@@ -554,6 +759,183 @@ void State::from_json(const nlohmann::json& json_data, ParameterListener* source
     }
 }
 
+// ── Binary snapshot ─────────────────────────────────────────────────────────
+
+std::vector<std::byte> State::to_binary() const {
+    std::vector<std::byte> out;
+    std::scoped_lock const lock(m_storage_mutex);
+
+    size_t string_bytes = 0;
+    for (const auto& [key, record] : m_storage) {
+        if (record->m_def.m_type == ParameterType::String) {
+            string_bytes += record->m_string_value.size();
+        }
+    }
+    out.reserve(detail::snapshot_align(detail::k_snapshot_header_size +
+                                       m_storage.size() * detail::k_state_snapshot_entry_size +
+                                       string_bytes));
+
+    detail::SnapshotWriter writer(out);
+    writer.put_bytes(detail::k_state_snapshot_magic.data(), detail::k_state_snapshot_magic.size());
+    writer.put<uint32_t>(detail::k_snapshot_version);
+    writer.put<uint32_t>(detail::k_snapshot_header_size);
+    writer.put<uint32_t>(static_cast<uint32_t>(m_storage.size()));
+    writer.put<uint32_t>(static_cast<uint32_t>(string_bytes));
+    writer.put<uint32_t>(detail::k_state_snapshot_entry_size);
+    writer.put<uint32_t>(0);
+
+    uint32_t string_offset = 0;
+    for (const auto& [key, record] : m_storage) {
+        const ParameterType type = record->m_def.m_type;
+        uint64_t payload = 0;
+        switch (type) {
+            case ParameterType::Double: {
+                const double value = record->m_cache.m_atomic_double->load(std::memory_order_relaxed);
+                std::memcpy(&payload, &value, sizeof(value));
+                break;
+            }
+            case ParameterType::Float: {
+                const float value = record->m_cache.m_atomic_float->load(std::memory_order_relaxed);
+                uint32_t bits = 0;
+                std::memcpy(&bits, &value, sizeof(value));
+                payload = bits;
+                break;
+            }
+            case ParameterType::Int:
+                payload = static_cast<uint32_t>(
+                    record->m_cache.m_atomic_int->load(std::memory_order_relaxed));
+                break;
+            case ParameterType::Bool:
+                payload = record->m_cache.m_atomic_bool->load(std::memory_order_relaxed) ? 1 : 0;
+                break;
+            case ParameterType::String: {
+                const auto size = static_cast<uint32_t>(record->m_string_value.size());
+                payload = string_offset | (uint64_t{size} << 32);
+                string_offset += size;
+                break;
+            }
+        }
+        writer.put<uint32_t>(record->m_def.m_id);
+        writer.put<uint8_t>(static_cast<uint8_t>(type));
+        writer.put_bytes(std::array<uint8_t, 3>{}.data(), 3);
+        writer.put<uint64_t>(payload);
+    }
+
+    for (const auto& [key, record] : m_storage) {
+        if (record->m_def.m_type == ParameterType::String) {
+            writer.put_bytes(record->m_string_value.data(), record->m_string_value.size());
+        }
+    }
+    writer.pad_to_alignment();
+    return out;
+}
+
+void State::from_binary(std::span<const std::byte> data, ParameterListener* source) {
+    ensure_thread_registered();
+
+    const detail::SnapshotReader reader(data);
+    const size_t header_size = reader.check_header(detail::k_state_snapshot_magic);
+    const auto num_parameters = reader.get<uint32_t>(16);
+    const auto string_bytes = reader.get<uint32_t>(20);
+    const auto entry_size = reader.get<uint32_t>(24);
+    if (entry_size < detail::k_state_snapshot_entry_size) {
+        throw SnapshotFormatException("bad entry size");
+    }
+    const size_t strings_offset = header_size + size_t{num_parameters} * entry_size;
+    reader.require(strings_offset, string_bytes);
+
+    // Resolve and validate every entry before writing any, so a bad
+    // snapshot leaves the State untouched
+    std::vector<ParameterRecord*> records(num_parameters);
+    for (size_t i = 0; i < num_parameters; ++i) {
+        const size_t offset = header_size + i * entry_size;
+        records[i] = get_record_by_id(reader.get<uint32_t>(offset));
+        const auto type = reader.get<uint8_t>(offset + 4);
+        if (type > static_cast<uint8_t>(ParameterType::String)) {
+            throw SnapshotFormatException("unknown parameter type");
+        }
+        if (static_cast<ParameterType>(type) == ParameterType::String) {
+            const auto payload = reader.get<uint64_t>(offset + 8);
+            if ((payload & 0xFFFFFFFFu) + (payload >> 32) > string_bytes) {
+                throw SnapshotFormatException("string out of range");
+            }
+        }
+    }
+
+    for (size_t i = 0; i < num_parameters; ++i) {
+        const size_t offset = header_size + i * entry_size;
+        auto* record = records[i];
+        const auto payload = reader.get<uint64_t>(offset + 8);
+
+        switch (static_cast<ParameterType>(reader.get<uint8_t>(offset + 4))) {
+            case ParameterType::Double: {
+                double value = 0.0;
+                std::memcpy(&value, &payload, sizeof(value));
+                write_value(record, value);
+                break;
+            }
+            case ParameterType::Float: {
+                const auto bits = static_cast<uint32_t>(payload);
+                float value = 0.0f;
+                std::memcpy(&value, &bits, sizeof(value));
+                write_value(record, value);
+                break;
+            }
+            case ParameterType::Int:
+                write_value(record, static_cast<int>(static_cast<int32_t>(payload)));
+                break;
+            case ParameterType::Bool: write_value(record, payload != 0); break;
+            case ParameterType::String:
+                write_value(record,
+                            std::string(reader.get_string(strings_offset + (payload & 0xFFFFFFFFu),
+                                                          payload >> 32)));
+                break;
+        }
+        notify_after_write(record, source);
+    }
+}
+
+StateSnapshot State::capture_snapshot() const {
+    StateSnapshot snapshot;
+    std::scoped_lock const lock(m_storage_mutex);
+    for (const auto& [key, record] : m_storage) {
+        const auto& cache = record->m_cache;
+        const uint32_t id = record->m_def.m_id;
+        switch (record->m_def.m_type) {
+            case ParameterType::Double:
+                snapshot.set_value(id, cache.m_atomic_double->load(std::memory_order_relaxed));
+                break;
+            case ParameterType::Float:
+                snapshot.set_value(id, cache.m_atomic_float->load(std::memory_order_relaxed));
+                break;
+            case ParameterType::Int:
+                snapshot.set_value(id, cache.m_atomic_int->load(std::memory_order_relaxed));
+                break;
+            case ParameterType::Bool:
+                snapshot.set_value(id,
+                                   cache.m_atomic_bool->load(std::memory_order_relaxed) ? 1.0 : 0.0);
+                break;
+            case ParameterType::String: break;
+        }
+    }
+    return snapshot;
+}
+
+void State::snapshot_values(std::span<float> values) const TANH_NONBLOCKING_FUNCTION {
+    auto copy = [values](uint32_t id, auto value) {
+        if (id < values.size()) { values[id] = static_cast<float>(value); }
+    };
+    m_values.floats().for_each(copy);
+    m_values.doubles().for_each(copy);
+    m_values.ints().for_each(copy);
+    m_values.bools().for_each(copy);
+}
+
+size_t State::value_store_bytes() const {
+    std::scoped_lock const lock(m_storage_mutex);
+    return m_values.memory_bytes();
+}
+
 // ── State dump ──────────────────────────────────────────────────────────────
 
 nlohmann::json State::to_json(bool include_definitions) const {
@@ -576,16 +958,16 @@ nlohmann::json State::group_to_json(std::string_view group_prefix, bool include_
         switch (record->m_def.m_type) {
             case ParameterType::Double:
                 param_obj["value"] =
-                    record->m_cache.m_atomic_double.load(std::memory_order_relaxed);
+                    record->m_cache.m_atomic_double->load(std::memory_order_relaxed);
                 break;
             case ParameterType::Float:
-                param_obj["value"] = record->m_cache.m_atomic_float.load(std::memory_order_relaxed);
+                param_obj["value"] = record->m_cache.m_atomic_float->load(std::memory_order_relaxed);
                 break;
             case ParameterType::Int:
-                param_obj["value"] = record->m_cache.m_atomic_int.load(std::memory_order_relaxed);
+                param_obj["value"] = record->m_cache.m_atomic_int->load(std::memory_order_relaxed);
                 break;
             case ParameterType::Bool:
-                param_obj["value"] = record->m_cache.m_atomic_bool.load(std::memory_order_relaxed);
+                param_obj["value"] = record->m_cache.m_atomic_bool->load(std::memory_order_relaxed);
                 break;
             case ParameterType::String: param_obj["value"] = record->m_string_value; break;
             default: break;
@@ -646,6 +1028,45 @@ nlohmann::json State::group_to_json(std::string_view group_prefix, bool include_
     return root;
 }
 
+// ── Batched creation ────────────────────────────────────────────────────────
+
+State::Batch State::begin_batch() {
+    std::scoped_lock const lock(m_storage_mutex);
+    if (m_batch_depth++ == 0) {
+        m_batch_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    }
+    m_batch_open.store(true, std::memory_order_release);
+    return Batch(this);
+}
+
+void State::end_batch() {
+    std::vector<ParameterRecord*> records;
+    {
+        std::scoped_lock const lock(m_storage_mutex);
+        if (--m_batch_depth > 0) { return; }
+        records = m_batched_records;
+    }
+
+    // One update per index for the whole batch. The records stay reachable
+    // by this thread through the locked fallback until both indices have them.
+    if (!records.empty()) {
+        m_string_index_rcu.update([&](StringIndexMap& idx) {
+            for (auto* record : records) { idx.insert_or_assign(std::string(record->m_key), record); }
+        });
+        m_id_index_rcu.update([&](IdIndexMap& idx) {
+            for (auto* record : records) { idx.insert_or_assign(record->m_def.m_id, record); }
+        });
+    }
+
+    std::scoped_lock const lock(m_storage_mutex);
+    if (m_batch_depth > 0) { return; }
+    for (auto* record : m_batched_records) { index_key_hash(record); }
+    m_batched_records.clear();
+    m_batched_ids.clear();
+    m_batch_open.store(false, std::memory_order_release);
+    m_batch_owner.store(std::thread::id{}, std::memory_order_relaxed);
+}
+
 // ── State management ────────────────────────────────────────────────────────
 
 void State::clear() {
@@ -654,7 +1075,27 @@ void State::clear() {
 
     {
         std::scoped_lock const lock(m_storage_mutex);
+        m_batched_records.clear();
+        m_batched_ids.clear();
+
+        // Empty the live key table in place; readers just miss
+        KeyHashTable& table = *m_key_tables.back();
+        for (size_t i = 0; i <= table.m_mask; ++i) {
+            table.m_slots[i].m_record.store(nullptr, std::memory_order_release);
+        }
+        m_num_keyed = 0;
+
+        // Forget every dirty bit; the chunks stay allocated
+        for (const auto& chunk : m_dirty_chunks) {
+            if (!chunk) { continue; }
+            for (auto& word : chunk->m_words) { word.store(0, std::memory_order_relaxed); }
+        }
+        m_notify_records.clear();
+        m_free_notify_indices.clear();
+
+        m_values.clear();
         m_storage.clear();
+        m_removal_generation.fetch_add(1, std::memory_order_release);
     }
 
     m_next_auto_id = 0;
@@ -703,6 +1144,33 @@ template TANH_API bool State::get_from_root(std::string_view key,
 template TANH_API std::string State::get_from_root(std::string_view key, bool allow_blocking) const
     TANH_NONBLOCKING_FUNCTION;
 
+template TANH_API void State::set_in_root(ParamKey key,
+                                          const double& value,
+                                          ParameterListener* source);
+template TANH_API void State::set_in_root(ParamKey key,
+                                          const float& value,
+                                          ParameterListener* source);
+template TANH_API void State::set_in_root(ParamKey key,
+                                          const int& value,
+                                          ParameterListener* source);
+template TANH_API void State::set_in_root(ParamKey key,
+                                          const bool& value,
+                                          ParameterListener* source);
+template TANH_API void State::set_in_root(ParamKey key,
+                                          const std::string& value,
+                                          ParameterListener* source);
+
+template TANH_API double State::get_from_root(ParamKey key,
+                                              bool allow_blocking) const TANH_NONBLOCKING_FUNCTION;
+template TANH_API float State::get_from_root(ParamKey key,
+                                             bool allow_blocking) const TANH_NONBLOCKING_FUNCTION;
+template TANH_API int State::get_from_root(ParamKey key,
+                                           bool allow_blocking) const TANH_NONBLOCKING_FUNCTION;
+template TANH_API bool State::get_from_root(ParamKey key,
+                                            bool allow_blocking) const TANH_NONBLOCKING_FUNCTION;
+template TANH_API std::string State::get_from_root(ParamKey key, bool allow_blocking) const
+    TANH_NONBLOCKING_FUNCTION;
+
 template TANH_API ParameterHandle<double> State::get_handle_from_root(std::string_view key) const;
 template TANH_API ParameterHandle<float> State::get_handle_from_root(std::string_view key) const;
 template TANH_API ParameterHandle<int> State::get_handle_from_root(std::string_view key) const;
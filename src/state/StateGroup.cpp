@@ -56,11 +56,10 @@ StateGroup* StateGroup::create_group(std::string_view name) {
 }
 
 StateGroup* StateGroup::get_group(std::string_view name) const TANH_NONBLOCKING_FUNCTION {
-    std::string name_str(name);
     StateGroup* found_group = nullptr;
 
     m_groups_rcu.read([&](const GroupMap& groups) {
-        auto it = groups.find(name_str);
+        auto it = groups.find(name);
         if (it != groups.end()) { found_group = it->second.get(); }
     });
 
@@ -68,11 +67,9 @@ StateGroup* StateGroup::get_group(std::string_view name) const TANH_NONBLOCKING_
 }
 
 bool StateGroup::has_group(std::string_view name) const TANH_NONBLOCKING_FUNCTION {
-    std::string name_str(name);
     bool found = false;
 
-    m_groups_rcu.read(
-        [&](const GroupMap& groups) { found = groups.find(name_str) != groups.end(); });
+    m_groups_rcu.read([&](const GroupMap& groups) { found = groups.find(name) != groups.end(); });
 
     return found;
 }
@@ -128,7 +125,7 @@ std::pair<StateGroup*, std::string_view> StateGroup::resolve_path(std::string_vi
 
     StateGroup* found_group = nullptr;
     m_groups_rcu.read([&](const GroupMap& groups) {
-        auto group_it = groups.find(std::string(group_name));
+        auto group_it = groups.find(group_name);
         if (group_it != groups.end()) { found_group = group_it->second.get(); }
     });
 
@@ -144,7 +141,7 @@ std::pair<StateGroup*, std::string_view> StateGroup::resolve_path_create(std::st
 
     StateGroup* child_group = nullptr;
     m_groups_rcu.read([&](const GroupMap& groups) {
-        auto group_it = groups.find(std::string(group_name));
+        auto group_it = groups.find(group_name);
         if (group_it != groups.end()) { child_group = group_it->second.get(); }
     });
 
@@ -391,10 +388,14 @@ void StateGroup::clear() {
         std::string_view const full_path = get_full_path();
 
         std::vector<std::string> keys_to_delete;
+        std::vector<uint32_t> ids_to_delete;
         {
             std::scoped_lock const lock(m_root_state->m_storage_mutex);
             for (const auto& [key, record] : m_root_state->m_storage) {
-                if (key.starts_with(full_path)) { keys_to_delete.push_back(key); }
+                if (key.starts_with(full_path)) {
+                    keys_to_delete.push_back(key);
+                    ids_to_delete.push_back(record->m_def.m_id);
+                }
             }
         }
 
@@ -404,17 +405,28 @@ void StateGroup::clear() {
 
         // Remove deleted parameters from the ID index
         m_root_state->m_id_index_rcu.update([&](auto& idx) {
-            std::erase_if(idx, [&](const auto& pair) {
-                for (const auto& key : keys_to_delete) {
-                    if (pair.second->m_key == key) { return true; }
-                }
-                return false;
-            });
+            for (const uint32_t id : ids_to_delete) { idx.erase(id); }
         });
 
         {
             std::scoped_lock const lock(m_root_state->m_storage_mutex);
-            for (const auto& key : keys_to_delete) { m_root_state->m_storage.erase(key); }
+            // Drop batched records that are about to be destroyed
+            std::erase_if(m_root_state->m_batched_records, [&](const ParameterRecord* record) {
+                if (!record->m_key.starts_with(full_path)) { return false; }
+                m_root_state->m_batched_ids.erase(record->m_def.m_id);
+                return true;
+            });
+            for (const auto& key : keys_to_delete) {
+                auto it = m_root_state->m_storage.find(key);
+                if (it == m_root_state->m_storage.end()) { continue; }
+                m_root_state->erase_key_hash(it->second.get());
+                m_root_state->release_notify_index(it->second.get());
+                m_root_state->m_values.release(*it->second);
+                m_root_state->m_storage.erase(it);
+            }
+            if (!keys_to_delete.empty()) {
+                m_root_state->m_removal_generation.fetch_add(1, std::memory_order_release);
+            }
         }
     }
     clear_groups();
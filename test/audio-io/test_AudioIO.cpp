@@ -18,6 +18,7 @@
 #include "tanh/audio-io/AudioIODeviceCallback.h"
 #include "tanh/audio-io/AudioPlayerSource.h"
 #include "tanh/audio-io/DataSource.h"
+#include "tanh/core/threading/DeferredReclaimer.h"
 
 using namespace thl;
 
@@ -559,6 +560,134 @@ TEST(AudioFileSink, ReleaseResources) {
     std::filesystem::remove(test_file);
 }
 
+TEST(AudioFileSink, ThreadedModeWritesEveryFrame) {
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+    std::filesystem::path test_file = temp_dir / "test_audio_sink_threaded.wav";
+
+    constexpr size_t k_frame_count = 256;
+    constexpr size_t k_num_blocks = 16;
+    constexpr size_t k_num_channels = 2;
+    constexpr size_t k_sample_rate = 48000;
+
+    std::vector<float> source_data(k_frame_count * k_num_blocks * k_num_channels);
+    for (size_t i = 0; i < source_data.size(); ++i) {
+        source_data[i] = std::sin(static_cast<float>(i) * 0.01f) * 0.5f;
+    }
+
+    {
+        AudioFileSink sink;
+        ASSERT_TRUE(sink.open_file(test_file.string(),
+                                   k_num_channels,
+                                   k_sample_rate,
+                                   AudioEncodingFormat::WAV,
+                                   AudioRecordingMode::Threaded));
+        EXPECT_EQ(sink.get_recording_mode(), AudioRecordingMode::Threaded);
+        sink.start_recording();
+
+        std::array<float, k_frame_count * k_num_channels> output{};
+        for (size_t b = 0; b < k_num_blocks; ++b) {
+            sink.process(output.data(),
+                         source_data.data() + b * k_frame_count * k_num_channels,
+                         k_frame_count,
+                         k_num_channels,
+                         0);
+        }
+
+        // close_file() drains the ring before finalising the file.
+        sink.close_file();
+        EXPECT_EQ(sink.get_frames_written(), k_frame_count * k_num_blocks);
+        EXPECT_EQ(sink.get_overflow_count(), 0u);
+    }
+
+    thl::audio_io::AudioFileLoader loader;
+    auto buffer = loader.load_from_file(test_file.string(), k_sample_rate, k_num_channels);
+    ASSERT_EQ(buffer.get_num_frames(), k_frame_count * k_num_blocks);
+    for (size_t ch = 0; ch < k_num_channels; ++ch) {
+        const float* ptr = buffer.get_read_pointer(ch);
+        for (size_t f = 0; f < k_frame_count * k_num_blocks; ++f) {
+            ASSERT_FLOAT_EQ(ptr[f], source_data[f * k_num_channels + ch])
+                << "Mismatch at ch=" << ch << " frame=" << f;
+        }
+    }
+
+    std::filesystem::remove(test_file);
+}
+
+TEST(AudioFileSink, ThreadedModeCountsOverflow) {
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+    std::filesystem::path test_file = temp_dir / "test_audio_sink_overflow.wav";
+
+    constexpr size_t k_num_channels = 2;
+    constexpr uint32_t k_sample_rate = 48000;
+    // Ring of 128 frames: a 256-frame block can never fit, a 64-frame one can.
+    constexpr float k_buffer_seconds = 128.0f / static_cast<float>(k_sample_rate);
+
+    AudioFileSink sink;
+    ASSERT_TRUE(sink.open_file(test_file.string(),
+                               k_num_channels,
+                               k_sample_rate,
+                               AudioEncodingFormat::WAV,
+                               AudioRecordingMode::Threaded,
+                               k_buffer_seconds));
+    sink.start_recording();
+
+    std::array<float, 256 * k_num_channels> output{};
+    std::array<float, 256 * k_num_channels> input{};
+    sink.process(output.data(), input.data(), 256, k_num_channels, 0);
+    EXPECT_EQ(sink.get_overflow_count(), 256u);
+
+    sink.process(output.data(), input.data(), 64, k_num_channels, 0);
+    sink.close_file();
+    EXPECT_EQ(sink.get_overflow_count(), 256u);
+    EXPECT_EQ(sink.get_frames_written(), 64u);
+
+    std::filesystem::remove(test_file);
+}
+
+TEST(AudioFileSink, ThreadedModeCloseWhileProcessing) {
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+    std::filesystem::path test_file = temp_dir / "test_audio_sink_close_live.wav";
+
+    constexpr uint32_t k_frame_count = 64;
+    constexpr size_t k_num_channels = 2;
+    constexpr uint32_t k_sample_rate = 48000;
+
+    AudioFileSink sink;
+    ASSERT_TRUE(sink.open_file(test_file.string(),
+                               k_num_channels,
+                               k_sample_rate,
+                               AudioEncodingFormat::WAV,
+                               AudioRecordingMode::Threaded));
+    sink.start_recording();
+
+    // The "audio thread" keeps calling process() while the file closes
+    std::atomic<bool> done{false};
+    std::thread audio([&]() {
+        std::array<float, k_frame_count * k_num_channels> output{};
+        std::array<float, k_frame_count * k_num_channels> input{};
+        input.fill(0.25f);
+        while (!done.load(std::memory_order_acquire)) {
+            sink.process(output.data(), input.data(), k_frame_count, k_num_channels, 0);
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    sink.close_file();
+    done.store(true, std::memory_order_release);
+    audio.join();
+
+    // Every accepted block reached the file, whole
+    const uint64_t frames_written = sink.get_frames_written();
+    EXPECT_GT(frames_written, 0u);
+    EXPECT_EQ(frames_written % k_frame_count, 0u);
+
+    thl::audio_io::AudioFileLoader loader;
+    auto buffer = loader.load_from_file(test_file.string(), k_sample_rate, k_num_channels);
+    EXPECT_EQ(buffer.get_num_frames(), frames_written);
+
+    std::filesystem::remove(test_file);
+}
+
 // =============================================================================
 // AudioPlayerSource Tests
 // =============================================================================
@@ -1435,3 +1564,157 @@ TEST(AudioPlayerSource, LoadFromMemoryReplacesFile) {
     player.unload_file();
     std::filesystem::remove(test_file);
 }
+
+// =============================================================================
+// AudioPlayerSource streaming mode Tests
+// =============================================================================
+
+namespace {
+
+std::vector<uint8_t> make_ramp_wav(const char* name, uint32_t frame_count, uint32_t sample_rate) {
+    std::filesystem::path test_file = std::filesystem::temp_directory_path() / name;
+    std::vector<float> ramp(frame_count);
+    for (uint32_t i = 0; i < frame_count; ++i) {
+        ramp[i] = static_cast<float>(i) / static_cast<float>(frame_count);
+    }
+    {
+        AudioFileSink sink;
+        if (!sink.open_file(test_file.string(), 1, sample_rate)) { return {}; }
+        sink.start_recording();
+        std::vector<float> sink_output(frame_count);
+        sink.process(sink_output.data(), ramp.data(), frame_count, 1, 0);
+        sink.close_file();
+    }
+    auto bytes = read_file_bytes(test_file);
+    std::filesystem::remove(test_file);
+    return bytes;
+}
+
+}  // namespace
+
+TEST(AudioPlayerSource, StreamingModePlaysWholeFile) {
+    constexpr uint32_t k_frame_count = 4096;
+    constexpr uint32_t k_block = 128;
+    constexpr uint32_t k_sample_rate = 44100;
+
+    auto wav_bytes = make_ramp_wav("test_player_streaming.wav", k_frame_count, k_sample_rate);
+    ASSERT_FALSE(wav_bytes.empty());
+
+    AudioPlayerSource player;
+    player.set_playback_mode(AudioPlaybackMode::Streaming);
+    ASSERT_TRUE(player.load_from_memory(wav_bytes.data(), wav_bytes.size(), 1, k_sample_rate));
+    EXPECT_EQ(player.get_playback_mode(), AudioPlaybackMode::Streaming);
+    EXPECT_EQ(player.get_total_frames(), k_frame_count);
+
+    bool finished = false;
+    player.set_finished_callback([&finished]() { finished = true; });
+    player.set_fade_enabled(false);
+    player.play();
+
+    // The whole file fits in the default window, so load() prefilled it.
+    std::array<float, k_block> read_buf{};
+    std::array<float, k_block> input{};
+    for (uint32_t b = 0; b < k_frame_count / k_block; ++b) {
+        player.process(read_buf.data(), input.data(), k_block, 0, 1);
+        for (uint32_t i = 0; i < k_block; ++i) {
+            ASSERT_FLOAT_EQ(read_buf[i],
+                            static_cast<float>(b * k_block + i) / static_cast<float>(k_frame_count))
+                << "Mismatch at frame " << b * k_block + i;
+        }
+    }
+    EXPECT_EQ(player.get_current_frame(), k_frame_count);
+    EXPECT_EQ(player.get_starvation_count(), 0u);
+
+    player.process(read_buf.data(), input.data(), k_block, 0, 1);
+    EXPECT_TRUE(finished);
+    EXPECT_FALSE(player.is_playing());
+
+    player.unload_file();
+}
+
+TEST(AudioPlayerSource, StreamingModeSeeks) {
+    constexpr uint32_t k_frame_count = 4096;
+    constexpr uint32_t k_sample_rate = 44100;
+
+    auto wav_bytes = make_ramp_wav("test_player_streaming_seek.wav", k_frame_count, k_sample_rate);
+    ASSERT_FALSE(wav_bytes.empty());
+
+    AudioPlayerSource player;
+    player.set_playback_mode(AudioPlaybackMode::Streaming);
+    ASSERT_TRUE(player.load_from_memory(wav_bytes.data(), wav_bytes.size(), 1, k_sample_rate));
+    player.set_fade_enabled(false);
+    player.play();
+
+    std::array<float, 64> read_buf{};
+    std::array<float, 64> input{};
+
+    // Forward seek inside the buffered window: served from the ring at once.
+    player.seek_to_frame(1000);
+    EXPECT_EQ(player.get_current_frame(), 1000u);
+    player.process(read_buf.data(), input.data(), 64, 0, 1);
+    EXPECT_FLOAT_EQ(read_buf[0], 1000.0f / static_cast<float>(k_frame_count));
+    EXPECT_EQ(player.get_current_frame(), 1064u);
+
+    // Backward seek: the decoder has to re-seek the source. Blocks are silent
+    // until it has, and that wait is not counted as starvation.
+    player.seek_to_frame(10);
+    bool served = false;
+    for (int attempt = 0; attempt < 200 && !served; ++attempt) {
+        read_buf.fill(-1.0f);
+        player.process(read_buf.data(), input.data(), 64, 0, 1);
+        served = read_buf[0] != 0.0f;
+        if (!served) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+    }
+    ASSERT_TRUE(served);
+    EXPECT_FLOAT_EQ(read_buf[0], 10.0f / static_cast<float>(k_frame_count));
+    EXPECT_FLOAT_EQ(read_buf[63], 73.0f / static_cast<float>(k_frame_count));
+    EXPECT_EQ(player.get_starvation_count(), 0u);
+
+    player.unload_file();
+}
+
+TEST(AudioPlayerSource, SwitchPlaybackModeKeepsPosition) {
+    constexpr uint32_t k_frame_count = 2048;
+    constexpr uint32_t k_sample_rate = 44100;
+
+    auto wav_bytes = make_ramp_wav("test_player_switch_mode.wav", k_frame_count, k_sample_rate);
+    ASSERT_FALSE(wav_bytes.empty());
+
+    AudioPlayerSource player;
+    ASSERT_TRUE(player.load_from_memory(wav_bytes.data(), wav_bytes.size(), 1, k_sample_rate));
+    player.seek_to_frame(500);
+
+    player.set_playback_mode(AudioPlaybackMode::Streaming, 0.5f);
+    EXPECT_EQ(player.get_current_frame(), 500u);
+    player.set_playback_mode(AudioPlaybackMode::Direct);
+    EXPECT_EQ(player.get_current_frame(), 500u);
+
+    player.unload_file();
+}
+
+TEST(AudioPlayerSource, UnloadRetiresTheStreamToTheReclaimer) {
+    constexpr uint32_t k_frame_count = 2048;
+    constexpr uint32_t k_sample_rate = 44100;
+
+    auto wav_bytes = make_ramp_wav("test_player_retire.wav", k_frame_count, k_sample_rate);
+    ASSERT_FALSE(wav_bytes.empty());
+
+    AudioPlayerSource player;
+    player.set_playback_mode(AudioPlaybackMode::Streaming);
+    ASSERT_TRUE(player.load_from_memory(wav_bytes.data(), wav_bytes.size(), 1, k_sample_rate));
+
+    // Stands in for a process() block still holding the stream: the unloaded
+    // stream must wait for the reclaimer instead of dying with that block
+    auto& reclaimer = DeferredReclaimer::shared();
+    {
+        const auto read_scope = reclaimer.read_scope();
+        const size_t pending_before = reclaimer.num_pending();
+        player.unload_file();
+        EXPECT_GT(reclaimer.num_pending(), pending_before);
+    }
+
+    for (int attempt = 0; attempt < 200 && reclaimer.num_pending() != 0; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(reclaimer.num_pending(), 0u);
+}
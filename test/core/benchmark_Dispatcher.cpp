@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "tanh/core/Dispatcher.h"
+
+using namespace thl;
+
+// =============================================================================
+// Dispatcher — synchronous string dispatch vs. posted events
+// =============================================================================
+
+namespace {
+
+struct NullListener : DispatcherListener {
+    void on_dispatch(const std::string& /*event*/, const std::string& data) override {
+        benchmark::DoNotOptimize(data.size());
+    }
+    void on_event(uint32_t /*event*/, std::span<const std::byte> payload) override {
+        benchmark::DoNotOptimize(payload.size());
+    }
+};
+
+}  // namespace
+
+static void bm_dispatcher_dispatch(benchmark::State& bm_state) {
+    Dispatcher dispatcher;
+    NullListener listener;
+    dispatcher.add_listener("meter", &listener);
+    for ([[maybe_unused]] auto _ : bm_state) { dispatcher.dispatch("meter", "0.5"); }
+}
+BENCHMARK(bm_dispatcher_dispatch);
+
+// Caller-side cost only: the pump runs with the timer paused
+static void bm_dispatcher_post(benchmark::State& bm_state) {
+    Dispatcher dispatcher;
+    NullListener listener;
+    const auto meter = dispatcher.intern("meter");
+    dispatcher.add_listener(meter, &listener, Dispatcher::Delivery::Latest);
+    int posted = 0;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(dispatcher.post(meter, 0.5f));
+        if (++posted == 512) {
+            bm_state.PauseTiming();
+            dispatcher.pump();
+            posted = 0;
+            bm_state.ResumeTiming();
+        }
+    }
+}
+BENCHMARK(bm_dispatcher_post);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "tanh/core/BinaryLog.h"
+#include "tanh/core/Logger.h"
+
+using namespace thl;
+
+// =============================================================================
+// Logger — text file sink vs. memory-mapped binary sink
+// =============================================================================
+
+namespace {
+
+Logger::LogRecord bench_record() {
+    Logger::LogRecord record;
+    record.m_seq = 1;
+    record.m_timestamp_ms = 1700000000000;
+    record.m_monotonic_ns = 123456789;
+    record.m_level = static_cast<std::uint32_t>(Logger::LogLevel::Info);
+    record.m_group = "thl.audio.engine";
+    record.m_source = "native";
+    record.m_message = "buffer underrun on output device, 512 frames at 48000 Hz";
+    return record;
+}
+
+std::filesystem::path bench_path(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+}  // namespace
+
+// What the text file sink does per record: logfmt formatting plus a flushed write
+static void bm_logger_text_sink(benchmark::State& bm_state) {
+    const auto path = bench_path("thl_bench_text.log");
+    auto record = bench_record();
+    {
+        std::ofstream out(path, std::ios::out | std::ios::trunc);
+        for ([[maybe_unused]] auto _ : bm_state) {
+            ++record.m_seq;
+            out << Logger::format_logfmt(record) << '\n';
+            out.flush();
+        }
+    }
+    std::filesystem::remove(path);
+    bm_state.SetItemsProcessed(bm_state.iterations());
+}
+BENCHMARK(bm_logger_text_sink);
+
+static void bm_logger_binary_sink(benchmark::State& bm_state) {
+    const auto dir = bench_path("thl_bench_binary");
+    std::filesystem::remove_all(dir);
+    auto record = bench_record();
+    {
+        Logger::BinaryLogWriter writer({dir.string(), "thl", std::size_t{4} << 20, 2});
+        for ([[maybe_unused]] auto _ : bm_state) {
+            ++record.m_seq;
+            benchmark::DoNotOptimize(writer.write(record));
+        }
+    }
+    std::filesystem::remove_all(dir);
+    bm_state.SetItemsProcessed(bm_state.iterations());
+}
+BENCHMARK(bm_logger_binary_sink);
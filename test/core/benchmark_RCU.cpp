@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tanh/core/threading/RCU.h"
+
+using namespace thl;
+
+// =============================================================================
+// Reclamation stress: 1k updates/s against audio-thread readers
+// =============================================================================
+//
+// Each iteration is one update() of a 256-entry map, paced at 1 kHz. Reader
+// threads behave like audio callbacks: open a read section, hold it for
+// ~250 µs of "DSP", close it, sleep for the rest of a ~1.3 ms block. The
+// iteration time is the writer's update latency; the counters report the
+// worst update and the retired-version backlog.
+
+namespace {
+
+using Config = std::map<int, float>;
+
+template <typename Reclamation>
+void bm_rcu_update_stress(benchmark::State& bm_state) {
+    const auto num_readers = static_cast<int>(bm_state.range(0));
+    Config initial;
+    for (int i = 0; i < 256; ++i) { initial[i] = static_cast<float>(i); }
+    RCU<Config, Reclamation> rcu(initial);
+
+    std::atomic<bool> running{true};
+    std::atomic<int64_t> reads{0};
+    std::vector<std::thread> readers;
+    readers.reserve(static_cast<size_t>(num_readers));
+    for (int r = 0; r < num_readers; ++r) {
+        readers.emplace_back([&]() {
+            rcu.register_reader_thread();
+            while (running.load(std::memory_order_relaxed)) {
+                {
+                    auto scope = rcu.read_scope();
+                    const auto section_end =
+                        std::chrono::steady_clock::now() + std::chrono::microseconds(250);
+                    float sum = 0.0f;
+                    while (std::chrono::steady_clock::now() < section_end) {
+                        for (const auto& [key, value] : scope.data()) { sum += value; }
+                    }
+                    benchmark::DoNotOptimize(sum);
+                }
+                reads.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(std::chrono::microseconds(1083));
+            }
+        });
+    }
+
+    int counter = 0;
+    double worst_ns = 0.0;
+    auto next_update = std::chrono::steady_clock::now();
+    for ([[maybe_unused]] auto _ : bm_state) {
+        next_update += std::chrono::milliseconds(1);
+        std::this_thread::sleep_until(next_update);
+
+        const auto start = std::chrono::steady_clock::now();
+        rcu.update([&](Config& config) { config[counter % 256] = static_cast<float>(counter); });
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+        ++counter;
+
+        bm_state.SetIterationTime(elapsed.count());
+        worst_ns = std::max(worst_ns, elapsed.count() * 1e9);
+    }
+
+    running.store(false);
+    for (auto& reader : readers) { reader.join(); }
+
+    bm_state.counters["worst_update_ns"] = worst_ns;
+    bm_state.counters["peak_retired"] = static_cast<double>(rcu.peak_retired_versions());
+    bm_state.counters["retired_at_end"] = static_cast<double>(rcu.retired_versions());
+    bm_state.counters["reads"] = static_cast<double>(reads.load());
+}
+
+}  // namespace
+
+static void bm_rcu_update_stress_grace_period(benchmark::State& bm_state) {
+    bm_rcu_update_stress<GracePeriodReclamation>(bm_state);
+}
+BENCHMARK(bm_rcu_update_stress_grace_period)
+    ->Arg(1)
+    ->Arg(2)
+    ->Iterations(2000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+static void bm_rcu_update_stress_epoch(benchmark::State& bm_state) {
+    bm_rcu_update_stress<EpochReclamation>(bm_state);
+}
+BENCHMARK(bm_rcu_update_stress_epoch)
+    ->Arg(1)
+    ->Arg(2)
+    ->Iterations(2000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Read path: implicit per-thread node lookup vs. a held ReaderToken
+// =============================================================================
+
+static void bm_rcu_read(benchmark::State& bm_state) {
+    RCU<std::vector<int>> rcu(std::vector<int>{1, 2, 3});
+    rcu.register_reader_thread();
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(rcu.read([](const auto& vec) { return vec.front(); }));
+    }
+}
+BENCHMARK(bm_rcu_read);
+
+static void bm_rcu_read_token(benchmark::State& bm_state) {
+    RCU<std::vector<int>> rcu(std::vector<int>{1, 2, 3});
+    const auto token = rcu.register_reader_thread();
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(rcu.read(token, [](const auto& vec) { return vec.front(); }));
+    }
+}
+BENCHMARK(bm_rcu_read_token);
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tanh/core/BinaryLog.h"
+#include "tanh/core/Logger.h"
+
+using namespace thl;
+
+namespace {
+
+// Fresh directory under the system temp path, removed on destruction.
+class TempDirectory {
+public:
+    explicit TempDirectory(const std::string& name)
+        : m_path(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove_all(m_path);
+    }
+    ~TempDirectory() { std::filesystem::remove_all(m_path); }
+
+    std::string string() const { return m_path.string(); }
+
+private:
+    std::filesystem::path m_path;
+};
+
+Logger::LogRecord make_record(std::uint64_t seq, const std::string& message) {
+    Logger::LogRecord record;
+    record.m_seq = seq;
+    record.m_timestamp_ms = 1700000000000 + static_cast<std::int64_t>(seq);
+    record.m_monotonic_ns = 1000 * seq;
+    record.m_level = static_cast<std::uint32_t>(Logger::LogLevel::Warning);
+    record.m_group = "thl.test";
+    record.m_source = "native";
+    record.m_message = message;
+    return record;
+}
+
+}  // namespace
+
+TEST(BinaryLog, RoundTripsRecordsAcrossRotation) {
+    TempDirectory dir("thl_binary_log_round_trip");
+    const std::string message(100, 'x');
+    {
+        Logger::BinaryLogWriter writer({dir.string(), "thl", 1024, 0});
+        for (std::uint64_t seq = 1; seq <= 40; ++seq) {
+            ASSERT_TRUE(writer.write(make_record(seq, message + std::to_string(seq))));
+        }
+    }
+
+    const auto segments = Logger::list_binary_log_segments(dir.string());
+    ASSERT_GT(segments.size(), 1u);
+    for (const auto& segment : segments) {
+        EXPECT_LE(std::filesystem::file_size(segment), 1024u);
+    }
+
+    std::vector<Logger::LogRecord> records;
+    for (const auto& segment : segments) {
+        const auto decoded = Logger::read_binary_log(segment);
+        records.insert(records.end(), decoded.begin(), decoded.end());
+    }
+    ASSERT_EQ(records.size(), 40u);
+    for (std::uint64_t seq = 1; seq <= 40; ++seq) {
+        const auto expected = make_record(seq, message + std::to_string(seq));
+        const auto& record = records[seq - 1];
+        EXPECT_EQ(record.m_seq, expected.m_seq);
+        EXPECT_EQ(record.m_monotonic_ns, expected.m_monotonic_ns);
+        EXPECT_EQ(record.m_message, expected.m_message);
+        EXPECT_EQ(Logger::format_logfmt(record), Logger::format_logfmt(expected));
+    }
+}
+
+TEST(BinaryLog, KeepsOnlyNewestSegments) {
+    TempDirectory dir("thl_binary_log_pruning");
+    {
+        Logger::BinaryLogWriter writer({dir.string(), "thl", 512, 2});
+        for (std::uint64_t seq = 1; seq <= 50; ++seq) {
+            ASSERT_TRUE(writer.write(make_record(seq, std::string(64, 'y'))));
+        }
+    }
+
+    const auto segments = Logger::list_binary_log_segments(dir.string());
+    ASSERT_EQ(segments.size(), 2u);
+    const auto newest = Logger::read_binary_log(segments.back());
+    ASSERT_FALSE(newest.empty());
+    EXPECT_EQ(newest.back().m_seq, 50u);
+
+    // A writer reopening the directory continues the numbering
+    {
+        Logger::BinaryLogWriter writer({dir.string(), "thl", 512, 2});
+        ASSERT_TRUE(writer.write(make_record(51, "after restart")));
+    }
+    const auto reopened = Logger::list_binary_log_segments(dir.string());
+    ASSERT_EQ(reopened.size(), 2u);
+    EXPECT_EQ(reopened.front(), segments.back());
+    EXPECT_EQ(Logger::read_binary_log(reopened.back()).front().m_message, "after restart");
+}
+
+TEST(BinaryLog, RejectsOversizedRecordsAndForeignFiles) {
+    TempDirectory dir("thl_binary_log_rejects");
+    Logger::BinaryLogWriter writer({dir.string(), "thl", 256, 0});
+    EXPECT_FALSE(writer.write(make_record(1, std::string(512, 'z'))));
+
+    std::filesystem::create_directories(dir.string());
+    const std::string bogus = dir.string() + "/bogus.tlb";
+    { std::ofstream(bogus) << "not a log"; }
+    EXPECT_THROW(Logger::read_binary_log(bogus), std::runtime_error);
+}
+
+TEST(BinaryLog, IgnoresFilesThatAreNotItsSegments) {
+    TempDirectory dir("thl_binary_log_foreign");
+    std::filesystem::create_directories(dir.string());
+    // Stray files that look like segments of "thl" but are not
+    for (const char* name : {"thl-notes.tlb", "thl-.tlb", "thl-12x.tlb"}) {
+        std::ofstream(dir.string() + "/" + name) << "not ours";
+    }
+    // A second prefix starting with this one writes thl-audio-000000.tlb
+    {
+        Logger::BinaryLogWriter audio({dir.string(), "thl-audio", 512, 1});
+        ASSERT_TRUE(audio.write(make_record(1, "audio")));
+    }
+
+    // Constructing does not throw, numbering starts fresh, and rotation
+    // leaves the other files alone
+    {
+        Logger::BinaryLogWriter writer({dir.string(), "thl", 512, 1});
+        for (std::uint64_t seq = 1; seq <= 20; ++seq) {
+            ASSERT_TRUE(writer.write(make_record(seq, std::string(64, 'w'))));
+        }
+    }
+    const auto segments = Logger::list_binary_log_segments(dir.string());
+    ASSERT_EQ(segments.size(), 1u);
+    for (const char* name : {"thl-audio-000000.tlb", "thl-notes.tlb", "thl-.tlb", "thl-12x.tlb"}) {
+        EXPECT_TRUE(std::filesystem::exists(dir.string() + "/" + name)) << name;
+    }
+    EXPECT_EQ(Logger::list_binary_log_segments(dir.string(), "thl-audio").size(), 1u);
+}
+
+TEST(BinaryLog, LoggerBinarySinkWritesRecords) {
+    TempDirectory dir("thl_binary_log_sink");
+    const auto previous = Logger::get_config();
+
+    Logger::LoggerConfig config;
+    config.m_platform_enabled = false;
+    config.m_file_enabled = false;
+    config.m_callback_enabled = false;
+    config.m_binary_enabled = true;
+    config.m_binary_directory = dir.string();
+    Logger::set_config(config);
+
+    Logger::error("thl.test", "binary sink record");
+    Logger::set_config(previous);  // closes the writer
+
+    const auto segments = Logger::list_binary_log_segments(dir.string());
+    ASSERT_EQ(segments.size(), 1u);
+    const auto records = Logger::read_binary_log(segments.front());
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records.front().m_group, "thl.test");
+    EXPECT_EQ(records.front().m_message, "binary sink record");
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "tanh/core/threading/DeferredReclaimer.h"
+
+using namespace thl;
+
+namespace {
+
+// Counts destructions; m_alive lets readers detect use after destruction.
+struct Tracked {
+    explicit Tracked(std::atomic<int>& destroyed, int value = 0)
+        : m_destroyed(destroyed), m_value(value) {}
+    ~Tracked() {
+        m_alive.store(false, std::memory_order_relaxed);
+        m_destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<int>& m_destroyed;
+    std::atomic<bool> m_alive{true};
+    int m_value;
+};
+
+DeferredReclaimer::Options manual(size_t capacity = 1024) {
+    return {.m_capacity = capacity, .m_reclaim_thread = false};
+}
+
+}  // namespace
+
+TEST(DeferredReclaimer, OpenScopeKeepsRetiredObjectAlive) {
+    std::atomic<int> destroyed{0};
+    DeferredReclaimer reclaimer(manual());
+
+    {
+        auto scope = reclaimer.read_scope();
+        reclaimer.retire(std::make_unique<Tracked>(destroyed));
+        EXPECT_EQ(reclaimer.collect(), 0U);
+        EXPECT_EQ(reclaimer.num_pending(), 1U);
+    }
+
+    EXPECT_EQ(reclaimer.collect(), 1U);
+    EXPECT_EQ(destroyed.load(), 1);
+    EXPECT_EQ(reclaimer.num_reclaimed(), 1U);
+}
+
+TEST(DeferredReclaimer, ScopeOpenedAfterRetireDoesNotHoldItBack) {
+    std::atomic<int> destroyed{0};
+    DeferredReclaimer reclaimer(manual());
+
+    reclaimer.retire(std::make_unique<Tracked>(destroyed));
+    auto scope = reclaimer.read_scope();
+    EXPECT_EQ(reclaimer.collect(), 1U);
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(DeferredReclaimer, NestedScopesReleaseOnOutermostExit) {
+    std::atomic<int> destroyed{0};
+    DeferredReclaimer reclaimer(manual());
+
+    {
+        auto outer = reclaimer.read_scope();
+        reclaimer.retire(std::make_unique<Tracked>(destroyed));
+        { auto inner = reclaimer.read_scope(); }
+        EXPECT_EQ(reclaimer.collect(), 0U);
+    }
+    EXPECT_EQ(reclaimer.collect(), 1U);
+}
+
+TEST(DeferredReclaimer, TryRetireFailsWhenQueueIsFull) {
+    std::atomic<int> destroyed{0};
+    DeferredReclaimer reclaimer(manual(2));
+
+    auto first = std::make_unique<Tracked>(destroyed);
+    auto second = std::make_unique<Tracked>(destroyed);
+    auto third = std::make_unique<Tracked>(destroyed);
+    EXPECT_TRUE(reclaimer.try_retire(first));
+    EXPECT_TRUE(reclaimer.try_retire(second));
+    EXPECT_FALSE(reclaimer.try_retire(third));
+    EXPECT_EQ(first, nullptr);
+    ASSERT_NE(third, nullptr);
+
+    // retire() spills into the overflow list instead
+    reclaimer.retire(std::move(third));
+    EXPECT_EQ(reclaimer.num_pending(), 3U);
+    EXPECT_EQ(reclaimer.collect(), 3U);
+    EXPECT_EQ(destroyed.load(), 3);
+}
+
+TEST(DeferredReclaimer, DestructorDestroysPendingObjects) {
+    std::atomic<int> destroyed{0};
+    {
+        DeferredReclaimer reclaimer(manual());
+        reclaimer.retire(std::make_unique<Tracked>(destroyed));
+        reclaimer.retire(std::make_unique<Tracked>(destroyed));
+    }
+    EXPECT_EQ(destroyed.load(), 2);
+}
+
+// A reader keeps loading a published object while a writer swaps and retires
+// it; the reclaim thread must never destroy an object a reader still sees.
+TEST(DeferredReclaimer, ReadersNeverObserveDestroyedObjects) {
+    std::atomic<int> destroyed{0};
+    DeferredReclaimer reclaimer({.m_reclaim_interval = std::chrono::microseconds(50)});
+    std::atomic<Tracked*> published{new Tracked(destroyed)};
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<bool> saw_destroyed{false};
+
+    std::thread reader([&]() {
+        DeferredReclaimer::register_reader_thread();
+        while (!stop.load(std::memory_order_relaxed)) {
+            auto scope = reclaimer.read_scope();
+            const Tracked* object = published.load(std::memory_order_acquire);
+            for (int i = 0; i < 16; ++i) {
+                if (!object->m_alive.load(std::memory_order_relaxed)) { saw_destroyed = true; }
+            }
+            reads.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    int swaps = 0;
+    for (; swaps < 20000; ++swaps) {
+        std::unique_ptr<Tracked> old(
+            published.exchange(new Tracked(destroyed, swaps), std::memory_order_acq_rel));
+        reclaimer.retire(std::move(old));
+        if (swaps % 256 == 0) { std::this_thread::yield(); }
+    }
+    stop.store(true, std::memory_order_relaxed);
+    reader.join();
+
+    EXPECT_FALSE(saw_destroyed.load());
+    EXPECT_GT(reads.load(), 0U);
+
+    // Everything retired is eventually destroyed once readers are gone
+    while (reclaimer.num_pending() > 0) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    EXPECT_EQ(destroyed.load(), swaps);
+    delete published.load();
+}
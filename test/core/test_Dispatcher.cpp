@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tanh/core/Dispatcher.h"
+#include "tanh/core/threading/MPMCQueue.h"
+
+using namespace thl;
+
+namespace {
+
+struct RecordingListener : DispatcherListener {
+    std::vector<std::pair<std::string, std::string>> m_dispatched;
+    std::vector<std::pair<uint32_t, int>> m_events;
+
+    void on_dispatch(const std::string& event, const std::string& data) override {
+        m_dispatched.emplace_back(event, data);
+    }
+    void on_event(uint32_t event, std::span<const std::byte> payload) override {
+        int value = -1;
+        if (payload.size() == sizeof(int)) { std::memcpy(&value, payload.data(), sizeof(int)); }
+        m_events.emplace_back(event, value);
+    }
+};
+
+}  // namespace
+
+TEST(MPMCQueue, FifoAndBounded) {
+    MPMCQueue<int> queue(3);
+    EXPECT_EQ(queue.capacity(), 4u);
+    for (int i = 0; i < 4; ++i) { EXPECT_TRUE(queue.try_push(i)); }
+    EXPECT_FALSE(queue.try_push(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(MPMCQueue, ConcurrentProducersDeliverEverything) {
+    constexpr int k_per_producer = 10000;
+    MPMCQueue<int> queue(256);
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&]() {
+            for (int i = 1; i <= k_per_producer; ++i) {
+                while (!queue.try_push(i)) { std::this_thread::yield(); }
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (popped.load() < 2 * k_per_producer) {
+                if (queue.try_pop(value)) {
+                    sum.fetch_add(value);
+                    popped.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) { t.join(); }
+
+    const long long expected = 2LL * k_per_producer * (k_per_producer + 1) / 2;
+    EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(Dispatcher, DispatchIsSynchronous) {
+    Dispatcher dispatcher;
+    RecordingListener listener;
+    dispatcher.add_listener("preset", &listener);
+
+    dispatcher.dispatch("preset", "init");
+    dispatcher.dispatch("other", "ignored");
+    ASSERT_EQ(listener.m_dispatched.size(), 1u);
+    EXPECT_EQ(listener.m_dispatched[0].second, "init");
+}
+
+TEST(Dispatcher, PostedEventsArriveOnPump) {
+    Dispatcher dispatcher;
+    RecordingListener listener;
+    const auto meter = dispatcher.intern("meter");
+    EXPECT_EQ(dispatcher.intern("meter"), meter);
+    EXPECT_EQ(dispatcher.event_name(meter), "meter");
+    dispatcher.add_listener(meter, &listener);
+
+    EXPECT_TRUE(dispatcher.post(meter, 1));
+    EXPECT_TRUE(dispatcher.post(meter, 2));
+    EXPECT_TRUE(listener.m_events.empty());
+
+    EXPECT_EQ(dispatcher.pump(), 2u);
+    ASSERT_EQ(listener.m_events.size(), 2u);
+    EXPECT_EQ(listener.m_events[0].second, 1);
+    EXPECT_EQ(listener.m_events[1].second, 2);
+    EXPECT_EQ(dispatcher.pump(), 0u);
+}
+
+TEST(Dispatcher, LatestDeliveryCoalescesPerPump) {
+    Dispatcher dispatcher;
+    RecordingListener every;
+    RecordingListener latest;
+    const auto position = dispatcher.intern("position");
+    const auto note = dispatcher.intern("note");
+    dispatcher.add_listener(position, &every);
+    dispatcher.add_listener(position, &latest, Dispatcher::Delivery::Latest);
+    dispatcher.add_listener(note, &latest, Dispatcher::Delivery::Latest);
+
+    for (int i = 0; i < 5; ++i) { dispatcher.post(position, i); }
+    dispatcher.post(note, 60);
+    dispatcher.pump();
+
+    EXPECT_EQ(every.m_events.size(), 5u);
+    ASSERT_EQ(latest.m_events.size(), 2u);
+    EXPECT_EQ(latest.m_events[0], std::make_pair(position, 4));
+    EXPECT_EQ(latest.m_events[1], std::make_pair(note, 60));
+}
+
+TEST(Dispatcher, PostFailsWhenPoolIsExhausted) {
+    Dispatcher::Options options;
+    options.m_capacity = 4;
+    options.m_max_payload_size = sizeof(int);
+    Dispatcher dispatcher(options);
+    const auto event = dispatcher.intern("event");
+
+    for (int i = 0; i < 4; ++i) { EXPECT_TRUE(dispatcher.post(event, i)); }
+    EXPECT_FALSE(dispatcher.post(event, 4));
+    EXPECT_FALSE(dispatcher.post(event, 1.0));  // larger than the slot
+    EXPECT_EQ(dispatcher.num_dropped(), 2u);
+
+    // Pumping returns the slots to the pool
+    dispatcher.pump();
+    EXPECT_TRUE(dispatcher.post(event, 5));
+}
+
+TEST(Dispatcher, ZeroPayloadSizeCarriesEmptyEvents) {
+    Dispatcher::Options options;
+    options.m_capacity = 4;
+    options.m_max_payload_size = 0;
+    Dispatcher dispatcher(options);
+    RecordingListener listener;
+    const auto tick = dispatcher.intern("tick");
+    dispatcher.add_listener(tick, &listener);
+
+    EXPECT_TRUE(dispatcher.post(tick, std::span<const std::byte>()));
+    EXPECT_FALSE(dispatcher.post(tick, 1));  // Any payload is too large
+    EXPECT_EQ(dispatcher.pump(), 1u);
+    ASSERT_EQ(listener.m_events.size(), 1u);
+    EXPECT_EQ(listener.m_events[0], std::make_pair(tick, -1));
+}
+
+TEST(Dispatcher, DeliveryThreadPumps) {
+    Dispatcher::Options options;
+    options.m_delivery_thread = true;
+    options.m_delivery_interval = std::chrono::microseconds(100);
+    Dispatcher dispatcher(options);
+
+    struct CountingListener : DispatcherListener {
+        std::atomic<int> m_count{0};
+        void on_event(uint32_t, std::span<const std::byte>) override { m_count.fetch_add(1); }
+    } listener;
+    const auto event = dispatcher.intern("event");
+    dispatcher.add_listener(event, &listener);
+
+    std::thread poster([&]() {
+        for (int i = 0; i < 100; ++i) {
+            while (!dispatcher.post(event, i)) { std::this_thread::yield(); }
+        }
+    });
+    poster.join();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (listener.m_count.load() < 100 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(listener.m_count.load(), 100);
+
+    dispatcher.remove_listener(&listener);
+}
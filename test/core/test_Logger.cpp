@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tanh/core/Logger.h"
+
+using namespace thl;
+
+namespace {
+
+// Captures callback records for the duration of a test; other sinks off.
+class CapturingSinks {
+public:
+    CapturingSinks() {
+        m_previous = Logger::get_config();
+        Logger::LoggerConfig config;
+        config.m_platform_enabled = false;
+        config.m_file_enabled = false;
+        config.m_rt_ring_capacity = 4;
+        Logger::set_config(config);
+        Logger::set_callback([this](const Logger::LogRecord& record) {
+            std::scoped_lock const lock(m_mutex);
+            m_records.push_back(record);
+        });
+    }
+
+    ~CapturingSinks() {
+        Logger::rt_flush();
+        Logger::clear_callback();
+        Logger::set_config(m_previous);
+    }
+
+    std::vector<Logger::LogRecord> records() {
+        std::scoped_lock const lock(m_mutex);
+        return m_records;
+    }
+
+private:
+    Logger::LoggerConfig m_previous;
+    std::mutex m_mutex;
+    std::vector<Logger::LogRecord> m_records;
+};
+
+}  // namespace
+
+TEST(Logger, FormatRtMessageExpandsNumericArguments) {
+    Logger::RtRecord record;
+    record.m_format = "voice %d at %.2f Hz, %zu frames, 100%% (%s)";
+    record.m_num_args = 3;
+    record.m_arg_types = {Logger::RtArgType::Int, Logger::RtArgType::Float, Logger::RtArgType::Uint};
+    record.m_args[0].m_int = -3;
+    record.m_args[1].m_float = 440.0;
+    record.m_args[2].m_uint = 512;
+    EXPECT_EQ(Logger::format_rt_message(record), "voice -3 at 440.00 Hz, 512 frames, 100% (?)");
+
+    record.m_num_args = 0;
+    record.m_format = "only %u";
+    EXPECT_EQ(Logger::format_rt_message(record), "only <missing>");
+}
+
+TEST(Logger, RtLogReachesSinksAfterFlush) {
+    CapturingSinks sinks;
+
+    // Error level: Release builds compile out everything below it
+    EXPECT_TRUE(Logger::rt_log(Logger::LogLevel::Error, "test.rt", "xrun %d of %u", 2, 7u));
+    Logger::rt_flush();
+
+    const auto records = sinks.records();
+    ASSERT_FALSE(records.empty());
+    EXPECT_EQ(records.back().m_message, "xrun 2 of 7");
+    EXPECT_EQ(records.back().m_group, "test.rt");
+    EXPECT_EQ(records.back().m_level, static_cast<std::uint32_t>(Logger::LogLevel::Error));
+}
+
+TEST(Logger, RtLogCountsDropsOnFullRing) {
+    CapturingSinks sinks;
+
+    std::thread audio([&]() {
+        Logger::rt_register_thread();  // ring of 4 records
+        const auto before = Logger::rt_stats();
+        int accepted = 0;
+        for (int i = 0; i < 64; ++i) { accepted += Logger::rt_error("test.rt", "block %d", i); }
+
+        // The drain thread may empty the ring while we post, so only bound it
+        const auto after = Logger::rt_stats();
+        EXPECT_EQ(after.m_submitted - before.m_submitted, static_cast<uint64_t>(accepted));
+        EXPECT_EQ(after.m_dropped - before.m_dropped, static_cast<uint64_t>(64 - accepted));
+        EXPECT_GE(accepted, 4);
+    });
+    audio.join();
+    Logger::rt_flush();
+
+    const auto records = sinks.records();
+    ASSERT_FALSE(records.empty());
+    EXPECT_EQ(records.front().m_message, "block 0");
+}
+
+TEST(Logger, RtLogIsDrainedWithoutRegistrationOrFlush) {
+    CapturingSinks sinks;
+
+    // An unregistered thread posts to the shared ring; set_config() started
+    // the drain thread, so the record arrives without rt_flush()
+    std::thread audio([]() { Logger::rt_error("test.rt", "unregistered %d", 5); });
+    audio.join();
+
+    bool delivered = false;
+    for (int i = 0; i < 500 && !delivered; ++i) {
+        for (const auto& record : sinks.records()) {
+            if (record.m_message == "unregistered 5") { delivered = true; }
+        }
+        if (!delivered) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }
+    }
+    EXPECT_TRUE(delivered);
+}
+
+TEST(Logger, RtStopJoinsTheDrainThreadAndRtStartRestartsIt) {
+    CapturingSinks sinks;
+    auto delivered = [&sinks](const std::string& message) {
+        for (const auto& record : sinks.records()) {
+            if (record.m_message == message) { return true; }
+        }
+        return false;
+    };
+
+    Logger::rt_stop();
+    Logger::rt_error("test.rt", "while stopped %d", 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(delivered("while stopped 1"));
+
+    Logger::rt_start();
+    for (int i = 0; i < 500 && !delivered("while stopped 1"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_TRUE(delivered("while stopped 1"));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "tanh/core/ObjectPool.h"
+
+using namespace thl;
+
+namespace {
+
+struct Voice {
+    int m_note = -1;
+    float m_level = 0.0f;
+};
+
+std::vector<int> live_notes(ObjectPool<Voice>& pool) {
+    std::vector<int> notes;
+    pool.for_each([&](Voice& voice) { notes.push_back(voice.m_note); });
+    std::sort(notes.begin(), notes.end());
+    return notes;
+}
+
+}  // namespace
+
+TEST(ObjectPool, AcquiresUntilFullThenReturnsNull) {
+    ObjectPool<Voice> pool(4);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.capacity(), 4U);
+
+    std::set<Voice*> acquired;
+    for (int i = 0; i < 4; ++i) {
+        Voice* voice = pool.acquire();
+        ASSERT_NE(voice, nullptr);
+        acquired.insert(voice);
+    }
+    EXPECT_EQ(acquired.size(), 4U);
+    EXPECT_TRUE(pool.full());
+    EXPECT_EQ(pool.acquire(), nullptr);
+}
+
+TEST(ObjectPool, SlotsAreCacheLineAlignedWithStableIndices) {
+    ObjectPool<Voice> pool(8);
+    std::set<size_t> indices;
+    for (int i = 0; i < 8; ++i) {
+        Voice* voice = pool.acquire();
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(voice) % ObjectPool<Voice>::k_slot_alignment, 0U);
+        indices.insert(pool.index_of(voice));
+    }
+    EXPECT_EQ(indices, (std::set<size_t>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(ObjectPool, ReleaseRecyclesTheSlot) {
+    ObjectPool<Voice> pool(2);
+    Voice* a = pool.acquire();
+    Voice* b = pool.acquire();
+    a->m_note = 60;
+    pool.release(a);
+    EXPECT_EQ(pool.size(), 1U);
+
+    Voice* c = pool.acquire();
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(c->m_note, 60);  // Recycled, not reconstructed
+    EXPECT_NE(c, b);
+}
+
+TEST(ObjectPool, ForEachVisitsLiveObjectsOnly) {
+    ObjectPool<Voice> pool(8);
+    std::vector<Voice*> voices;
+    for (int i = 0; i < 6; ++i) {
+        voices.push_back(pool.acquire());
+        voices.back()->m_note = i;
+    }
+    pool.release(voices[1]);
+    pool.release(voices[4]);
+
+    EXPECT_EQ(live_notes(pool), (std::vector<int>{0, 2, 3, 5}));
+}
+
+TEST(ObjectPool, ForEachToleratesReleasingTheVisitedObject) {
+    ObjectPool<Voice> pool(16);
+    for (int i = 0; i < 16; ++i) { pool.acquire()->m_note = i; }
+
+    std::vector<int> visited;
+    pool.for_each([&](Voice& voice) {
+        visited.push_back(voice.m_note);
+        if (voice.m_note % 3 == 0) { pool.release(&voice); }
+    });
+
+    std::sort(visited.begin(), visited.end());
+    EXPECT_EQ(visited.size(), 16U);
+    EXPECT_EQ(std::unique(visited.begin(), visited.end()), visited.end());
+    EXPECT_EQ(live_notes(pool), (std::vector<int>{1, 2, 4, 5, 7, 8, 10, 11, 13, 14}));
+}
+
+TEST(ObjectPool, ReleaseAllAndPrepareResize) {
+    ObjectPool<Voice> pool(4);
+    for (int i = 0; i < 4; ++i) { (void)pool.acquire(); }
+    pool.release_all();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(live_notes(pool), std::vector<int>{});
+
+    pool.prepare(64);
+    EXPECT_EQ(pool.capacity(), 64U);
+    for (int i = 0; i < 64; ++i) { ASSERT_NE(pool.acquire(), nullptr); }
+    EXPECT_EQ(pool.acquire(), nullptr);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "tanh/core/PersistentHashMap.h"
+#include "tanh/core/threading/RCU.h"
+
+using namespace thl;
+
+namespace {
+
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const noexcept {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+
+// Sends every key to the same hash, forcing collision nodes at the bottom.
+struct ConstantHash {
+    size_t operator()(int /*key*/) const noexcept { return 0x5a5a5a5a; }
+};
+
+template <typename Map>
+std::map<typename Map::key_type, typename Map::mapped_type> to_std_map(const Map& map) {
+    std::map<typename Map::key_type, typename Map::mapped_type> out;
+    for (const auto& [key, value] : map) { out.emplace(key, value); }
+    return out;
+}
+
+}  // namespace
+
+TEST(PersistentHashMap, InsertFindErase) {
+    PersistentHashMap<std::string, int, TransparentStringHash> map;
+    EXPECT_TRUE(map.empty());
+
+    EXPECT_TRUE(map.insert("gain", 1));
+    EXPECT_TRUE(map.insert("pan", 2));
+    EXPECT_FALSE(map.insert("gain", 3));
+    EXPECT_EQ(map.size(), 2u);
+    ASSERT_NE(map.find(std::string_view("gain")), nullptr);
+    EXPECT_EQ(*map.find(std::string_view("gain")), 1);
+
+    EXPECT_FALSE(map.insert_or_assign("gain", 4));
+    EXPECT_EQ(*map.find("gain"), 4);
+
+    EXPECT_TRUE(map.erase(std::string_view("gain")));
+    EXPECT_FALSE(map.erase(std::string_view("gain")));
+    EXPECT_EQ(map.find("gain"), nullptr);
+    EXPECT_TRUE(map.contains("pan"));
+    EXPECT_EQ(map.size(), 1u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentHashMap, CopiesAreIndependentVersions) {
+    PersistentHashMap<int, int> before;
+    for (int i = 0; i < 1000; ++i) { before.insert(i, i); }
+
+    PersistentHashMap<int, int> after = before;
+    after.insert_or_assign(7, -7);
+    after.erase(8);
+    after.insert(5000, 1);
+
+    EXPECT_EQ(before.size(), 1000u);
+    EXPECT_EQ(*before.find(7), 7);
+    EXPECT_TRUE(before.contains(8));
+    EXPECT_FALSE(before.contains(5000));
+
+    EXPECT_EQ(after.size(), 1000u);
+    EXPECT_EQ(*after.find(7), -7);
+    EXPECT_FALSE(after.contains(8));
+    EXPECT_TRUE(after.contains(5000));
+}
+
+TEST(PersistentHashMap, MatchesStdMapUnderRandomOperations) {
+    PersistentHashMap<std::string, int, TransparentStringHash> map;
+    std::map<std::string, int> reference;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> key_dist(0, 3000);
+    std::uniform_int_distribution<int> op_dist(0, 2);
+
+    for (int step = 0; step < 20000; ++step) {
+        const std::string key = "group." + std::to_string(key_dist(rng));
+        switch (op_dist(rng)) {
+            case 0:
+                EXPECT_EQ(map.insert(key, step), reference.emplace(key, step).second);
+                break;
+            case 1:
+                EXPECT_EQ(map.insert_or_assign(key, step),
+                          reference.insert_or_assign(key, step).second);
+                break;
+            default: EXPECT_EQ(map.erase(key), reference.erase(key) == 1); break;
+        }
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    EXPECT_EQ(to_std_map(map), reference);
+}
+
+TEST(PersistentHashMap, FullHashCollisions) {
+    PersistentHashMap<int, int, ConstantHash> map;
+    for (int i = 0; i < 50; ++i) { EXPECT_TRUE(map.insert(i, i * 10)); }
+    EXPECT_EQ(map.size(), 50u);
+    for (int i = 0; i < 50; ++i) { EXPECT_EQ(*map.find(i), i * 10); }
+
+    for (int i = 0; i < 50; i += 2) { EXPECT_TRUE(map.erase(i)); }
+    EXPECT_EQ(map.size(), 25u);
+    for (int i = 0; i < 50; ++i) { EXPECT_EQ(map.contains(i), i % 2 == 1); }
+    EXPECT_EQ(to_std_map(map).size(), 25u);
+
+    for (int i = 1; i < 50; i += 2) { EXPECT_TRUE(map.erase(i)); }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentHashMap, RCUReadersSeeConsistentVersions) {
+    RCU<PersistentHashMap<int, int>> index;
+    std::atomic<bool> running{true};
+    std::atomic<int> errors{0};
+
+    std::thread reader([&]() {
+        while (running.load()) {
+            index.read([&](const auto& map) {
+                // Every published version holds keys [0, size).
+                for (size_t i = 0; i < map.size(); ++i) {
+                    const int* value = map.find(static_cast<int>(i));
+                    if (value == nullptr || *value != static_cast<int>(i)) { errors.fetch_add(1); }
+                }
+            });
+        }
+    });
+
+    for (int i = 0; i < 2000; ++i) {
+        index.update([i](auto& map) { map.insert(i, i); });
+    }
+    running.store(false);
+    reader.join();
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(index.read([](const auto& map) { return map.size(); }), 2000u);
+}
@@ -172,3 +172,111 @@ TEST(RCU, VectorFunctionalityBig) {
     auto final_vec_size = rcu_vec.read([](const auto& vec) { return vec.size(); });
     EXPECT_EQ(final_vec_size, 43);  // Initial 3 + 50 adds + 10 removes
 }
+
+TEST(RCU, ReaderTokenReadsCurrentData) {
+    RCU<std::vector<int>> rcu_vec(std::vector<int>{1});
+    const auto token = rcu_vec.register_reader_thread();
+    ASSERT_TRUE(token.is_valid());
+
+    rcu_vec.update([](auto& vec) { vec.push_back(2); });
+    EXPECT_EQ(rcu_vec.read(token, [](const auto& vec) { return vec.size(); }), 2u);
+    {
+        auto scope = rcu_vec.read_scope(token);
+        EXPECT_EQ(scope->back(), 2);
+    }
+    EXPECT_EQ(rcu_vec.get_reader_count(), 1u);
+}
+
+TEST(RCU, ReaderSlotIsReusedAfterThreadExit) {
+    RCU<std::vector<int>> rcu_vec(std::vector<int>{1});
+    rcu_vec.register_reader_thread();
+
+    RCUReaderSlot first;
+    std::thread([&]() {
+        rcu_vec.read([](const auto&) {});
+        first = RCUReaderSlot::current();
+        EXPECT_EQ(rcu_vec.get_reader_count(), 2u);
+    }).join();
+    ASSERT_TRUE(first.is_valid());
+    EXPECT_EQ(rcu_vec.get_reader_count(), 1u);
+
+    // The next thread takes the freed slot with a new generation, so it
+    // registers afresh instead of inheriting the exited thread's node.
+    std::thread([&]() {
+        const RCUReaderSlot& slot = RCUReaderSlot::acquire();
+        EXPECT_EQ(slot.m_index, first.m_index);
+        EXPECT_NE(slot.m_generation, first.m_generation);
+        EXPECT_EQ(rcu_vec.get_reader_count(), 1u);
+        EXPECT_EQ(rcu_vec.read([](const auto& vec) { return vec.front(); }), 1);
+        EXPECT_EQ(rcu_vec.get_reader_count(), 2u);
+    }).join();
+}
+
+struct FastEpochs : EpochReclamation {
+    static constexpr std::chrono::microseconds k_reclaim_interval{100};
+};
+
+TEST(RCU, EpochReclamationFunctionality) {
+    RCU<std::map<std::string, int>, EpochReclamation> rcu_map;
+
+    rcu_map.update([](auto& map) { map["key1"] = 100; });
+    rcu_map.update([](auto& map) { map["key1"] = 101; });
+
+    auto value = rcu_map.read([](const auto& map) {
+        auto it = map.find("key1");
+        return (it != map.end()) ? it->second : -1;
+    });
+    EXPECT_EQ(value, 101);
+}
+
+TEST(RCU, EpochReclamationFreesInTheBackground) {
+    RCU<std::vector<int>, FastEpochs> rcu_vec;
+    for (int i = 0; i < 100; ++i) {
+        rcu_vec.update([i](auto& vec) { vec.push_back(i); });
+    }
+    EXPECT_GE(rcu_vec.peak_retired_versions(), 1u);
+
+    // No reader holds a section, so the reclaimer drains the queue on its own.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (rcu_vec.retired_versions() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(rcu_vec.retired_versions(), 0u);
+    EXPECT_EQ(rcu_vec.read([](const auto& vec) { return vec.size(); }), 100u);
+}
+
+TEST(RCU, EpochReclamationWriterNeverWaitsForAStalledReader) {
+    RCU<std::vector<int>, FastEpochs> rcu_vec(std::vector<int>{0});
+    std::atomic<bool> reading{false};
+    std::atomic<bool> release{false};
+    std::atomic<int> seen{-1};
+
+    // Holds one read section open across all the updates below — with
+    // GracePeriodReclamation the writer would block at the emergency
+    // threshold until the reader lets go.
+    std::thread reader([&]() {
+        auto scope = rcu_vec.read_scope();
+        reading.store(true);
+        while (!release.load()) { std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+        seen.store(scope.data().front());
+    });
+    while (!reading.load()) { std::this_thread::yield(); }
+
+    for (int i = 1; i <= 100; ++i) {
+        rcu_vec.update([i](auto& vec) { vec.front() = i; });
+    }
+    // Everything retired after the reader's epoch is pinned.
+    EXPECT_EQ(rcu_vec.retired_versions(), 100u);
+
+    release.store(true);
+    reader.join();
+    EXPECT_EQ(seen.load(), 0);
+
+    // The reclaimer keeps polling while versions are queued; they are free now.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (rcu_vec.retired_versions() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(rcu_vec.retired_versions(), 0u);
+    EXPECT_EQ(rcu_vec.peak_retired_versions(), 100u);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "tanh/core/ScratchArena.h"
+
+using namespace thl;
+
+TEST(ScratchArena, AllocatesDeclaredRequirementsAligned) {
+    ScratchArena arena;
+    arena.reserve<float>(100);
+    arena.reserve<double>(10);
+    arena.reserve(256, 64);
+    arena.prepare();
+
+    arena.reset();
+    const auto floats = arena.allocate<float>(100);
+    const auto doubles = arena.allocate<double>(10);
+    void* line = arena.allocate_bytes(256, 64);
+
+    ASSERT_EQ(floats.size(), 100U);
+    ASSERT_EQ(doubles.size(), 10U);
+    ASSERT_NE(line, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(doubles.data()) % alignof(double), 0U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(line) % 64, 0U);
+    EXPECT_LE(arena.used(), arena.capacity());
+    EXPECT_EQ(arena.num_overflows(), 0U);
+}
+
+TEST(ScratchArena, ResetRewindsAndTracksPeak) {
+    ScratchArena arena;
+    arena.reserve<int32_t>(64);
+    arena.prepare();
+
+    arena.reset();
+    const auto first = arena.allocate<int32_t>(64);
+    const size_t full = arena.used();
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0U);
+    const auto second = arena.allocate<int32_t>(8);
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(arena.peak(), full);
+}
+
+TEST(ScratchArena, BlockHookReportsUsagePerBlock) {
+    ScratchArena arena;
+    arena.reserve(128, 1);
+    arena.prepare();
+
+    std::vector<size_t> reports;
+    arena.set_block_hook(
+        [](void* context, size_t used, size_t /*capacity*/) {
+            static_cast<std::vector<size_t>*>(context)->push_back(used);
+        },
+        &reports);
+
+    arena.reset();
+    (void)arena.allocate<std::byte>(40);
+    arena.reset();
+    (void)arena.allocate<std::byte>(100);
+    arena.reset();
+
+    ASSERT_EQ(reports.size(), 3U);
+    EXPECT_EQ(reports[0], 0U);
+    EXPECT_EQ(reports[1], 40U);
+    EXPECT_EQ(reports[2], 100U);
+}
+
+TEST(ScratchArena, PmrContainerDrawsFromArena) {
+    ScratchArena arena;
+    arena.reserve<float>(32);
+    arena.prepare();
+
+    arena.reset();
+    std::pmr::vector<float> values(&arena);
+    values.reserve(32);
+    for (int i = 0; i < 32; ++i) { values.push_back(static_cast<float>(i)); }
+    EXPECT_EQ(values[31], 31.0f);
+    EXPECT_GE(arena.used(), 32 * sizeof(float));
+    EXPECT_EQ(arena.num_overflows(), 0U);
+}
+
+TEST(ScratchArena, OverflowIsDetected) {
+    ScratchArena arena;
+    arena.reserve<float>(4);
+    arena.prepare();
+    arena.reset();
+
+    // Debug builds assert; release builds count the overflow and fail soft
+    EXPECT_DEBUG_DEATH(
+        {
+            const auto span = arena.allocate<float>(1024);
+            EXPECT_TRUE(span.empty());
+            EXPECT_EQ(arena.num_overflows(), 1U);
+
+            // pmr allocations fall back to the upstream resource
+            std::pmr::vector<float> values(1024, 0.0f, &arena);
+            EXPECT_EQ(values.size(), 1024U);
+            EXPECT_EQ(arena.num_overflows(), 2U);
+        },
+        "ScratchArena overflow");
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "tanh/core/threading/WorkerPool.h"
+
+using namespace thl;
+
+TEST(WorkerPool, RunsEveryIndexExactlyOnce) {
+    WorkerPool pool({.m_num_workers = 3, .m_pin_threads = false});
+    EXPECT_EQ(pool.num_workers(), 3u);
+
+    constexpr size_t k_count = 1000;
+    std::vector<std::atomic<int>> hits(k_count);
+    for (int round = 0; round < 200; ++round) {
+        auto job = [&](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); };
+        pool.parallel_for(k_count, job);
+    }
+    for (size_t i = 0; i < k_count; ++i) { EXPECT_EQ(hits[i].load(), 200) << "index " << i; }
+}
+
+TEST(WorkerPool, ResultsAreVisibleAfterReturn) {
+    WorkerPool pool({.m_num_workers = 2, .m_pin_threads = false});
+
+    // Plain (non-atomic) writes from workers must be visible to the caller
+    // once parallel_for() returns.
+    std::vector<size_t> out(64, 0);
+    for (size_t round = 1; round <= 500; ++round) {
+        auto job = [&](size_t i) { out[i] = round * i; };
+        pool.parallel_for(out.size(), job);
+        for (size_t i = 0; i < out.size(); ++i) { ASSERT_EQ(out[i], round * i); }
+    }
+}
+
+TEST(WorkerPool, WithoutWorkersRunsInlineInOrder) {
+    WorkerPool pool({.m_num_workers = 0});
+
+    const auto caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    order.reserve(8);
+    auto job = [&](size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(i);
+    };
+    pool.parallel_for(8, job);
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(WorkerPool, WakesSleepingWorkers) {
+    WorkerPool pool({.m_num_workers = 2, .m_spin_iterations = 1, .m_pin_threads = false});
+
+    // Let the workers fall asleep, then make sure a job still completes and
+    // that more than one thread can take part.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::atomic<int> total{0};
+    auto job = [&](size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        total.fetch_add(1, std::memory_order_relaxed);
+    };
+    pool.parallel_for(32, job);
+    EXPECT_EQ(total.load(), 32);
+}
+
+TEST(WorkerPool, EmptyJobIsANoOp) {
+    WorkerPool pool({.m_num_workers = 2, .m_pin_threads = false});
+    int calls = 0;
+    auto job = [&](size_t) { ++calls; };
+    pool.parallel_for(0, job);
+    EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+#include <tanh/dsp/DspTypes.h>
+#include <tanh/dsp/audio/AudioBufferView.h>
+#include <tanh/dsp/filter/Svf.h>
+#include <tanh/dsp/rings-resonator/RingsDsp.h>
+#include <tanh/dsp/rings-resonator/RingsModalResonator.h>
+#include <tanh/dsp/utils/CosineOscillator.h>
+#include <tanh/dsp/utils/SimdFloat.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace rings = thl::dsp::resonator;
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static constexpr size_t k_block_size = rings::k_max_block_size;
+
+// Low fundamental so every one of the 64 partials stays below Nyquist.
+static void prepare_resonator(rings::RingsModalResonator& resonator) {
+    resonator.prepare(rings::k_default_sample_rate);
+    resonator.set_frequency(40.0f / rings::k_default_sample_rate);
+    resonator.set_structure(0.25f);
+    resonator.set_resolution(rings::k_max_modes);
+}
+
+static std::array<float, k_block_size> make_input() {
+    std::array<float, k_block_size> in{};
+    for (size_t i = 0; i < k_block_size; ++i) { in[i] = (i % 7 == 0) ? 0.5f : -0.1f; }
+    return in;
+}
+
+// =============================================================================
+// RingsModalResonator — SoA filter bank (one voice, 64 modes)
+// =============================================================================
+
+static void bm_modal_resonator_64_modes(benchmark::State& bm_state) {
+    auto resonator = std::make_unique<rings::RingsModalResonator>();
+    prepare_resonator(*resonator);
+
+    auto in = make_input();
+    std::array<float, k_block_size> out{};
+    std::array<float, k_block_size> aux{};
+    const thl::dsp::audio::ConstAudioBufferView in_view(in.data(), k_block_size);
+    const thl::dsp::audio::AudioBufferView out_view(out.data(), k_block_size);
+    const thl::dsp::audio::AudioBufferView aux_view(aux.data(), k_block_size);
+
+    for ([[maybe_unused]] auto _ : bm_state) {
+        resonator->process(in_view, out_view, aux_view);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::DoNotOptimize(aux.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * static_cast<int64_t>(k_block_size));
+    bm_state.SetLabel(thl::dsp::utils::simd::instruction_set());
+}
+BENCHMARK(bm_modal_resonator_64_modes);
+
+// Four voices, the polyphony of a full Rings patch.
+static void bm_modal_resonator_4_voices(benchmark::State& bm_state) {
+    auto resonators = std::make_unique<std::array<rings::RingsModalResonator, 4>>();
+    for (auto& r : *resonators) { prepare_resonator(r); }
+
+    auto in = make_input();
+    std::array<float, k_block_size> out{};
+    std::array<float, k_block_size> aux{};
+    const thl::dsp::audio::ConstAudioBufferView in_view(in.data(), k_block_size);
+    const thl::dsp::audio::AudioBufferView out_view(out.data(), k_block_size);
+    const thl::dsp::audio::AudioBufferView aux_view(aux.data(), k_block_size);
+
+    for ([[maybe_unused]] auto _ : bm_state) {
+        for (auto& r : *resonators) { r.process(in_view, out_view, aux_view); }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::DoNotOptimize(aux.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * static_cast<int64_t>(k_block_size));
+    bm_state.SetLabel(thl::dsp::utils::simd::instruction_set());
+}
+BENCHMARK(bm_modal_resonator_4_voices);
+
+// =============================================================================
+// Baseline: array-of-Svf loop (the pre-SoA implementation, one voice)
+// =============================================================================
+
+static void bm_modal_svf_array_64_modes(benchmark::State& bm_state) {
+    std::array<thl::dsp::filter::Svf, rings::k_max_modes> filters{};
+    for (size_t i = 0; i < filters.size(); ++i) {
+        const float f = 40.0f / rings::k_default_sample_rate * static_cast<float>(i + 1);
+        filters[i].reset();
+        filters[i].set_f_q<thl::dsp::Approximation::Fast>(f, 1.0f + f * 500.0f);
+    }
+
+    auto in = make_input();
+    std::array<float, k_block_size> out{};
+    std::array<float, k_block_size> aux{};
+
+    for ([[maybe_unused]] auto _ : bm_state) {
+        for (size_t n = 0; n < k_block_size; ++n) {
+            thl::dsp::utils::CosineOscillator amplitudes;
+            amplitudes.prepare<thl::dsp::utils::CosineOscillatorMode::Approximate>(0.5f);
+            amplitudes.start();
+            const float input = in[n] * 0.125f;
+            float odd = 0.0f;
+            float even = 0.0f;
+            for (size_t i = 0; i < filters.size();) {
+                odd += amplitudes.next() *
+                       filters[i++].process<thl::dsp::filter::FilterMode::BandPass>(input);
+                even += amplitudes.next() *
+                        filters[i++].process<thl::dsp::filter::FilterMode::BandPass>(input);
+            }
+            out[n] = odd;
+            aux[n] = even;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::DoNotOptimize(aux.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * static_cast<int64_t>(k_block_size));
+}
+BENCHMARK(bm_modal_svf_array_64_modes);
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
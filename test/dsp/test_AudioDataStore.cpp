@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <tanh/core/threading/DeferredReclaimer.h>
+
+#include <thread>
+#include <utility>
+
+#include "tanh/dsp/audio/AudioDataStore.h"
+
+using namespace thl;
+using namespace thl::dsp::audio;
+
+namespace {
+
+void load_frames(AudioDataStore& store, size_t num_frames) {
+    store.begin_load().emplace_back(1, num_frames, 48000.0);
+    store.commit_load(60);
+}
+
+}  // namespace
+
+TEST(AudioDataStore, ReadSectionKeepsItsBufferAcrossReload) {
+    DeferredReclaimer reclaimer({.m_capacity = 16, .m_reclaim_thread = false});
+    AudioDataStore store(reclaimer);
+    load_frames(store, 64);
+
+    {
+        auto read = store.begin_read();
+        load_frames(store, 128);
+        reclaimer.collect();
+
+        // Moving the section hands the open scope over
+        const auto moved = std::move(read);
+        ASSERT_EQ(moved.buffer().size(), 1U);
+        EXPECT_EQ(moved.buffer()[0].get_num_frames(), 64U);
+        EXPECT_EQ(store.get_buffer()[0].get_num_frames(), 128U);
+        EXPECT_EQ(reclaimer.num_pending(), 1U);
+    }
+
+    reclaimer.collect();
+    EXPECT_EQ(reclaimer.num_pending(), 0U);
+}
+
+TEST(AudioDataStore, ReadSectionsArePerThread) {
+    DeferredReclaimer reclaimer({.m_capacity = 16, .m_reclaim_thread = false});
+    AudioDataStore store(reclaimer);
+    load_frames(store, 64);
+
+    const auto rt_read = store.begin_read();
+    load_frames(store, 128);
+
+    // A second reader sees the latest load, not the first reader's buffer
+    std::thread loader([&store]() {
+        const auto read = store.begin_read();
+        ASSERT_EQ(read.buffer().size(), 1U);
+        EXPECT_EQ(read.buffer()[0].get_num_frames(), 128U);
+    });
+    loader.join();
+
+    EXPECT_EQ(rt_read.buffer()[0].get_num_frames(), 64U);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <tanh/dsp/DspTypes.h>
+#include <tanh/dsp/filter/Svf.h>
+#include <tanh/dsp/rings-resonator/RingsModalFilterBank.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace rings = thl::dsp::resonator;
+
+namespace {
+
+constexpr size_t k_num_modes = 64;
+
+// Coefficients spread over the audible range with a Rings-like Q profile.
+template <typename SetFn>
+void configure_modes(size_t count, SetFn&& set) {
+    for (size_t i = 0; i < count; ++i) {
+        const float f = 0.004f * static_cast<float>(i + 1);
+        set(i, f < 0.49f ? f : 0.49f, 1.0f + f * 500.0f / static_cast<float>(i + 1));
+    }
+}
+
+// Reference: the original scalar loop over an array of Svf instances.
+void process_reference(std::array<thl::dsp::filter::Svf, k_num_modes>& filters,
+                       float input,
+                       const float* amplitudes,
+                       size_t num_modes,
+                       float& odd,
+                       float& even) {
+    odd = 0.0f;
+    even = 0.0f;
+    for (size_t i = 0; i < num_modes;) {
+        odd += amplitudes[i] * filters[i].process<thl::dsp::filter::FilterMode::BandPass>(input);
+        ++i;
+        even += amplitudes[i] * filters[i].process<thl::dsp::filter::FilterMode::BandPass>(input);
+        ++i;
+    }
+}
+
+void expect_matches_reference(size_t num_modes) {
+    rings::RingsModalFilterBank<k_num_modes> bank;
+    bank.reset();
+    std::array<thl::dsp::filter::Svf, k_num_modes> reference{};
+    for (auto& f : reference) { f.reset(); }
+
+    configure_modes(k_num_modes, [&](size_t i, float f, float q) {
+        bank.set_f_q<thl::dsp::Approximation::Fast>(i, f, q);
+        reference[i].set_f_q<thl::dsp::Approximation::Fast>(f, q);
+    });
+
+    std::array<float, k_num_modes> amplitudes{};
+    for (size_t i = 0; i < k_num_modes; ++i) {
+        amplitudes[i] = 0.5f + 0.5f * std::cos(0.37f * static_cast<float>(i));
+    }
+
+    for (size_t n = 0; n < 2048; ++n) {
+        const float input = n == 0 ? 0.125f : 0.0f;
+        float odd = 0.0f;
+        float even = 0.0f;
+        float ref_odd = 0.0f;
+        float ref_even = 0.0f;
+        bank.process(input, amplitudes.data(), num_modes, odd, even);
+        process_reference(reference, input, amplitudes.data(), num_modes, ref_odd, ref_even);
+        ASSERT_NEAR(odd, ref_odd, 1e-6f) << "odd mismatch at sample " << n;
+        ASSERT_NEAR(even, ref_even, 1e-6f) << "even mismatch at sample " << n;
+    }
+}
+
+}  // namespace
+
+TEST(RingsModalFilterBank, CoefficientsMatchSvf) {
+    rings::RingsModalFilterBank<k_num_modes> bank;
+    thl::dsp::filter::Svf svf;
+    bank.set_f_q<thl::dsp::Approximation::Fast>(3, 0.01f, 120.0f);
+    svf.set_f_q<thl::dsp::Approximation::Fast>(0.01f, 120.0f);
+    EXPECT_EQ(bank.g(3), svf.g());
+    EXPECT_EQ(bank.r(3), svf.r());
+    EXPECT_EQ(bank.h(3), svf.h());
+}
+
+TEST(RingsModalFilterBank, MatchesScalarSvfArrayAllModes) {
+    expect_matches_reference(k_num_modes);
+}
+
+TEST(RingsModalFilterBank, MatchesScalarSvfArrayPartialModes) {
+    // Not a multiple of any SIMD width — exercises the scalar tail.
+    expect_matches_reference(22);
+}
+
+TEST(RingsModalFilterBank, OddModeCountRunsNextMode) {
+    // The original loop steps in pairs, so 21 modes advance mode 21 too.
+    expect_matches_reference(21);
+}
+
+TEST(RingsModalFilterBank, ModesPastCountAreUntouched) {
+    rings::RingsModalFilterBank<k_num_modes> bank;
+    bank.reset();
+    configure_modes(k_num_modes, [&](size_t i, float f, float q) {
+        bank.set_f_q<thl::dsp::Approximation::Fast>(i, f, q);
+    });
+
+    std::array<float, k_num_modes> amplitudes{};
+    amplitudes.fill(1.0f);
+
+    // Drive only the first 8 modes, then listen to modes 8..9 in isolation.
+    float odd = 0.0f;
+    float even = 0.0f;
+    for (int n = 0; n < 64; ++n) { bank.process(1.0f, amplitudes.data(), 8, odd, even); }
+
+    amplitudes.fill(0.0f);
+    amplitudes[8] = 1.0f;
+    amplitudes[9] = 1.0f;
+    bank.process(0.0f, amplitudes.data(), 10, odd, even);
+    EXPECT_EQ(odd, 0.0f);
+    EXPECT_EQ(even, 0.0f);
+}
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
+#include <tanh/core/threading/WorkerPool.h>
 #include <tanh/modulation/InputEventQueue.h>
 #include <tanh/modulation/LFOSource.h>
 #include <tanh/modulation/ModulationMatrix.h>
@@ -9,6 +10,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <vector>
@@ -171,6 +173,77 @@ static void bm_smart_handle_load_int(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_smart_handle_load_int);
 
+// =============================================================================
+// Block reads: per-sample load() loop vs load_block()
+// =============================================================================
+
+// Shared setup: one LFO on a linear float target (plain-space buffer), or on
+// a power-law target when `skewed` (normalized buffer + curve conversion).
+static SmartHandle<float> setup_block_read(State& state,
+                                           ModulationMatrix& matrix,
+                                           BenchLFO& lfo,
+                                           bool skewed) {
+    state.create("param",
+                 ParameterDefinition::make_float(
+                     "P", skewed ? Range::power_law(20.0f, 20000.0f, 3.0f) : Range::linear(0.0f, 1.0f),
+                     skewed ? 440.0f : 0.5f)
+                     .modulatable(true));
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<float>("param");
+    matrix.add_routing({"lfo", "param", 0.25f});
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+    return handle;
+}
+
+static void bm_smart_handle_read_block_per_sample(benchmark::State& bm_state) {
+    State state;
+    ModulationMatrix matrix(state);
+    BenchLFO lfo;
+    auto handle = setup_block_read(state, matrix, lfo, bm_state.range(0) != 0);
+
+    std::vector<float> out(k_block_size);
+    for ([[maybe_unused]] auto _ : bm_state) {
+        for (size_t i = 0; i < k_block_size; ++i) { out[i] = handle.load(static_cast<uint32_t>(i)); }
+        benchmark::DoNotOptimize(out.data());
+    }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) *
+                               static_cast<int64_t>(k_block_size));
+}
+BENCHMARK(bm_smart_handle_read_block_per_sample)->Arg(0)->Arg(1);
+
+static void bm_smart_handle_load_block(benchmark::State& bm_state) {
+    State state;
+    ModulationMatrix matrix(state);
+    BenchLFO lfo;
+    auto handle = setup_block_read(state, matrix, lfo, bm_state.range(0) != 0);
+
+    std::vector<float> out(k_block_size);
+    for ([[maybe_unused]] auto _ : bm_state) {
+        handle.load_block(std::span<float>(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) *
+                               static_cast<int64_t>(k_block_size));
+}
+BENCHMARK(bm_smart_handle_load_block)->Arg(0)->Arg(1);
+
+static void bm_smart_handle_load_block_normalized(benchmark::State& bm_state) {
+    State state;
+    ModulationMatrix matrix(state);
+    BenchLFO lfo;
+    auto handle = setup_block_read(state, matrix, lfo, bm_state.range(0) != 0);
+
+    std::vector<float> out(k_block_size);
+    for ([[maybe_unused]] auto _ : bm_state) {
+        handle.load_block_normalized(std::span<float>(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) *
+                               static_cast<int64_t>(k_block_size));
+}
+BENCHMARK(bm_smart_handle_load_block_normalized)->Arg(0)->Arg(1);
+
 // =============================================================================
 // ModulationMatrix::process — single source, single target
 // =============================================================================
@@ -221,6 +294,55 @@ static void bm_process_n_routings(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_process_n_routings)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
 
+// =============================================================================
+// Patch load — N routings added one by one vs. inside one begin_batch()
+// =============================================================================
+
+static void bm_patch_load(benchmark::State& bm_state) {
+    const auto num_routings = bm_state.range(0);
+    const bool batched = bm_state.range(1) != 0;
+    State state;
+    std::vector<BenchLFO> lfos(static_cast<size_t>(num_routings));
+    std::vector<std::string> src_ids;
+    std::vector<std::string> tgt_keys;
+    for (int64_t i = 0; i < num_routings; ++i) {
+        src_ids.push_back("lfo_" + std::to_string(i));
+        tgt_keys.push_back("param_" + std::to_string(i));
+        state.create(tgt_keys.back(), modulatable_float(0.5f));
+    }
+
+    auto load = [&](ModulationMatrix& matrix) {
+        for (size_t i = 0; i < src_ids.size(); ++i) {
+            matrix.add_source(src_ids[i], &lfos[i]);
+            matrix.add_routing({src_ids[i], tgt_keys[i], 0.5f});
+        }
+    };
+
+    for ([[maybe_unused]] auto _ : bm_state) {
+        bm_state.PauseTiming();
+        auto matrix = std::make_unique<ModulationMatrix>(state);
+        matrix->prepare(k_sample_rate, k_block_size);
+        bm_state.ResumeTiming();
+
+        if (batched) {
+            auto tx = matrix->begin_batch();
+            load(*matrix);
+            tx.commit();
+        } else {
+            load(*matrix);
+        }
+
+        bm_state.PauseTiming();
+        matrix.reset();
+        bm_state.ResumeTiming();
+    }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) * num_routings);
+}
+BENCHMARK(bm_patch_load)
+    ->ArgsProduct({{64, 256}, {0, 1}})
+    ->ArgNames({"routings", "batched"})
+    ->Unit(benchmark::kMillisecond);
+
 // =============================================================================
 // ModulationMatrix::process — multiple sources to same target (fan-in)
 // =============================================================================
@@ -445,6 +567,142 @@ static void bm_full_modulated_read_loop(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_full_modulated_read_loop);
 
+// =============================================================================
+// ModulationMatrix::process — parallel rendering, 1..N cores
+// =============================================================================
+
+// Per-voice sine oscillator — heavy enough per sample that rendering, not
+// routing, dominates the block.
+class BenchVoiceSine : public ModulationSource {
+public:
+    explicit BenchVoiceSine(ModulationScope scope) : ModulationSource(scope, true) {}
+
+    void prepare(double sample_rate, size_t samples_per_block, uint32_t voice_count) override {
+        resize_buffers(samples_per_block, voice_count);
+        m_phase.assign(voice_count, 0.0);
+        m_increment = 3.0 / sample_rate;
+    }
+
+    void process_voice(uint32_t voice, size_t num_samples, size_t offset = 0) override {
+        float* out = voice_output(voice);
+        double phase = m_phase[voice];
+        const double increment = m_increment * static_cast<double>(voice + 1);
+        for (size_t i = offset; i < offset + num_samples; ++i) {
+            out[i] = static_cast<float>(std::sin(phase * 6.283185307179586));
+            phase += increment;
+            if (phase >= 1.0) { phase -= 1.0; }
+        }
+        m_phase[voice] = phase;
+        if (num_samples > 0) { record_voice_change_point(voice, static_cast<uint32_t>(offset)); }
+    }
+
+    [[nodiscard]] bool supports_concurrent_render() const override { return true; }
+
+private:
+    std::vector<double> m_phase;
+    double m_increment = 0.0;
+};
+
+// 16 independent 16-voice sources. Arg = total threads including the audio
+// thread; 1 runs the serial path without a pool.
+static void bm_process_parallel_voices(benchmark::State& bm_state) {
+    constexpr uint32_t k_num_sources = 16;
+    constexpr uint32_t k_num_voices = 16;
+    const auto num_threads = static_cast<size_t>(bm_state.range(0));
+
+    State state;
+    ModulationMatrix matrix(state);
+    const auto scope = matrix.register_scope("voice", k_num_voices);
+
+    std::vector<std::unique_ptr<BenchVoiceSine>> sources;
+    for (uint32_t s = 0; s < k_num_sources; ++s) {
+        const std::string src_id = "sine_" + std::to_string(s);
+        const std::string tgt_key = "param_" + std::to_string(s);
+        state.create(tgt_key, modulatable_float(0.5f).modulation_scope(scope));
+        sources.push_back(std::make_unique<BenchVoiceSine>(scope));
+        matrix.add_source(src_id, sources.back().get());
+        matrix.get_smart_handle<float>(tgt_key);
+        matrix.add_routing({src_id, tgt_key, 0.25f});
+    }
+    matrix.prepare(k_sample_rate, k_block_size);
+
+    std::unique_ptr<WorkerPool> pool;
+    if (num_threads > 1) {
+        pool = std::make_unique<WorkerPool>(WorkerPool::Options{.m_num_workers = num_threads - 1});
+        matrix.set_worker_pool(pool.get());
+    }
+
+    for ([[maybe_unused]] auto _ : bm_state) { matrix.process(k_block_size); }
+    matrix.set_worker_pool(nullptr);
+
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) *
+                               static_cast<int64_t>(k_block_size) * k_num_sources * k_num_voices);
+}
+BENCHMARK(bm_process_parallel_voices)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+// =============================================================================
+// ModulationMatrix::process — routing kernels: routings × voices sweep
+// =============================================================================
+
+// Cheap per-voice source so the sweep measures the routing kernels rather
+// than rendering.
+class BenchVoiceRamp : public ModulationSource {
+public:
+    explicit BenchVoiceRamp(ModulationScope scope) : ModulationSource(scope, true) {}
+
+    void prepare(double /*sample_rate*/, size_t samples_per_block, uint32_t voice_count) override {
+        resize_buffers(samples_per_block, voice_count);
+        for (uint32_t v = 0; v < voice_count; ++v) {
+            float* out = voice_output(v);
+            for (size_t i = 0; i < samples_per_block; ++i) {
+                out[i] = static_cast<float>(i) / static_cast<float>(samples_per_block);
+            }
+        }
+    }
+
+    // Output is prefilled in prepare(); only the change point is per block.
+    void process_voice(uint32_t voice, size_t num_samples, size_t offset = 0) override {
+        if (num_samples > 0) { record_voice_change_point(voice, static_cast<uint32_t>(offset)); }
+    }
+};
+
+// range(0) routings from distinct sources into one per-voice target with
+// range(1) voices. range(2) selects the combine mode: 0 = Additive,
+// 1 = Replace (priority-contended once there are two or more routings),
+// 2 = ReplaceHold.
+static void bm_process_routing_sweep(benchmark::State& bm_state) {
+    const auto num_routings = static_cast<uint32_t>(bm_state.range(0));
+    const auto num_voices = static_cast<uint32_t>(bm_state.range(1));
+    const auto mode = bm_state.range(2);
+
+    State state;
+    ModulationMatrix matrix(state);
+    const auto scope = matrix.register_scope("voice", num_voices);
+    state.create("target", modulatable_float(0.5f).modulation_scope(scope));
+    matrix.get_smart_handle<float>("target");
+
+    std::vector<std::unique_ptr<BenchVoiceRamp>> sources;
+    for (uint32_t r = 0; r < num_routings; ++r) {
+        const std::string src_id = "ramp_" + std::to_string(r);
+        sources.push_back(std::make_unique<BenchVoiceRamp>(scope));
+        matrix.add_source(src_id, sources.back().get());
+
+        ModulationRouting routing(src_id, "target", 0.25f);
+        if (mode == 1) { routing.m_combine_mode = CombineMode::Replace; }
+        if (mode == 2) { routing.m_combine_mode = CombineMode::ReplaceHold; }
+        routing.m_replace_priority = r;
+        matrix.add_routing(routing);
+    }
+    matrix.prepare(k_sample_rate, k_block_size);
+
+    for ([[maybe_unused]] auto _ : bm_state) { matrix.process(k_block_size); }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) *
+                               static_cast<int64_t>(k_block_size) * num_routings * num_voices);
+}
+BENCHMARK(bm_process_routing_sweep)
+    ->ArgsProduct({{1, 4, 16}, {1, 8, 16}, {0, 1, 2}})
+    ->ArgNames({"routings", "voices", "mode"});
+
 // =============================================================================
 // InputEventQueue — drain_spread throughput (N events × M voices per block)
 // =============================================================================
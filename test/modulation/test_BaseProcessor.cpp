@@ -72,3 +72,24 @@ TEST(BaseProcessor, ProcessModulatedSkipsInvalidChangePoints) {
     EXPECT_EQ(proc.m_block_sizes[0], 200u);
     EXPECT_EQ(proc.m_block_sizes[1], 312u);
 }
+
+TEST(BaseProcessor, ProcessModulatedWithChangePointMask) {
+    CallCountingProcessor proc;
+    proc.prepare(k_sample_rate, k_block_size, 1);
+
+    std::vector<float> data(512, 1.0f);
+    thl::dsp::audio::AudioBufferView view(data.data(), 512);
+
+    // Same splits as the index-list overload, with 0 skipped and a point in
+    // a later word.
+    std::vector<uint64_t> words(thl::dsp::utils::change_point_words(512), 0);
+    thl::dsp::utils::set_change_point(words.data(), 0);
+    thl::dsp::utils::set_change_point(words.data(), 100);
+    thl::dsp::utils::set_change_point(words.data(), 300);
+    proc.process_modulated(view, thl::dsp::utils::ChangePointMask{words, 512});
+
+    ASSERT_EQ(proc.m_block_sizes.size(), 3u);
+    EXPECT_EQ(proc.m_block_sizes[0], 100u);
+    EXPECT_EQ(proc.m_block_sizes[1], 200u);
+    EXPECT_EQ(proc.m_block_sizes[2], 212u);
+}
@@ -30,9 +30,9 @@ inline void sink(float v) {
 // process_with_scope + SmartHandle::load while a "writer" thread concurrently
 // mutates routings and re-prepares the matrix with varying block sizes. Under
 // the old design, the audio thread could dereference m_voice/m_mono mid-rebuild
-// and crash; under the new design those pointers are only swapped after a
-// synchronize() barrier, so readers always see either the old or the new
-// buffer — never a torn or reclaimed one.
+// and crash; under the new design retired buffers are only destroyed by the
+// DeferredReclaimer once no ReadScope can reference them, so readers always
+// see either the old or the new buffer — never a torn or reclaimed one.
 TEST(ConcurrentRebuild, NoNullDerefUnderConcurrentRoutingChurn) {
     thl::State state;
     const int num_params = 8;
@@ -70,7 +70,7 @@ TEST(ConcurrentRebuild, NoNullDerefUnderConcurrentRoutingChurn) {
 
             // Reads the atomic buffer pointers inside the scope — the retired
             // buffers from any in-flight rebuild are guaranteed live until
-            // this scope closes and the writer's synchronize() completes.
+            // this scope closes.
             float acc = 0.0f;
             for (const auto& h : handles) { acc += h.load(0); }
             sink(acc);
@@ -137,7 +137,7 @@ TEST(ConcurrentRebuild, NoNullDerefUnderConcurrentRoutingChurn) {
 // Additional scenario: a single routing is repeatedly removed and re-added on
 // the same (source, target) pair. Each add/remove cycle allocates and retires
 // the target's MonoBuffers. Verifies that SmartHandle reads never observe a
-// half-swapped pointer and that reclamation via synchronize() is actually
+// half-swapped pointer and that reclamation via the reclaimer is actually
 // happening (no unbounded heap growth would be a separate OOM detection).
 TEST(ConcurrentRebuild, RepeatedAddRemoveSingleRouting) {
     thl::State state;
@@ -179,3 +179,33 @@ TEST(ConcurrentRebuild, RepeatedAddRemoveSingleRouting) {
 
     EXPECT_GT(audio_iterations.load(), 100U);
 }
+
+// Rebuilds hand retired buffers to the DeferredReclaimer instead of waiting
+// for the audio thread: with a ReadScope open, the writer returns at once and
+// the old buffers stay alive until the scope closes.
+TEST(ConcurrentRebuild, RetiredBuffersOutliveOpenReadScope) {
+    thl::State state;
+    state.create("freq", modulatable_float(440.0f));
+
+    thl::DeferredReclaimer reclaimer({.m_reclaim_thread = false});
+    ModulationMatrix matrix(state, reclaimer);
+
+    TestLFOSource lfo;
+    matrix.add_source("lfo", &lfo);
+    const uint32_t id = matrix.add_routing({"lfo", "freq", 50.0f});
+    ASSERT_NE(id, k_invalid_routing_id);
+    matrix.prepare(k_sample_rate, k_block_size);
+    reclaimer.collect();
+
+    {
+        auto scope = matrix.read_scope();
+        std::thread writer([&]() { matrix.prepare(k_sample_rate, k_block_size * 2); });
+        writer.join();  // would deadlock if the rebuild waited for readers
+
+        EXPECT_GT(reclaimer.num_pending(), 0U);
+        EXPECT_EQ(reclaimer.collect(), 0U);
+    }
+
+    EXPECT_GT(reclaimer.collect(), 0U);
+    EXPECT_EQ(reclaimer.num_pending(), 0U);
+}
@@ -311,3 +311,187 @@ TEST(InputEventQueue, GlobalScopeIgnoresVoiceCountInPrepare) {
     EXPECT_EQ(q.num_voices(), 0u);
     EXPECT_TRUE(q.has_mono());
 }
+
+// ── Timestamped events (drain_timed) ────────────────────────────────────────
+
+using Timestamp = InputEventQueue::Timestamp;
+using LatePolicy = InputEventQueue::LatePolicy;
+using BlockTiming = InputEventQueue::BlockTiming;
+
+TEST(InputEventQueue, SampleStampedEventsLandAtExactOffsets) {
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/0);
+
+    // Pushed out of order; dispatched in time order.
+    ASSERT_TRUE(q.push_mono_value(0.3f, Timestamp::at_sample(1000 + 300)));
+    ASSERT_TRUE(q.push_mono_value(0.1f, Timestamp::at_sample(1000 + 17)));
+    ASSERT_TRUE(q.push_mono_value(0.2f, Timestamp::at_sample(1000 + 17)));
+
+    DrainRecorder rec;
+    const BlockTiming timing{.m_block_start_sample = 1000};
+    EXPECT_EQ(q.drain_timed(512, timing, rec.callback()), 3u);
+
+    ASSERT_EQ(rec.m_events.size(), 3u);
+    EXPECT_EQ(rec.m_events[0].m_offset, 17u);
+    EXPECT_FLOAT_EQ(rec.m_events[0].m_event.m_value, 0.1f);
+    EXPECT_EQ(rec.m_events[1].m_offset, 17u);  // FIFO on ties
+    EXPECT_FLOAT_EQ(rec.m_events[1].m_event.m_value, 0.2f);
+    EXPECT_EQ(rec.m_events[2].m_offset, 300u);
+    EXPECT_FLOAT_EQ(rec.m_events[2].m_event.m_value, 0.3f);
+}
+
+TEST(InputEventQueue, HostStampedEventsConvertThroughSampleRate) {
+    InputEventQueue q(k_voice_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/2);
+
+    ASSERT_TRUE(q.push_voice_active(1, true, Timestamp::at_host_time(10.0 + 0.001)));
+
+    DrainRecorder rec;
+    const BlockTiming timing{.m_block_start_host_seconds = 10.0, .m_sample_rate = 48000.0};
+    EXPECT_EQ(q.drain_timed(512, timing, rec.callback()), 1u);
+
+    ASSERT_EQ(rec.m_events.size(), 1u);
+    EXPECT_EQ(rec.m_events[0].m_offset, 48u);
+    EXPECT_EQ(rec.m_events[0].m_event.m_voice, 1u);
+    EXPECT_TRUE(rec.m_events[0].m_event.m_active);
+}
+
+TEST(InputEventQueue, FutureEventsWaitForTheirBlock) {
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/0);
+
+    ASSERT_TRUE(q.push_mono_value(0.5f, Timestamp::at_sample(512 + 64)));
+
+    DrainRecorder first;
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 0}, first.callback()), 0u);
+    EXPECT_TRUE(first.m_events.empty());
+    EXPECT_EQ(q.num_pending(), 1u);
+
+    DrainRecorder second;
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 512}, second.callback()), 1u);
+    ASSERT_EQ(second.m_events.size(), 1u);
+    EXPECT_EQ(second.m_events[0].m_offset, 64u);
+    EXPECT_EQ(q.num_pending(), 0u);
+}
+
+TEST(InputEventQueue, LateEventsClampToBlockStart) {
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/0);
+
+    ASSERT_TRUE(q.push_mono_value(0.5f, Timestamp::at_sample(900)));
+
+    DrainRecorder rec;
+    const BlockTiming timing{.m_block_start_sample = 1024, .m_late_policy = LatePolicy::Clamp};
+    EXPECT_EQ(q.drain_timed(512, timing, rec.callback()), 1u);
+    ASSERT_EQ(rec.m_events.size(), 1u);
+    EXPECT_EQ(rec.m_events[0].m_offset, 0u);
+}
+
+TEST(InputEventQueue, LateEventsCanBeDropped) {
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/0);
+
+    ASSERT_TRUE(q.push_mono_value(0.1f, Timestamp::at_sample(900)));
+    ASSERT_TRUE(q.push_mono_value(0.2f, Timestamp::at_sample(1024 + 8)));
+
+    DrainRecorder rec;
+    const BlockTiming timing{.m_block_start_sample = 1024, .m_late_policy = LatePolicy::Drop};
+    EXPECT_EQ(q.drain_timed(512, timing, rec.callback()), 1u);
+    ASSERT_EQ(rec.m_events.size(), 1u);
+    EXPECT_FLOAT_EQ(rec.m_events[0].m_event.m_value, 0.2f);
+    EXPECT_EQ(rec.m_events[0].m_offset, 8u);
+    EXPECT_EQ(q.num_dropped_late(), 1u);
+    EXPECT_EQ(q.num_pending(), 0u);
+}
+
+TEST(InputEventQueue, DeferShiftsEventsByLatency) {
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/0);
+
+    // Two events 100 samples apart, the first arriving 50 samples late.
+    ASSERT_TRUE(q.push_mono_value(0.1f, Timestamp::at_sample(1024 - 50)));
+    ASSERT_TRUE(q.push_mono_value(0.2f, Timestamp::at_sample(1024 + 50)));
+
+    DrainRecorder rec;
+    const BlockTiming timing{.m_block_start_sample = 1024,
+                             .m_late_policy = LatePolicy::Defer,
+                             .m_defer_latency = 128};
+    EXPECT_EQ(q.drain_timed(512, timing, rec.callback()), 2u);
+    ASSERT_EQ(rec.m_events.size(), 2u);
+    EXPECT_EQ(rec.m_events[0].m_offset, 78u);
+    EXPECT_EQ(rec.m_events[1].m_offset, 178u);  // spacing preserved
+}
+
+TEST(InputEventQueue, UntimedEventsSpreadAlongsideTimedOnes) {
+    InputEventQueue q(k_voice_scope, /*queue_capacity=*/32);
+    q.prepare(/*num_voices=*/2);
+
+    ASSERT_TRUE(q.push_voice_value(0, 0.1f));
+    ASSERT_TRUE(q.push_voice_value(0, 0.2f));
+    ASSERT_TRUE(q.push_voice_value(0, 0.9f, Timestamp::at_sample(100)));
+    ASSERT_TRUE(q.push_voice_value(1, 0.5f));
+
+    DrainRecorder rec;
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 0}, rec.callback()), 4u);
+
+    ASSERT_EQ(rec.m_events.size(), 4u);
+    // Voice 0: untimed at 0 and 256, the timed one in between.
+    EXPECT_EQ(rec.m_events[0].m_offset, 0u);
+    EXPECT_FLOAT_EQ(rec.m_events[0].m_event.m_value, 0.1f);
+    EXPECT_EQ(rec.m_events[1].m_offset, 100u);
+    EXPECT_FLOAT_EQ(rec.m_events[1].m_event.m_value, 0.9f);
+    EXPECT_EQ(rec.m_events[2].m_offset, 256u);
+    EXPECT_FLOAT_EQ(rec.m_events[2].m_event.m_value, 0.2f);
+    // Voice 1 is its own stream.
+    EXPECT_EQ(rec.m_events[3].m_offset, 0u);
+    EXPECT_EQ(rec.m_events[3].m_event.m_voice, 1u);
+}
+
+TEST(InputEventQueue, FarFutureEventsDoNotBlockDueOnes) {
+    constexpr size_t k_capacity = 16;
+    InputEventQueue q(k_voice_scope, k_capacity, /*pending_capacity=*/k_capacity);
+    q.prepare(/*num_voices=*/4);
+
+    // Fill the pending set with far-future events; an event due in the next
+    // block must still get through on time.
+    for (size_t i = 0; i < k_capacity; ++i) {
+        ASSERT_TRUE(q.push_voice_value(0, 0.0f, Timestamp::at_sample(1'000'000 + i)));
+    }
+    DrainRecorder rec;
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 0}, rec.callback()), 0u);
+    EXPECT_EQ(q.num_pending(), k_capacity);
+
+    ASSERT_TRUE(q.push_voice_value(1, 0.5f, Timestamp::at_sample(512 + 7)));
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 512}, rec.callback()), 1u);
+    ASSERT_EQ(rec.m_events.size(), 1u);
+    EXPECT_EQ(rec.m_events[0].m_event.m_voice, 1u);
+    EXPECT_EQ(rec.m_events[0].m_offset, 7u);
+    EXPECT_EQ(q.num_pending(), k_capacity);
+    EXPECT_EQ(q.num_dropped_overflow(), 0u);
+
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 1'000'000}, rec.callback()), k_capacity);
+    EXPECT_EQ(q.num_pending(), 0u);
+}
+
+TEST(InputEventQueue, PendingOverflowDropsLatestDueEvents) {
+    constexpr size_t k_capacity = 4;
+    InputEventQueue q(k_global_scope, /*queue_capacity=*/8, k_capacity);
+    q.prepare(/*num_voices=*/0);
+
+    // Six future events, pushed latest-first: the four earliest are kept.
+    for (int i = 5; i >= 0; --i) {
+        ASSERT_TRUE(q.push_mono_value(static_cast<float>(i),
+                                      Timestamp::at_sample(1024 + static_cast<uint64_t>(i))));
+    }
+    DrainRecorder rec;
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 0}, rec.callback()), 0u);
+    EXPECT_EQ(q.num_pending(), k_capacity);
+    EXPECT_EQ(q.num_dropped_overflow(), 2u);
+
+    EXPECT_EQ(q.drain_timed(512, {.m_block_start_sample = 1024}, rec.callback()), k_capacity);
+    ASSERT_EQ(rec.m_events.size(), k_capacity);
+    for (size_t i = 0; i < k_capacity; ++i) {
+        EXPECT_EQ(rec.m_events[i].m_offset, i);
+        EXPECT_FLOAT_EQ(rec.m_events[i].m_event.m_value, static_cast<float>(i));
+    }
+}
@@ -280,3 +280,49 @@ TEST(LFOSource, CurrentPhaseAdvances) {
     lfo.process(k_block_size);
     EXPECT_GT(lfo.current_phase(), 0.0f);
 }
+
+TEST(LFOSource, DecimatedOutputDescribesItsSegments) {
+    TestLFOSource lfo;
+    lfo.m_frequency = 3.0f;
+    lfo.m_decimation = 128;
+    lfo.prepare(k_sample_rate, k_block_size, /*voice_count=*/1);
+
+    for (int block = 0; block < 3; ++block) {
+        lfo.process(k_block_size);
+        const auto segments = lfo.output_segments();
+        ASSERT_EQ(segments.size(), k_block_size / 128) << "block " << block;
+
+        const auto& output = lfo.get_output_buffer();
+        for (size_t k = 0; k < segments.size(); ++k) {
+            const size_t end = k + 1 < segments.size() ? segments[k + 1].m_start : k_block_size;
+            EXPECT_EQ(segments[k].m_start, k * 128);
+            for (size_t i = segments[k].m_start; i < end; ++i) {
+                ASSERT_EQ(output[i], segments[k].m_value) << "block " << block << " sample " << i;
+            }
+        }
+    }
+}
+
+TEST(LFOSource, PerSampleOutputDropsItsSegments) {
+    TestLFOSource lfo;
+    lfo.m_frequency = 3.0f;
+    lfo.prepare(k_sample_rate, k_block_size, /*voice_count=*/1);
+
+    lfo.process(k_block_size);
+    EXPECT_TRUE(lfo.output_segments().empty());
+}
+
+TEST(LFOSource, PartialRendersDescribeNoSegments) {
+    TestLFOSource lfo;
+    lfo.m_frequency = 3.0f;
+    lfo.m_decimation = 128;
+    lfo.prepare(k_sample_rate, k_block_size, /*voice_count=*/1);
+
+    // Cyclic path: one sample at a time, starting at offset 0
+    lfo.process(1, 0);
+    EXPECT_TRUE(lfo.output_segments().empty());
+
+    lfo.clear_output_segments();
+    lfo.process(k_block_size / 2);
+    EXPECT_TRUE(lfo.output_segments().empty());
+}
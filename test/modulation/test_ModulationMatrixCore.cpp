@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <tanh/modulation/ModulationMatrix.h>
+#include <tanh/state/BinarySnapshot.h>
 #include <tanh/state/State.h>
 
 #include <array>
 #include <nlohmann/json.hpp>
+#include <thread>
 #include <utility>
 
 #include "TestHelpers.h"
@@ -1248,6 +1250,58 @@ TEST(ModulationMatrix, Serialization_RoutingIdRoundTrip) {
     EXPECT_GT(id3, id2);
 }
 
+TEST(ModulationMatrix, Serialization_BinaryRoundTrip) {
+    thl::State state;
+    state.create("p1", modulatable_float(0.0f));
+    state.create("p2", modulatable_float(0.0f));
+    ModulationMatrix matrix(state);
+
+    ConstSource src;
+    matrix.add_source("src", &src);
+    matrix.get_smart_handle<float>("p1");
+    matrix.get_smart_handle<float>("p2");
+
+    ModulationRouting replace{"src", "p2", 0.25f};
+    replace.m_depth_mode = DepthMode::Absolute;
+    replace.m_combine_mode = CombineMode::ReplaceHold;
+    replace.m_replace_priority = 3;
+    replace.m_replace_hold_priority = 1;
+    replace.m_replace_range_min = 0.2f;
+    replace.m_replace_range_max = 0.6f;
+    replace.m_has_replace_range = true;
+    replace.m_skip_during_gesture = true;
+    replace.m_max_decimation = 16;
+    matrix.add_routing({"src", "p1", 0.5f});
+    matrix.add_routing(replace);
+    matrix.prepare(k_sample_rate, k_block_size);
+    state.set("p1", 0.75f);
+
+    const auto blob = matrix.to_binary();
+    state.set("p1", 0.0f);
+
+    ModulationMatrix matrix2(state);
+    matrix2.add_source("src", &src);
+    matrix2.get_smart_handle<float>("p1");
+    matrix2.get_smart_handle<float>("p2");
+    matrix2.from_binary(blob);
+    matrix2.prepare(k_sample_rate, k_block_size);
+
+    // Routings and parameter values both come back
+    EXPECT_EQ(matrix2.to_json(false), matrix.to_json(false));
+    EXPECT_FLOAT_EQ(0.75f, state.get<float>("p1"));
+
+    // Routings only, then a malformed blob leaves them untouched
+    ModulationMatrix matrix3(state);
+    matrix3.add_source("src", &src);
+    matrix3.from_binary(matrix.to_binary(false));
+    EXPECT_EQ(matrix3.to_json(false), matrix.to_json(false));
+
+    auto truncated = blob;
+    truncated.resize(40);
+    EXPECT_THROW(matrix3.from_binary(truncated), thl::SnapshotFormatException);
+    EXPECT_EQ(matrix3.to_json(false), matrix.to_json(false));
+}
+
 // ── Skip During Gesture Tests ───────────────────────────────────────────────
 
 TEST(ModulationMatrix, SkipDuringGesture_SuppressesModulation) {
@@ -1750,3 +1804,249 @@ TEST(ModulationSource, DefaultPreProcessBlockIsNoOp) {
     // Modulation still occurred normally.
     EXPECT_TRUE(has_mono_additive(target));
 }
+
+// ── Block kernels ──────────────────────────────────────────────────────────
+
+TEST(ModulationMatrix, DecimationTicksCarryAcrossBlocks) {
+    // Routing decimation ticks sit on a fixed grid of the global sample
+    // clock, independent of where block boundaries fall.
+    thl::State state;
+    state.create("param", modulatable_float(0.0f));
+    ModulationMatrix matrix(state);
+
+    ConstSource src;
+    matrix.add_source("src", &src);
+    matrix.get_smart_handle<float>("param");
+
+    ModulationRouting routing("src", "param", 0.5f);
+    routing.m_max_decimation = 48;
+    matrix.add_routing(routing);
+
+    constexpr size_t k_block = 100;
+    matrix.prepare(k_sample_rate, 128);
+
+    for (size_t block = 0; block < 5; ++block) {
+        matrix.process(k_block);
+
+        // The source contributes a change point at 0 every block.
+        std::vector<uint32_t> expected{0};
+        for (size_t i = 1; i < k_block; ++i) {
+            if ((block * k_block + i) % 48 == 0) { expected.push_back(static_cast<uint32_t>(i)); }
+        }
+        EXPECT_EQ(mono_of(matrix.get_target("param"))->m_change_points, expected)
+            << "block " << block;
+    }
+}
+
+TEST(ModulationMatrix, ContendedReplaceMixesLiveWindowsPerSample) {
+    // A fully-active low-priority Replace and a windowed high-priority
+    // Replace: the winner changes mid-chunk, so the contended kernel has to
+    // resolve individual samples rather than whole chunks.
+    thl::State state;
+    state.create("param", modulatable_float(0.0f));
+    ModulationMatrix matrix(state);
+
+    ConstSource low;
+    low.m_value = 0.25f;
+    WindowedActiveSource high;
+    high.m_value = 0.75f;
+    high.m_start = 37;
+    high.m_end = 301;
+
+    matrix.add_source("low", &low);
+    matrix.add_source("high", &high);
+    auto handle = matrix.get_smart_handle<float>("param");
+
+    ModulationRouting r_low("low", "param", 1.0f);
+    r_low.m_combine_mode = CombineMode::Replace;
+    r_low.m_replace_priority = 1;
+    matrix.add_routing(r_low);
+
+    ModulationRouting r_high("high", "param", 1.0f);
+    r_high.m_combine_mode = CombineMode::Replace;
+    r_high.m_replace_priority = 2;
+    matrix.add_routing(r_high);
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    for (int block = 0; block < 2; ++block) {
+        matrix.process(k_block_size);
+        for (uint32_t i = 0; i < k_block_size; ++i) {
+            const float expected = (i >= 37 && i < 301) ? 0.75f : 0.25f;
+            ASSERT_FLOAT_EQ(handle.load(i), expected) << "block " << block << " sample " << i;
+        }
+    }
+}
+
+namespace {
+
+// Emits m_value for the whole block, or a step of +0.05 at every entry of
+// m_steps, or (m_ramp) a per-sample ramp. When m_declare is set the constant
+// and stepped shapes are declared as piecewise-constant output.
+class DeclaredConstSource : public ModulationSource {
+public:
+    float m_value = 0.5f;
+    bool m_declare = true;
+    bool m_ramp = false;
+    std::vector<uint32_t> m_steps;
+    DeclaredConstSource() : ModulationSource(thl::modulation::k_global_scope, true) {}
+    void prepare(double /*sr*/, size_t spb, uint32_t voice_count) override {
+        resize_buffers(spb, voice_count);
+    }
+    void process(size_t num_samples, size_t offset = 0) override {
+        size_t step = 0;
+        float value = m_value;
+        if (m_declare && !m_ramp) { declare_output_segment(0, value); }
+        for (size_t i = offset; i < offset + num_samples; ++i) {
+            if (step < m_steps.size() && i == m_steps[step]) {
+                ++step;
+                value += 0.05f;
+                if (m_declare && !m_ramp) {
+                    declare_output_segment(static_cast<uint32_t>(i), value);
+                }
+            }
+            m_output_buffer[i] = m_ramp ? static_cast<float>(i) / 1000.0f : value;
+        }
+        if (num_samples > 0) { record_change_point(static_cast<uint32_t>(offset)); }
+    }
+};
+
+}  // namespace
+
+TEST(ModulationMatrix, PiecewiseConstantSourceMatchesDenseRendering) {
+    // The same routings fed by a declaring and a non-declaring source must
+    // load identical values while the declaring source alternates between
+    // constant, stepped and ramped blocks — on plain, single-Replace and
+    // contended-Replace targets.
+    auto run = [](bool declare) {
+        thl::State state;
+        state.create("add", modulatable_float(0.1f));
+        state.create("rep", modulatable_float(0.1f));
+        state.create("contended", modulatable_float(0.1f));
+        ModulationMatrix matrix(state);
+        DeclaredConstSource src;
+        src.m_declare = declare;
+        ConstSource low;
+        low.m_value = 0.9f;
+        matrix.add_source("src", &src);
+        matrix.add_source("low", &low);
+        auto add = matrix.get_smart_handle<float>("add");
+        auto rep = matrix.get_smart_handle<float>("rep");
+        auto contended = matrix.get_smart_handle<float>("contended");
+        matrix.add_routing({"src", "add", 0.5f});
+        ModulationRouting r_rep("src", "rep", 0.5f);
+        r_rep.m_combine_mode = CombineMode::Replace;
+        matrix.add_routing(r_rep);
+        ModulationRouting r_high("src", "contended", 0.5f);
+        r_high.m_combine_mode = CombineMode::Replace;
+        r_high.m_replace_priority = 2;
+        matrix.add_routing(r_high);
+        ModulationRouting r_low("low", "contended", 1.0f);
+        r_low.m_combine_mode = CombineMode::Replace;
+        r_low.m_replace_priority = 1;
+        matrix.add_routing(r_low);
+        matrix.prepare(k_sample_rate, k_block_size);
+
+        std::vector<float> out;
+        for (int block = 0; block < 5; ++block) {
+            src.m_ramp = block == 3;
+            src.m_steps = block == 1 || block == 4 ? std::vector<uint32_t>{17, 200, 201}
+                                                   : std::vector<uint32_t>{};
+            src.m_value = 0.2f + 0.1f * static_cast<float>(block);
+            matrix.process(k_block_size);
+            for (uint32_t i = 0; i < k_block_size; ++i) {
+                out.push_back(add.load(i));
+                out.push_back(rep.load(i));
+                out.push_back(contended.load(i));
+            }
+        }
+        return out;
+    };
+
+    const auto dense = run(false);
+    const auto piecewise = run(true);
+    ASSERT_EQ(dense.size(), piecewise.size());
+    for (size_t i = 0; i < dense.size(); ++i) { ASSERT_FLOAT_EQ(dense[i], piecewise[i]) << i; }
+}
+
+TEST(ModulationMatrix, ConstantSourceKeepsTargetSingleValued) {
+    thl::State state;
+    state.create("param", modulatable_float(0.0f));
+    ModulationMatrix matrix(state);
+    DeclaredConstSource src;
+    src.m_value = 0.4f;
+    matrix.add_source("src", &src);
+    auto handle = matrix.get_smart_handle<float>("param");
+    matrix.add_routing({"src", "param", 0.5f});
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    const auto* mb = mono_of(matrix.get_target("param"));
+    ASSERT_NE(mb, nullptr);
+    EXPECT_FALSE(mb->m_dense);
+    EXPECT_FLOAT_EQ(mb->m_uniform_additive, 0.2f);
+    EXPECT_FLOAT_EQ(handle.load(0), 0.2f);
+    EXPECT_FLOAT_EQ(handle.load(k_block_size - 1), 0.2f);
+}
+
+TEST(ModulationMatrix, BatchDefersRebuildUntilCommit) {
+    // Edits inside a batch stay invisible to the audio thread until commit,
+    // which then publishes the same schedule as applying them one by one.
+    auto build = [](ModulationMatrix& matrix, ConstSource& src) {
+        matrix.add_source("src", &src);
+        matrix.add_routing({"src", "a", 0.5f});
+        matrix.add_routing({"src", "b", 0.25f});
+    };
+
+    thl::State state;
+    state.create("a", modulatable_float(0.0f));
+    state.create("b", modulatable_float(0.0f));
+    ConstSource src;
+    src.m_value = 0.8f;
+
+    ModulationMatrix eager(state);
+    build(eager, src);
+
+    ModulationMatrix batched(state);
+    auto handle = batched.get_smart_handle<float>("a");
+    {
+        auto tx = batched.begin_batch();
+        build(batched, src);
+        {
+            auto nested = batched.begin_batch();
+            batched.remove_routing("src", "b");
+            batched.add_routing({"src", "b", 0.25f});
+        }
+        EXPECT_TRUE(batched.get_schedule().empty());
+        tx.commit();
+        tx.commit();  // idempotent
+    }
+    EXPECT_EQ(batched.get_schedule().size(), eager.get_schedule().size());
+    EXPECT_FALSE(batched.get_schedule().empty());
+
+    batched.prepare(k_sample_rate, k_block_size);
+    batched.process(k_block_size);
+    EXPECT_FLOAT_EQ(handle.load(0), 0.4f);
+}
+
+TEST(ModulationMatrix, RegisterReaderThreadClaimsTheCallingThreadsSlot) {
+    thl::State state;
+    state.create("freq", modulatable_float(0.0f));
+    ModulationMatrix matrix(state);
+    ConstSource src;
+    src.m_value = 0.5f;
+    matrix.add_source("src", &src);
+    auto handle = matrix.get_smart_handle<float>("freq");
+    matrix.add_routing({"src", "freq", 1.0f});
+    matrix.prepare(k_sample_rate, k_block_size);
+
+    // Constructing the matrix registers only the constructing thread
+    std::thread audio([&]() {
+        EXPECT_FALSE(thl::RCUReaderSlot::current().is_valid());
+        matrix.register_reader_thread();
+        EXPECT_TRUE(thl::RCUReaderSlot::current().is_valid());
+
+        matrix.process(k_block_size);
+        EXPECT_FLOAT_EQ(handle.load(0), 0.5f);
+    });
+    audio.join();
+}
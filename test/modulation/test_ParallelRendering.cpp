@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <tanh/core/threading/WorkerPool.h>
+#include <tanh/modulation/ModulationMatrix.h>
+#include <tanh/modulation/SmartHandle.h>
+#include <tanh/state/State.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestHelpers.h"
+
+using namespace thl::modulation;
+
+namespace {
+
+constexpr uint32_t k_num_voices = 8;
+
+// Per-voice phase accumulator whose increment is read from its own (possibly
+// modulated) per-voice rate parameter, so its output depends on upstream
+// routings having been applied before it renders. Records whether it ever
+// ran off the thread that called process().
+class RateVoiceSource : public ModulationSource {
+public:
+    RateVoiceSource(ModulationScope scope, std::string rate_key, bool concurrent)
+        : ModulationSource(scope, true)
+        , m_rate_key(std::move(rate_key))
+        , m_concurrent(concurrent) {}
+
+    void prepare(double /*sample_rate*/, size_t samples_per_block, uint32_t voice_count) override {
+        resize_buffers(samples_per_block, voice_count);
+        m_phase.assign(voice_count, 0.0f);
+    }
+
+    void process_voice(uint32_t voice, size_t num_samples, size_t offset = 0) override {
+        if (std::this_thread::get_id() != m_audio_thread) {
+            m_ran_off_audio_thread.store(true, std::memory_order_relaxed);
+        }
+        float* out = voice_output(voice);
+        for (size_t i = offset; i < offset + num_samples; ++i) {
+            const float rate = m_rate_key.empty()
+                                   ? 0.0f
+                                   : m_rate.load(static_cast<uint32_t>(i), voice);
+            m_phase[voice] += 0.0005f * static_cast<float>(voice + 1) + 0.002f * rate;
+            if (m_phase[voice] >= 1.0f) { m_phase[voice] -= 1.0f; }
+            out[i] = m_phase[voice];
+            if (i % 64 == 0) { record_voice_change_point(voice, static_cast<uint32_t>(i)); }
+        }
+    }
+
+    std::vector<std::string> parameter_keys() const override {
+        if (m_rate_key.empty()) { return {}; }
+        return {m_rate_key};
+    }
+
+    [[nodiscard]] bool supports_concurrent_render() const override { return m_concurrent; }
+
+    void set_rate_handle(SmartHandle<float> handle) { m_rate = std::move(handle); }
+
+    std::thread::id m_audio_thread = std::this_thread::get_id();
+    std::atomic<bool> m_ran_off_audio_thread{false};
+
+private:
+    std::string m_rate_key;
+    bool m_concurrent;
+    SmartHandle<float> m_rate;
+    std::vector<float> m_phase;
+};
+
+// One matrix with a dependency chain (lfo → a → b → sink), an independent
+// voice source (d → sink) and a serial-only source (e → sink2).
+struct Rig {
+    thl::State m_state;
+    ModulationMatrix m_matrix{m_state};
+    ModulationScope m_scope = m_matrix.register_scope("voice", k_num_voices);
+    TestLFOSource m_lfo;
+    std::unique_ptr<RateVoiceSource> m_a, m_b, m_d, m_e;
+    SmartHandle<float> m_sink, m_sink2;
+
+    Rig() {
+        m_state.create("a_rate", modulatable_float(0.2f, m_scope));
+        m_state.create("b_rate", modulatable_float(0.4f, m_scope));
+        m_state.create("sink", modulatable_float(0.0f, m_scope));
+        m_state.create("sink2", modulatable_float(0.0f, m_scope));
+
+        m_a = std::make_unique<RateVoiceSource>(m_scope, "a_rate", true);
+        m_b = std::make_unique<RateVoiceSource>(m_scope, "b_rate", true);
+        m_d = std::make_unique<RateVoiceSource>(m_scope, "", true);
+        m_e = std::make_unique<RateVoiceSource>(m_scope, "", false);
+        m_lfo.m_frequency = 3.0f;
+
+        m_matrix.add_source("lfo", &m_lfo);
+        m_matrix.add_source("a", m_a.get());
+        m_matrix.add_source("b", m_b.get());
+        m_matrix.add_source("d", m_d.get());
+        m_matrix.add_source("e", m_e.get());
+
+        m_a->set_rate_handle(m_matrix.get_smart_handle<float>("a_rate"));
+        m_b->set_rate_handle(m_matrix.get_smart_handle<float>("b_rate"));
+        m_sink = m_matrix.get_smart_handle<float>("sink");
+        m_sink2 = m_matrix.get_smart_handle<float>("sink2");
+
+        m_matrix.add_routing({"lfo", "a_rate", 0.5f});
+        m_matrix.add_routing({"a", "b_rate", 0.3f});
+        m_matrix.add_routing({"b", "sink", 0.25f});
+        m_matrix.add_routing({"d", "sink", 0.25f});
+        m_matrix.add_routing({"e", "sink2", 1.0f});
+
+        m_matrix.prepare(k_sample_rate, k_block_size);
+    }
+};
+
+}  // namespace
+
+TEST(ParallelRendering, MatchesSerialRenderingExactly) {
+    Rig serial;
+    Rig parallel;
+    thl::WorkerPool pool({.m_num_workers = 3, .m_pin_threads = false});
+    parallel.m_matrix.set_worker_pool(&pool);
+
+    for (int block = 0; block < 20; ++block) {
+        serial.m_matrix.process(k_block_size);
+        parallel.m_matrix.process(k_block_size);
+
+        for (uint32_t v = 0; v < k_num_voices; ++v) {
+            for (uint32_t i = 0; i < k_block_size; ++i) {
+                ASSERT_EQ(serial.m_sink.load(i, v), parallel.m_sink.load(i, v))
+                    << "block " << block << " voice " << v << " sample " << i;
+                ASSERT_EQ(serial.m_sink2.load(i, v), parallel.m_sink2.load(i, v))
+                    << "block " << block << " voice " << v << " sample " << i;
+            }
+        }
+    }
+}
+
+TEST(ParallelRendering, SerialOnlySourcesStayOnTheAudioThread) {
+    Rig rig;
+    thl::WorkerPool pool({.m_num_workers = 3, .m_pin_threads = false});
+    rig.m_matrix.set_worker_pool(&pool);
+
+    for (int block = 0; block < 50; ++block) { rig.m_matrix.process(k_block_size); }
+    EXPECT_FALSE(rig.m_e->m_ran_off_audio_thread.load());
+}
+
+TEST(ParallelRendering, DetachingThePoolRestoresTheSerialPath) {
+    Rig rig;
+    {
+        thl::WorkerPool pool({.m_num_workers = 2, .m_pin_threads = false});
+        rig.m_matrix.set_worker_pool(&pool);
+        rig.m_matrix.process(k_block_size);
+        rig.m_matrix.set_worker_pool(nullptr);
+    }
+
+    rig.m_a->m_ran_off_audio_thread.store(false);
+    rig.m_b->m_ran_off_audio_thread.store(false);
+    rig.m_d->m_ran_off_audio_thread.store(false);
+    for (int block = 0; block < 10; ++block) { rig.m_matrix.process(k_block_size); }
+    EXPECT_FALSE(rig.m_a->m_ran_off_audio_thread.load());
+    EXPECT_FALSE(rig.m_b->m_ran_off_audio_thread.load());
+    EXPECT_FALSE(rig.m_d->m_ran_off_audio_thread.load());
+}
+
+TEST(ParallelRendering, LFOsRenderConcurrentlyAndMatchSerial) {
+    // Independent LFOs feeding separate targets share one render wave.
+    struct LFORig {
+        thl::State m_state;
+        ModulationMatrix m_matrix{m_state};
+        TestLFOSource m_lfos[4];
+        SmartHandle<float> m_targets[4];
+
+        LFORig() {
+            for (int i = 0; i < 4; ++i) {
+                const std::string id = "lfo" + std::to_string(i);
+                const std::string target = "target" + std::to_string(i);
+                m_state.create(target, modulatable_float(0.0f));
+                m_lfos[i].m_frequency = 1.0f + static_cast<float>(i);
+                m_lfos[i].m_waveform = i % 2 == 0 ? LFOWaveform::Sine
+                                                  : LFOWaveform::SampleAndHold;
+                m_matrix.add_source(id, &m_lfos[i]);
+                m_matrix.add_routing({id, target, 1.0f});
+                m_targets[i] = m_matrix.get_smart_handle<float>(target);
+            }
+            m_matrix.prepare(k_sample_rate, k_block_size);
+        }
+    };
+
+    EXPECT_TRUE(TestLFOSource{}.supports_concurrent_render());
+
+    LFORig serial;
+    LFORig parallel;
+    thl::WorkerPool pool({.m_num_workers = 3, .m_pin_threads = false});
+    parallel.m_matrix.set_worker_pool(&pool);
+
+    for (int block = 0; block < 20; ++block) {
+        serial.m_matrix.process(k_block_size);
+        parallel.m_matrix.process(k_block_size);
+        for (int t = 0; t < 4; ++t) {
+            for (uint32_t i = 0; i < k_block_size; ++i) {
+                ASSERT_EQ(serial.m_targets[t].load(i), parallel.m_targets[t].load(i))
+                    << "block " << block << " target " << t << " sample " << i;
+            }
+        }
+    }
+}
@@ -9,13 +9,13 @@ TEST(ResolvedTarget, BuildChangePointsFromFlags) {
                    /*has_replace=*/false,
                    /*has_replace_priority=*/false);
 
-    mb.m_change_point_flags[5] = 1;
-    mb.m_change_point_flags[20] = 1;
-    mb.m_change_point_flags[50] = 1;
+    thl::dsp::utils::set_change_point(mb.m_change_point_bits.data(), 5);
+    thl::dsp::utils::set_change_point(mb.m_change_point_bits.data(), 20);
+    thl::dsp::utils::set_change_point(mb.m_change_point_bits.data(), 70);
 
     mb.build_change_points();
 
-    std::vector<uint32_t> expected = {5, 20, 50};
+    std::vector<uint32_t> expected = {5, 20, 70};
     EXPECT_EQ(mb.m_change_points, expected);
 }
 
@@ -25,13 +25,15 @@ TEST(ResolvedTarget, ClearPerBlock) {
                    /*has_replace=*/false,
                    /*has_replace_priority=*/false);
 
+    // Writers mark what they touch; clear_per_block only wipes dirty state.
+    mb.m_dirty = true;
     mb.m_additive_buffer[10] = 42.0f;
-    mb.m_change_point_flags[10] = 1;
+    thl::dsp::utils::set_change_point(mb.m_change_point_bits.data(), 10);
     mb.m_change_points.push_back(10);
 
     mb.clear_per_block();
 
     EXPECT_FLOAT_EQ(mb.m_additive_buffer[10], 0.0f);
-    EXPECT_EQ(mb.m_change_point_flags[10], 0);
+    EXPECT_FALSE(mb.change_point_mask().test(10));
     EXPECT_TRUE(mb.m_change_points.empty());
 }
@@ -4,6 +4,8 @@
 #include <tanh/state/State.h>
 
 #include <array>
+#include <span>
+#include <vector>
 
 #include "TestHelpers.h"
 
@@ -232,14 +234,14 @@ TEST(SmartHandle, LoadNormalized) {
 }
 
 // =============================================================================
-// change_point_flags / change_point_flags_voice / change_points_voice
+// change_point_mask / change_point_mask_voice / change_points_voice
 // accessors — introduced so mid-block readers (e.g. relay sources) can see
 // change points already stamped by Tarjan-earlier sources inside the same
 // block. The built list variants are only populated after all sources have
 // run, so they would be stale mid-block.
 // =============================================================================
 
-TEST(SmartHandle, ChangePointFlags_SetAtMonoChangePointOffsets) {
+TEST(SmartHandle, ChangePointMask_SetAtMonoChangePointOffsets) {
     thl::State state;
     state.create("freq", modulatable_float(0.5f));
     ModulationMatrix matrix(state);
@@ -254,13 +256,15 @@ TEST(SmartHandle, ChangePointFlags_SetAtMonoChangePointOffsets) {
     matrix.prepare(k_sample_rate, k_block_size);
     matrix.process(k_block_size);
 
-    const uint8_t* flags = handle.change_point_flags();
-    ASSERT_NE(flags, nullptr);
+    const auto flags = handle.change_point_mask();
+    ASSERT_FALSE(flags.empty());
+    EXPECT_EQ(flags.m_num_samples, k_block_size);
 
     // decimation=1 → every sample is a change point
     for (size_t i = 0; i < k_block_size; ++i) {
-        EXPECT_EQ(flags[i], 1) << "Expected flag set at sample " << i;
+        EXPECT_TRUE(flags.test(i)) << "Expected flag set at sample " << i;
     }
+    EXPECT_EQ(flags.count(), k_block_size);
 
     // And the flag bitmask should agree with the post-build list.
     const auto* list = handle.change_points();
@@ -268,7 +272,7 @@ TEST(SmartHandle, ChangePointFlags_SetAtMonoChangePointOffsets) {
     EXPECT_EQ(list->size(), k_block_size);
 }
 
-TEST(SmartHandle, ChangePointFlags_NullptrWhenNoMonoBuffer) {
+TEST(SmartHandle, ChangePointMask_EmptyWhenNoMonoBuffer) {
     thl::State state;
     ModulationMatrix matrix(state);
     const auto voice_scope = matrix.register_scope("voice", 2);
@@ -284,15 +288,15 @@ TEST(SmartHandle, ChangePointFlags_NullptrWhenNoMonoBuffer) {
     matrix.prepare(k_sample_rate, k_block_size);
     matrix.process(k_block_size);
 
-    EXPECT_EQ(handle.change_point_flags(), nullptr);
+    EXPECT_TRUE(handle.change_point_mask().empty());
 }
 
-TEST(SmartHandle, ChangePointFlags_NullptrOnUnattachedHandle) {
+TEST(SmartHandle, ChangePointMask_EmptyOnUnattachedHandle) {
     SmartHandle<float> handle;  // default-constructed, no target
-    EXPECT_EQ(handle.change_point_flags(), nullptr);
+    EXPECT_TRUE(handle.change_point_mask().empty());
 }
 
-TEST(SmartHandle, ChangePointFlagsVoice_SetAtVoiceChangePointOffsets) {
+TEST(SmartHandle, ChangePointMaskVoice_SetAtVoiceChangePointOffsets) {
     thl::State state;
     ModulationMatrix matrix(state);
     const auto voice_scope = matrix.register_scope("voice", 3);
@@ -311,16 +315,16 @@ TEST(SmartHandle, ChangePointFlagsVoice_SetAtVoiceChangePointOffsets) {
     matrix.process(k_block_size);
 
     for (uint32_t v = 0; v < 3; ++v) {
-        const uint8_t* flags = handle.change_point_flags_voice(v);
-        ASSERT_NE(flags, nullptr) << "voice " << v;
-        EXPECT_EQ(flags[0], 1) << "voice " << v << " expected change-point flag at sample 0";
+        const auto flags = handle.change_point_mask_voice(v);
+        ASSERT_FALSE(flags.empty()) << "voice " << v;
+        EXPECT_TRUE(flags.test(0)) << "voice " << v << " expected change-point flag at sample 0";
         for (size_t i = 1; i < k_block_size; ++i) {
-            EXPECT_EQ(flags[i], 0) << "voice " << v << " unexpected flag at sample " << i;
+            EXPECT_FALSE(flags.test(i)) << "voice " << v << " unexpected flag at sample " << i;
         }
     }
 }
 
-TEST(SmartHandle, ChangePointFlagsVoice_AgreesWithBuiltList) {
+TEST(SmartHandle, ChangePointMaskVoice_AgreesWithBuiltList) {
     thl::State state;
     ModulationMatrix matrix(state);
     const auto voice_scope = matrix.register_scope("voice", 2);
@@ -338,20 +342,18 @@ TEST(SmartHandle, ChangePointFlagsVoice_AgreesWithBuiltList) {
     // After build_change_points runs at end-of-block, the list must equal
     // the set-bit positions of the live flag bitmask.
     for (uint32_t v = 0; v < 2; ++v) {
-        const uint8_t* flags = handle.change_point_flags_voice(v);
+        const auto flags = handle.change_point_mask_voice(v);
         const auto* list = handle.change_points_voice(v);
-        ASSERT_NE(flags, nullptr);
+        ASSERT_FALSE(flags.empty());
         ASSERT_NE(list, nullptr);
 
         std::vector<uint32_t> from_flags;
-        for (size_t i = 0; i < k_block_size; ++i) {
-            if (flags[i]) { from_flags.push_back(static_cast<uint32_t>(i)); }
-        }
+        flags.for_each([&](uint32_t i) { from_flags.push_back(i); });
         EXPECT_EQ(from_flags, *list) << "voice " << v;
     }
 }
 
-TEST(SmartHandle, ChangePointFlagsVoice_NullptrWhenNoVoiceBuffer) {
+TEST(SmartHandle, ChangePointMaskVoice_EmptyWhenNoVoiceBuffer) {
     thl::State state;
     state.create("freq", modulatable_float(0.5f));
     ModulationMatrix matrix(state);
@@ -366,11 +368,11 @@ TEST(SmartHandle, ChangePointFlagsVoice_NullptrWhenNoVoiceBuffer) {
     matrix.prepare(k_sample_rate, k_block_size);
     matrix.process(k_block_size);
 
-    EXPECT_EQ(handle.change_point_flags_voice(0), nullptr);
+    EXPECT_TRUE(handle.change_point_mask_voice(0).empty());
     EXPECT_EQ(handle.change_points_voice(0), nullptr);
 }
 
-TEST(SmartHandle, ChangePointFlagsVoice_NullptrForOutOfRangeVoice) {
+TEST(SmartHandle, ChangePointMaskVoice_EmptyForOutOfRangeVoice) {
     thl::State state;
     ModulationMatrix matrix(state);
     const auto voice_scope = matrix.register_scope("voice", 2);
@@ -385,17 +387,17 @@ TEST(SmartHandle, ChangePointFlagsVoice_NullptrForOutOfRangeVoice) {
     matrix.prepare(k_sample_rate, k_block_size);
     matrix.process(k_block_size);
 
-    // In-range accessor succeeds; out-of-range returns nullptr rather than
+    // In-range accessor succeeds; out-of-range returns an empty mask rather than
     // indexing into the per-voice storage.
-    EXPECT_NE(handle.change_point_flags_voice(0), nullptr);
-    EXPECT_NE(handle.change_point_flags_voice(1), nullptr);
-    EXPECT_EQ(handle.change_point_flags_voice(2), nullptr);
+    EXPECT_FALSE(handle.change_point_mask_voice(0).empty());
+    EXPECT_FALSE(handle.change_point_mask_voice(1).empty());
+    EXPECT_TRUE(handle.change_point_mask_voice(2).empty());
     EXPECT_EQ(handle.change_points_voice(2), nullptr);
 }
 
-TEST(SmartHandle, ChangePointFlagsVoice_NullptrOnUnattachedHandle) {
+TEST(SmartHandle, ChangePointMaskVoice_EmptyOnUnattachedHandle) {
     SmartHandle<float> handle;
-    EXPECT_EQ(handle.change_point_flags_voice(0), nullptr);
+    EXPECT_TRUE(handle.change_point_mask_voice(0).empty());
     EXPECT_EQ(handle.change_points_voice(0), nullptr);
 }
 
@@ -440,6 +442,48 @@ TEST(SmartHandle, CollectChangePoints_FallsThroughMonoForVoiceScope) {
     }
 }
 
+// collect_change_point_mask ORs the live bitsets of several targets; its
+// set bits must match the sorted list from collect_change_points.
+TEST(SmartHandle, CollectChangePointMask_MatchesCollectedList) {
+    thl::State state;
+    state.create("a", modulatable_float(0.5f));
+    state.create("b", modulatable_float(0.5f));
+    ModulationMatrix matrix(state);
+
+    TestLFOSource fast, slow;
+    fast.m_frequency = 10.0f;
+    fast.m_decimation = 48;
+    slow.m_frequency = 1.0f;
+    slow.m_decimation = 100;
+    matrix.add_source("fast", &fast);
+    matrix.add_source("slow", &slow);
+    std::array<SmartHandle<float>, 2> handles{matrix.get_smart_handle<float>("a"),
+                                              matrix.get_smart_handle<float>("b")};
+    matrix.add_routing({"fast", "a", 1.0f});
+    matrix.add_routing({"slow", "b", 1.0f});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    std::vector<uint32_t> list;
+    list.reserve(k_block_size);
+    collect_change_points(std::span<const SmartHandle<float>>(handles), list);
+
+    std::vector<uint64_t> words(thl::dsp::utils::change_point_words(k_block_size));
+    const auto mask = collect_change_point_mask(
+        std::span<const SmartHandle<float>>(handles), std::span<uint64_t>(words));
+    EXPECT_EQ(mask.m_num_samples, k_block_size);
+
+    std::vector<uint32_t> from_mask;
+    mask.for_each([&](uint32_t i) { from_mask.push_back(i); });
+    EXPECT_EQ(from_mask, list);
+    EXPECT_EQ(mask.count(), list.size());
+
+    // Union of both targets: every point of either list is present.
+    for (const uint32_t cp : *handles[0].change_points()) { EXPECT_TRUE(mask.test(cp)); }
+    for (const uint32_t cp : *handles[1].change_points()) { EXPECT_TRUE(mask.test(cp)); }
+}
+
 TEST(SmartHandle, DisplayFormattingViaSmartHandle) {
     thl::State state;
     state.create("freq",
@@ -457,3 +501,201 @@ TEST(SmartHandle, DisplayFormattingViaSmartHandle) {
     ASSERT_TRUE(handle.def().m_value_to_text);
     EXPECT_EQ("440.0", handle.def().m_value_to_text(handle.load()));
 }
+
+// =============================================================================
+// load_block / load_block_normalized — must agree sample-for-sample with the
+// per-sample load() / load_normalized() paths.
+// =============================================================================
+
+namespace {
+
+// Global source that is active only on every other 16-sample run, so Replace
+// routings leave the target at its base value in between.
+class GatedTestSource : public ModulationSource {
+public:
+    GatedTestSource() : ModulationSource(k_global_scope, false) {}
+
+    void prepare(double /*sample_rate*/, size_t samples_per_block, uint32_t voice_count) override {
+        resize_buffers(samples_per_block, voice_count);
+    }
+
+    void process(size_t num_samples, size_t offset = 0) override {
+        for (size_t i = offset; i < offset + num_samples; ++i) {
+            m_output_buffer[i] = 0.25f + 0.001f * static_cast<float>(i);
+            if ((i / 16) % 2 == 0) {
+                set_output_active(static_cast<uint32_t>(i));
+            } else {
+                get_output_active()[i] = 0;
+            }
+        }
+        record_change_point(static_cast<uint32_t>(offset));
+    }
+};
+
+template <typename T>
+void expect_block_matches_load(const SmartHandle<T>& handle,
+                               uint32_t voice_index = 0,
+                               uint32_t offset = 0,
+                               size_t num_samples = k_block_size) {
+    std::vector<T> block(num_samples);
+    handle.load_block(std::span<T>(block), voice_index, offset);
+    std::vector<float> normalized(num_samples);
+    handle.load_block_normalized(std::span<float>(normalized), voice_index, offset);
+
+    for (size_t i = 0; i < num_samples; ++i) {
+        const auto at = offset + static_cast<uint32_t>(i);
+        EXPECT_EQ(block[i], handle.load(at, voice_index)) << "sample " << at;
+        EXPECT_FLOAT_EQ(normalized[i], handle.load_normalized(at, voice_index)) << "sample " << at;
+    }
+}
+
+}  // namespace
+
+TEST(SmartHandleBlock, UnmodulatedFillsBase) {
+    thl::State state;
+    state.create("freq", modulatable_float(0.3f));
+    ModulationMatrix matrix(state);
+    auto handle = matrix.get_smart_handle<float>("freq");
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    std::array<float, 64> out{};
+    handle.load_block(std::span<float>(out));
+    for (const float v : out) { EXPECT_EQ(v, 0.3f); }
+}
+
+TEST(SmartHandleBlock, UnmodulatedIntMatchesLoad) {
+    thl::State state;
+    state.create(
+        "choice",
+        thl::ParameterDefinition::make_int("Choice", thl::Range::discrete(0, 10), 7).modulatable(true));
+    ModulationMatrix matrix(state);
+    auto handle = matrix.get_smart_handle<int>("choice");
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    expect_block_matches_load(handle);
+}
+
+TEST(SmartHandleBlock, MonoAdditiveMatchesLoad) {
+    thl::State state;
+    state.create("freq", modulatable_float(0.5f));
+    ModulationMatrix matrix(state);
+
+    TestLFOSource lfo;
+    lfo.m_frequency = 50.0f;
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<float>("freq");
+    matrix.add_routing({"lfo", "freq", 0.75f});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    expect_block_matches_load(handle);
+    // Sub-block reads, including a length that is not a SIMD multiple.
+    expect_block_matches_load(handle, 0, 37, 101);
+}
+
+TEST(SmartHandleBlock, NormalizedBufferPeriodicMatchesLoad) {
+    auto range = thl::Range::power_law(0.0f, 360.0f, 2.0f);
+    range.m_periodic = true;
+
+    thl::State state;
+    state.create("phase",
+                 thl::ParameterDefinition::make_float("Phase", range, 350.0f).modulatable(true));
+    ModulationMatrix matrix(state);
+
+    TestLFOSource lfo;
+    lfo.m_frequency = 20.0f;
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<float>("phase");
+    matrix.add_routing({"lfo", "phase", 0.4f, 0, DepthMode::Normalized});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    ASSERT_TRUE(handle.target()->m_uses_normalized_buffer);
+    expect_block_matches_load(handle);
+}
+
+TEST(SmartHandleBlock, NormalizedBufferClampedMatchesLoad) {
+    thl::State state;
+    state.create("cutoff",
+                 thl::ParameterDefinition::make_float(
+                     "Cutoff", thl::Range::power_law(20.0f, 20000.0f, 3.0f), 15000.0f)
+                     .modulatable(true));
+    ModulationMatrix matrix(state);
+
+    TestLFOSource lfo;
+    lfo.m_frequency = 20.0f;
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<float>("cutoff");
+    matrix.add_routing({"lfo", "cutoff", 0.8f, 0, DepthMode::Normalized});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    expect_block_matches_load(handle);
+}
+
+TEST(SmartHandleBlock, PartialReplaceWithAdditiveMatchesLoad) {
+    thl::State state;
+    state.create("freq", modulatable_float(0.5f));
+    ModulationMatrix matrix(state);
+
+    GatedTestSource gate;
+    TestLFOSource lfo;
+    lfo.m_frequency = 30.0f;
+    matrix.add_source("gate", &gate);
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<float>("freq");
+    matrix.add_routing({"gate", "freq", 1.0f, 0, DepthMode::Absolute, CombineMode::Replace});
+    matrix.add_routing({"lfo", "freq", 0.1f});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    // Both paths of the select must be exercised.
+    const uint8_t* active = mono_of(handle.target())->m_replace_active.data();
+    ASSERT_EQ(active[0], 1);
+    ASSERT_EQ(active[16], 0);
+    expect_block_matches_load(handle);
+    expect_block_matches_load(handle, 0, 5, 60);
+}
+
+TEST(SmartHandleBlock, VoiceBuffersMatchLoad) {
+    thl::State state;
+    ModulationMatrix matrix(state);
+    const auto voice_scope = matrix.register_scope("voice", 3);
+    state.create("freq", modulatable_float(0.5f, voice_scope));
+
+    PolyTestSource poly(voice_scope);
+    poly.m_voice_values = {0.1f, -0.2f, 0.3f};
+    matrix.add_source("poly", &poly);
+    auto handle = matrix.get_smart_handle<float>("freq");
+    matrix.add_routing({"poly", "freq", 1.0f});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    for (uint32_t v = 0; v < 3; ++v) { expect_block_matches_load(handle, v); }
+}
+
+TEST(SmartHandleBlock, IntTargetMatchesLoad) {
+    thl::State state;
+    state.create(
+        "choice",
+        thl::ParameterDefinition::make_int("Choice", thl::Range::discrete(0, 10), 5).modulatable(true));
+    ModulationMatrix matrix(state);
+
+    TestLFOSource lfo;
+    lfo.m_frequency = 40.0f;
+    matrix.add_source("lfo", &lfo);
+    auto handle = matrix.get_smart_handle<int>("choice");
+    matrix.add_routing({"lfo", "choice", 3.0f, 0, DepthMode::Absolute});
+
+    matrix.prepare(k_sample_rate, k_block_size);
+    matrix.process(k_block_size);
+
+    expect_block_matches_load(handle);
+}
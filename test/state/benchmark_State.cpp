@@ -3,10 +3,13 @@
 #include <tanh/core/Numbers.h>
 
 #include <atomic>
+#include <memory>
+#include <nlohmann/json.hpp>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "tanh/state/PresetMorpher.h"
 #include "tanh/state/State.h"
 
 using namespace thl;
@@ -103,6 +106,25 @@ static void bm_set_double_with_listener_notify(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_set_double_with_listener_notify);
 
+// Same write with NotificationMode::Deferred: the writer only marks the
+// parameter dirty; one dispatch_pending() per 64 writes delivers the callback
+static void bm_set_double_with_deferred_notify(benchmark::State& bm_state) {
+    State state;
+    state.create("param", 0.0);
+    int count = 0;
+    CallbackListener cb([&](const Parameter&) { benchmark::DoNotOptimize(++count); });
+    state.add_listener(&cb);
+    state.set_notification_mode(State::NotificationMode::Deferred);
+    double v = 0.0;
+    int writes = 0;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        state.set("param", v);
+        v += 0.001;
+        if (++writes % 64 == 0) { state.dispatch_pending(); }
+    }
+}
+BENCHMARK(bm_set_double_with_deferred_notify);
+
 // =============================================================================
 // Getter Benchmarks
 // =============================================================================
@@ -225,6 +247,79 @@ static void bm_get_from_root(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_get_from_root);
 
+// =============================================================================
+// String vs ParamKey Lookup Benchmarks
+// =============================================================================
+
+// Lookup cost in a realistically sized State: 1000 parameters spread over
+// 100 groups, read by path string, by runtime-hashed key, or by a key hashed
+// at compile time
+static std::unique_ptr<State> make_lookup_state() {
+    auto state = std::make_unique<State>();
+    auto tx = state->begin_batch();
+    for (int i = 0; i < 1000; ++i) {
+        state->create("group_" + std::to_string(i % 100) + ".param_" + std::to_string(i), 0.5);
+    }
+    state->create("synth.filter.cutoff", 1000.0f);
+    tx.commit();
+    return state;
+}
+
+static void bm_lookup_get_by_path(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(state->get<float>("synth.filter.cutoff"));
+    }
+}
+BENCHMARK(bm_lookup_get_by_path);
+
+static void bm_lookup_get_from_root_string(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(state->get_from_root<float>("synth.filter.cutoff"));
+    }
+}
+BENCHMARK(bm_lookup_get_from_root_string);
+
+static void bm_lookup_get_from_root_runtime_key(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    const std::string path = "synth.filter.cutoff";
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(state->get_from_root<float>(ParamKey::from_runtime(path)));
+    }
+}
+BENCHMARK(bm_lookup_get_from_root_runtime_key);
+
+static void bm_lookup_get_from_root_param_key(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    constexpr ParamKey k_cutoff("synth.filter.cutoff");
+    for ([[maybe_unused]] auto _ : bm_state) {
+        benchmark::DoNotOptimize(state->get_from_root<float>(k_cutoff));
+    }
+}
+BENCHMARK(bm_lookup_get_from_root_param_key);
+
+static void bm_lookup_set_in_root_string(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    float v = 0.0f;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        state->set_in_root("synth.filter.cutoff", v);
+        v += 0.001f;
+    }
+}
+BENCHMARK(bm_lookup_set_in_root_string);
+
+static void bm_lookup_set_in_root_param_key(benchmark::State& bm_state) {
+    auto state = make_lookup_state();
+    constexpr ParamKey k_cutoff("synth.filter.cutoff");
+    float v = 0.0f;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        state->set_in_root(k_cutoff, v);
+        v += 0.001f;
+    }
+}
+BENCHMARK(bm_lookup_set_in_root_param_key);
+
 // =============================================================================
 // Parameter Creation Benchmarks
 // =============================================================================
@@ -255,6 +350,41 @@ static void bm_create_hierarchical_parameter(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_create_hierarchical_parameter);
 
+// Startup cost of a large preset: N parameters spread over 100 groups, all
+// created into one fresh State — one by one, or inside a single begin_batch().
+static void bm_create_many_parameters(benchmark::State& bm_state) {
+    const auto count = static_cast<int>(bm_state.range(0));
+    const bool batched = bm_state.range(1) != 0;
+    std::vector<std::string> keys;
+    keys.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        keys.push_back("group_" + std::to_string(i % 100) + ".param_" + std::to_string(i));
+    }
+
+    for ([[maybe_unused]] auto _ : bm_state) {
+        bm_state.PauseTiming();
+        auto state = std::make_unique<State>();
+        bm_state.ResumeTiming();
+
+        if (batched) {
+            auto tx = state->begin_batch();
+            for (const auto& key : keys) { state->create(key, 0.5); }
+            tx.commit();
+        } else {
+            for (const auto& key : keys) { state->create(key, 0.5); }
+        }
+
+        bm_state.PauseTiming();
+        state.reset();
+        bm_state.ResumeTiming();
+    }
+    bm_state.SetItemsProcessed(static_cast<int64_t>(bm_state.iterations()) * count);
+}
+BENCHMARK(bm_create_many_parameters)
+    ->ArgsProduct({{1000, 10000}, {0, 1}})
+    ->ArgNames({"count", "batched"})
+    ->Unit(benchmark::kMillisecond);
+
 // =============================================================================
 // Parameter Type Query Benchmarks
 // =============================================================================
@@ -481,6 +611,46 @@ static void bm_handle_vs_get_from_root(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_handle_vs_get_from_root);
 
+// One block's parameter reads: load N float parameters through handles.
+// At N=200 both the handles and the values sit in L1, and the time moves with
+// heap placement by more than the layout changes it: compare runs with
+// --benchmark_repetitions and a few GLIBC_TUNABLES=glibc.malloc.top_pad values.
+static void bm_block_read_handles(benchmark::State& bm_state) {
+    const auto num_parameters = bm_state.range(0);
+    State state;
+    std::vector<ParameterHandle<float>> handles;
+    for (int64_t i = 0; i < num_parameters; ++i) {
+        const std::string key = "block.param" + std::to_string(i);
+        state.create(key, static_cast<float>(i));
+        handles.push_back(state.get_handle<float>(key));
+    }
+    for ([[maybe_unused]] auto _ : bm_state) {
+        float sum = 0.0f;
+        for (const auto& handle : handles) { sum += handle.load(); }
+        benchmark::DoNotOptimize(sum);
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * num_parameters);
+    bm_state.counters["record_bytes"] = static_cast<double>(sizeof(ParameterRecord));
+    bm_state.counters["value_store_bytes"] = static_cast<double>(state.value_store_bytes());
+}
+BENCHMARK(bm_block_read_handles)->Arg(200)->Arg(2000)->Arg(20000);
+
+// The same reads as one bulk sweep of the dense value store
+static void bm_block_read_snapshot_values(benchmark::State& bm_state) {
+    const auto num_parameters = bm_state.range(0);
+    State state;
+    for (int64_t i = 0; i < num_parameters; ++i) {
+        state.create("block.param" + std::to_string(i), static_cast<float>(i));
+    }
+    std::vector<float> values(static_cast<size_t>(num_parameters));
+    for ([[maybe_unused]] auto _ : bm_state) {
+        state.snapshot_values(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * num_parameters);
+}
+BENCHMARK(bm_block_read_snapshot_values)->Arg(200)->Arg(2000)->Arg(20000);
+
 static void bm_handle_concurrent_loads(benchmark::State& bm_state) {
     const auto num_threads = bm_state.range(0);
     State state;
@@ -525,6 +695,112 @@ static void bm_to_json(benchmark::State& bm_state) {
 }
 BENCHMARK(bm_to_json);
 
+// =============================================================================
+// Preset Snapshot Benchmarks (binary vs JSON)
+// =============================================================================
+
+static void create_preset_parameters(State& state, int64_t num_parameters) {
+    for (int64_t i = 0; i < num_parameters; ++i) {
+        state.create("group" + std::to_string(i / 100) + ".param" + std::to_string(i % 100),
+                     static_cast<float>(i) * 0.001f);
+    }
+}
+
+// Nested {"group": {"param": value}} document, as from_json() expects
+static nlohmann::json make_preset_json(int64_t num_parameters) {
+    nlohmann::json json;
+    for (int64_t i = 0; i < num_parameters; ++i) {
+        json["group" + std::to_string(i / 100)]["param" + std::to_string(i % 100)] =
+            static_cast<float>(i) * 0.002f;
+    }
+    return json;
+}
+
+static void bm_snapshot_binary_serialize(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    size_t bytes = 0;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        auto blob = state.to_binary();
+        bytes = blob.size();
+        benchmark::DoNotOptimize(blob.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+    bm_state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(bm_snapshot_binary_serialize)->Arg(1000)->Arg(10000);
+
+static void bm_snapshot_json_serialize(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    size_t bytes = 0;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        auto text = state.to_json(false).dump();
+        bytes = text.size();
+        benchmark::DoNotOptimize(text.data());
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+    bm_state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(bm_snapshot_json_serialize)->Arg(1000)->Arg(10000);
+
+static void bm_snapshot_binary_deserialize(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    const auto blob = state.to_binary();
+    for ([[maybe_unused]] auto _ : bm_state) { state.from_binary(blob); }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+}
+BENCHMARK(bm_snapshot_binary_deserialize)->Arg(1000)->Arg(10000);
+
+static void bm_snapshot_json_deserialize(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    const std::string text = make_preset_json(bm_state.range(0)).dump();
+    for ([[maybe_unused]] auto _ : bm_state) { state.from_json(nlohmann::json::parse(text)); }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+}
+BENCHMARK(bm_snapshot_json_deserialize)->Arg(1000)->Arg(10000);
+
+// =============================================================================
+// Preset Morph Benchmarks
+// =============================================================================
+
+static void bm_preset_morph(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    const StateSnapshot a = state.capture_snapshot();
+    StateSnapshot b = a;
+    for (uint32_t id = 0; id < b.size(); ++id) { b.set_value(id, b.value(id) + 1.0); }
+
+    PresetMorpher morpher(state);
+    morpher.prepare();
+    float t = 0.0f;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        morpher.morph(a, b, t);
+        t = t >= 1.0f ? 0.0f : t + 0.01f;
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+}
+BENCHMARK(bm_preset_morph)->Arg(1000)->Arg(10000);
+
+// Baseline: the same preset change as one set() per parameter
+static void bm_preset_set_each(benchmark::State& bm_state) {
+    State state;
+    create_preset_parameters(state, bm_state.range(0));
+    std::vector<std::string> paths;
+    for (int64_t i = 0; i < bm_state.range(0); ++i) {
+        paths.push_back("group" + std::to_string(i / 100) + ".param" + std::to_string(i % 100));
+    }
+    float v = 0.0f;
+    for ([[maybe_unused]] auto _ : bm_state) {
+        for (const auto& path : paths) { state.set(path, v); }
+        v += 0.01f;
+    }
+    bm_state.SetItemsProcessed(bm_state.iterations() * bm_state.range(0));
+}
+BENCHMARK(bm_preset_set_each)->Arg(1000)->Arg(10000);
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -275,6 +276,57 @@ TEST(StateTests, DuplicateIdThrows) {
         DuplicateParameterIdException);
 }
 
+TEST(StateTests, BatchedParametersResolveBeforeAndAfterCommit) {
+    State state;
+    state.create("early", 1.0);
+
+    {
+        auto tx = state.begin_batch();
+        state.create("synth.freq",
+                     ParameterDefinition::make_float("Frequency", Range::linear(20.0f, 20000.0f), 440.0f)
+                         .param_id(7));
+        state.create("synth.gain", 0.5);
+
+        // Reachable by key and ID before the indices are published
+        EXPECT_FLOAT_EQ(440.0f, state.get<float>("synth.freq"));
+        EXPECT_FLOAT_EQ(440.0f, state.get_handle_by_id<float>(7).load());
+        EXPECT_THROW(state.create("synth.gain", 0.1), ParameterAlreadyExistsException);
+        EXPECT_THROW(state.create("other",
+                                  ParameterDefinition::make_float("O", Range(), 0.0f).param_id(7)),
+                     DuplicateParameterIdException);
+        tx.commit();
+    }
+
+    EXPECT_FLOAT_EQ(440.0f, state.get_handle_by_id<float>(7).load());
+    EXPECT_DOUBLE_EQ(0.5, state.get<double>("synth.gain"));
+    EXPECT_EQ(1u, state.get_group("synth")->get_parameters().count("synth.freq"));
+    EXPECT_THROW(state.get_handle_by_id<float>(999), StateKeyNotFoundException);
+}
+
+TEST(StateTests, BatchedParametersArePrivateToTheBatchThread) {
+    State state;
+    auto tx = state.begin_batch();
+    state.create("synth.freq",
+                 ParameterDefinition::make_float("Frequency", Range(), 440.0f).param_id(3));
+
+    // Other threads (the audio thread among them) miss uncommitted records
+    // instead of falling back to the storage mutex
+    std::thread reader([&state]() {
+        EXPECT_THROW(state.get<float>("synth.freq"), StateKeyNotFoundException);
+        EXPECT_THROW(state.get_handle_by_id<float>(3), StateKeyNotFoundException);
+        EXPECT_THROW(state.get_from_root<float>(ParamKey::from_runtime("synth.freq")),
+                     StateKeyNotFoundException);
+    });
+    reader.join();
+    tx.commit();
+
+    std::thread after_commit([&state]() {
+        EXPECT_FLOAT_EQ(440.0f, state.get<float>("synth.freq"));
+        EXPECT_FLOAT_EQ(440.0f, state.get_handle_by_id<float>(3).load());
+    });
+    after_commit.join();
+}
+
 TEST(StateTests, AutoIdAssignment) {
     State state;
 
@@ -589,3 +641,55 @@ TEST(StateTests, GetHandleFromSubgroupThrowsOnMissing) {
 
     EXPECT_THROW(group->get_handle<float>("nonexistent"), StateKeyNotFoundException);
 }
+
+// =============================================================================
+// Dense value store tests
+// =============================================================================
+
+TEST(StateTests, SnapshotValuesReadsEveryNumericTypeById) {
+    State state;
+    state.create("f", 0.5f);
+    state.create("d", 2.5);
+    state.create("i", 7);
+    state.create("b", true);
+    state.create("s", std::string("3.5"));
+
+    std::vector<float> values(6, -1.0f);
+    state.snapshot_values(values);
+
+    EXPECT_FLOAT_EQ(0.5f, values[0]);
+    EXPECT_FLOAT_EQ(2.5f, values[1]);
+    EXPECT_FLOAT_EQ(7.0f, values[2]);
+    EXPECT_FLOAT_EQ(1.0f, values[3]);
+    EXPECT_FLOAT_EQ(3.5f, values[4]);
+    EXPECT_FLOAT_EQ(-1.0f, values[5]);  // no parameter with this ID
+
+    // Handle writes land in the same slots
+    state.get_handle<float>("f").store(0.25f);
+    std::vector<float> short_values(2, 0.0f);
+    state.snapshot_values(short_values);
+    EXPECT_FLOAT_EQ(0.25f, short_values[0]);
+    EXPECT_FLOAT_EQ(2.5f, short_values[1]);
+}
+
+TEST(StateTests, SnapshotValuesSkipsClearedGroupAndReusesSlots) {
+    State state;
+    StateGroup* group = state.create_group("voice");
+    group->create("gain", 0.5f);
+    state.create("master", 0.75f);
+
+    group->clear();
+    state.create("pan", 0.1f);  // takes over the freed float slot
+
+    std::vector<float> values(3, -1.0f);
+    state.snapshot_values(values);
+    EXPECT_FLOAT_EQ(-1.0f, values[0]);
+    EXPECT_FLOAT_EQ(0.75f, values[1]);
+    EXPECT_FLOAT_EQ(0.1f, values[2]);
+
+    auto master = state.get_handle<float>("master");
+    auto pan = state.get_handle<float>("pan");
+    pan.store(0.2f);
+    EXPECT_FLOAT_EQ(0.75f, master.load());
+    EXPECT_FLOAT_EQ(0.2f, state.get<float>("pan"));
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "TestHelpers.h"
+#include "tanh/state/PresetMorpher.h"
+#include "tanh/state/State.h"
+#include "tanh/state/StateSnapshot.h"
+
+using namespace thl;
+
+// =============================================================================
+// Snapshot and preset morphing tests
+// =============================================================================
+
+TEST(PresetMorpherTests, CaptureSnapshotIndexesNumericValuesById) {
+    State state;
+    state.create("osc.level", 0.5f);
+    state.create("osc.detune", 0.25);
+    state.create("osc.octave", -1);
+    state.create("osc.on", true);
+    state.create("osc.name", std::string("saw"));
+
+    const StateSnapshot snapshot = state.capture_snapshot();
+
+    EXPECT_EQ(4u, snapshot.size());
+    EXPECT_FLOAT_EQ(0.5f, static_cast<float>(snapshot.value(0)));
+    EXPECT_DOUBLE_EQ(0.25, snapshot.value(1));
+    EXPECT_DOUBLE_EQ(-1.0, snapshot.value(2));
+    EXPECT_DOUBLE_EQ(1.0, snapshot.value(3));
+    EXPECT_FALSE(snapshot.contains(4));  // string parameter
+    EXPECT_TRUE(std::isnan(snapshot.value(100)));
+}
+
+TEST(PresetMorpherTests, MorphInterpolatesEveryType) {
+    State state;
+    state.create("f", 0.0f);
+    state.create("d", 0.0);
+    state.create("i", 0);
+    state.create("b", false);
+    const StateSnapshot a = state.capture_snapshot();
+
+    state.set("f", 1.0f);
+    state.set("d", 10.0);
+    state.set("i", 10);
+    state.set("b", true);
+    const StateSnapshot b = state.capture_snapshot();
+
+    PresetMorpher morpher(state);
+    morpher.prepare();
+    EXPECT_EQ(4u, morpher.num_parameters());
+
+    morpher.morph(a, b, 0.25f);
+    EXPECT_FLOAT_EQ(0.25f, state.get<float>("f"));
+    EXPECT_DOUBLE_EQ(2.5, state.get<double>("d"));
+    EXPECT_EQ(3, state.get<int>("i"));  // 2.5 rounds away from zero
+    EXPECT_FALSE(state.get<bool>("b"));
+
+    morpher.morph(a, b, 0.5f);
+    EXPECT_TRUE(state.get<bool>("b"));
+
+    morpher.apply(a);
+    EXPECT_FLOAT_EQ(0.0f, state.get<float>("f"));
+    EXPECT_EQ(0, state.get<int>("i"));
+    EXPECT_FALSE(state.get<bool>("b"));
+}
+
+TEST(PresetMorpherTests, WeightedMorphAndMissingValues) {
+    State state;
+    state.create("x", 0.0f);
+    state.create("y", 5.0f);
+
+    StateSnapshot a;
+    a.set_value(0, 0.0);
+    a.set_value(1, 1.0);
+    StateSnapshot b;
+    b.set_value(0, 3.0);
+    StateSnapshot c;
+    c.set_value(0, 6.0);
+    c.set_value(1, 2.0);
+
+    PresetMorpher morpher(state);
+    morpher.prepare();
+
+    const std::array<const StateSnapshot*, 3> snapshots = {&a, &b, &c};
+    const std::array<float, 3> weights = {1.0f, 1.0f, 2.0f};
+    morpher.morph(snapshots, weights);
+
+    // (0 * 1 + 3 * 1 + 6 * 2) / 4; y is missing from b, so it keeps its value
+    EXPECT_FLOAT_EQ(3.75f, state.get<float>("x"));
+    EXPECT_FLOAT_EQ(5.0f, state.get<float>("y"));
+
+    const std::array<float, 3> zero = {0.0f, 0.0f, 0.0f};
+    morpher.morph(snapshots, zero);
+    EXPECT_FLOAT_EQ(3.75f, state.get<float>("x"));
+}
+
+TEST(PresetMorpherTests, WritesAreSilentUnlessDeferred) {
+    State state;
+    state.create("a", 0.0f);
+    state.create("b", 0.0f);
+    const StateSnapshot from = state.capture_snapshot();
+    StateSnapshot to = from;
+    to.set_value(0, 1.0);
+
+    TestParameterListener listener;
+    state.add_listener(&listener);
+
+    PresetMorpher morpher(state);
+    morpher.prepare();
+    morpher.morph(from, to, 0.5f);
+    EXPECT_FLOAT_EQ(0.5f, state.get<float>("a"));
+    EXPECT_EQ(0, listener.m_notification_count);
+
+    // Deferred: one pending notification per changed parameter, however
+    // many times it was written
+    state.set_notification_mode(State::NotificationMode::Deferred);
+    morpher.morph(from, to, 0.75f);
+    morpher.morph(from, to, 1.0f);
+    EXPECT_EQ(1u, state.dispatch_pending());
+    EXPECT_EQ(1, listener.m_notification_count);
+    EXPECT_EQ("a", listener.m_last_path);
+
+    // Unchanged values mark nothing
+    morpher.apply(to);
+    EXPECT_EQ(0u, state.dispatch_pending());
+}
+
+TEST(PresetMorpherTests, RemovingParametersMakesTheBindingStale) {
+    State state;
+    state.create("osc.level", 0.5f);
+    state.create("fx.mix", 0.25f);
+
+    PresetMorpher morpher(state);
+    morpher.prepare();
+    EXPECT_FALSE(morpher.is_stale());
+
+    // Creating parameters leaves existing records in place
+    state.create("fx.time", 1.0f);
+    EXPECT_FALSE(morpher.is_stale());
+
+    const StateSnapshot before = state.capture_snapshot();
+    state.get_group("fx")->clear();
+    EXPECT_TRUE(morpher.is_stale());
+
+    // A stale binding writes nothing, in every build: the freed value slot
+    // now belongs to "fx.new"
+    state.create("fx.new", 0.75f);
+    EXPECT_FALSE(morpher.apply(before));
+    EXPECT_FALSE(morpher.morph(before, before, 0.5f));
+    EXPECT_FLOAT_EQ(0.75f, state.get<float>("fx.new"));
+    morpher.prepare();
+    EXPECT_FALSE(morpher.is_stale());
+    EXPECT_EQ(2u, morpher.num_parameters());
+    EXPECT_TRUE(morpher.apply(before));
+
+    state.clear();
+    EXPECT_TRUE(morpher.is_stale());
+    morpher.prepare();
+    EXPECT_EQ(0u, morpher.num_parameters());
+}
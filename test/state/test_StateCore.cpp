@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <tanh/core/Numbers.h>
 
+#include <string>
+#include <vector>
+
 #include "tanh/state/Exceptions.h"
 #include "tanh/state/State.h"
 
@@ -484,3 +487,87 @@ TEST(StateTests, GetParametersEdgeCases) {
                                                // parameter
     EXPECT_TRUE(empty_parent_params.find("empty_parent.child.param") != empty_parent_params.end());
 }
+
+// =============================================================================
+// ParamKey access
+// =============================================================================
+
+TEST(StateTests, ParamKeyHashIsComputedAtCompileTime) {
+    constexpr ParamKey k_cutoff("synth.filter.cutoff");
+    static_assert(k_cutoff.hash() == detail::fnv1a_64("synth.filter.cutoff"));
+    static_assert(k_cutoff.path() == "synth.filter.cutoff");
+    static_assert(k_cutoff == ParamKey::from_runtime("synth.filter.cutoff"));
+    static_assert(ParamKey("a.b").hash() != ParamKey("a.c").hash());
+}
+
+TEST(StateTests, ParamKeyGetAndSet) {
+    State state;
+    state.create("synth.filter.cutoff", 1000.0f);
+    state.create("synth.filter.enabled", true);
+    state.create("synth.name", "pad");
+
+    constexpr ParamKey k_cutoff("synth.filter.cutoff");
+    EXPECT_FLOAT_EQ(1000.0f, state.get_from_root<float>(k_cutoff));
+
+    state.set_in_root(k_cutoff, 250.0f);
+    EXPECT_FLOAT_EQ(250.0f, state.get<float>("synth.filter.cutoff"));
+    EXPECT_FLOAT_EQ(250.0f, state.get_from_root<float>(k_cutoff));
+
+    state.set_in_root(ParamKey("synth.filter.enabled"), false);
+    EXPECT_FALSE(state.get_from_root<bool>(ParamKey("synth.filter.enabled")));
+
+    state.set_in_root(ParamKey("synth.name"), "lead");
+    EXPECT_EQ("lead", state.get_from_root<std::string>(ParamKey("synth.name"), true));
+
+    EXPECT_THROW(state.get_from_root<float>(ParamKey("synth.filter.missing")),
+                 StateKeyNotFoundException);
+    EXPECT_THROW(state.set_in_root(ParamKey("missing"), 1.0f), StateKeyNotFoundException);
+}
+
+TEST(StateTests, ParamKeyIndexGrowsBatchesAndClears) {
+    State state;
+    std::vector<std::string> paths;
+    for (int i = 0; i < 500; ++i) {
+        paths.push_back("group_" + std::to_string(i % 7) + ".param_" + std::to_string(i));
+    }
+
+    // Half created one by one (growing the table), half inside a batch
+    for (int i = 0; i < 250; ++i) { state.create(paths[i], i); }
+    {
+        auto tx = state.begin_batch();
+        for (int i = 250; i < 500; ++i) {
+            state.create(paths[i], i);
+            // Visible through the locked fallback before commit
+            EXPECT_EQ(i, state.get_from_root<int>(ParamKey::from_runtime(paths[i])));
+        }
+        tx.commit();
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(i, state.get_from_root<int>(ParamKey::from_runtime(paths[i])));
+    }
+
+    state.clear();
+    EXPECT_THROW(state.get_from_root<int>(ParamKey::from_runtime(paths[0])),
+                 StateKeyNotFoundException);
+
+    state.create(paths[0], 7);
+    EXPECT_EQ(7, state.get_from_root<int>(ParamKey::from_runtime(paths[0])));
+}
+
+TEST(StateTests, ParamKeyForgetsParametersOfClearedGroups) {
+    State state;
+    state.create("keep.gain", 0.5f);
+
+    // Repeatedly fill and clear a group: erased slots are reused or rehashed away
+    for (int round = 0; round < 20; ++round) {
+        StateGroup* scratch = state.create_group("scratch");
+        for (int i = 0; i < 40; ++i) { scratch->create("p" + std::to_string(i), round); }
+        EXPECT_EQ(round, state.get_from_root<int>(ParamKey("scratch.p39")));
+
+        scratch->clear();
+        EXPECT_THROW(state.get_from_root<int>(ParamKey("scratch.p39")),
+                     StateKeyNotFoundException);
+        EXPECT_FLOAT_EQ(0.5f, state.get_from_root<float>(ParamKey("keep.gain")));
+    }
+}
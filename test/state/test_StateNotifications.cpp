@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "TestHelpers.h"
 #include "tanh/state/State.h"
 
@@ -656,3 +661,122 @@ TEST(StateTests, SetGestureFromSubgroupMatchesRootGesture) {
     state.set("synth.vol", 0.4f);
     EXPECT_EQ(1, filtered.m_count);  // fires again
 }
+
+// =============================================================================
+// Deferred notifications
+// =============================================================================
+
+TEST(StateTests, DeferredNotificationsCoalescePerParameter) {
+    State state;
+    state.create("synth.cutoff", 100.0);
+    state.create("synth.resonance", 0.1);
+    state.create("synth.drive", 0.0);
+
+    TestParameterListener listener;
+    StateGroup* synth = state.get_group("synth");
+    synth->add_listener(&listener);
+
+    state.set_notification_mode(State::NotificationMode::Deferred);
+    for (int i = 0; i < 10; ++i) { state.set("synth.cutoff", 100.0 + i); }
+    state.set_by_id(state.get_parameter("synth.resonance").id(), 0.5);
+
+    // Writes are visible at once; listeners are not called yet
+    EXPECT_DOUBLE_EQ(109.0, state.get<double>("synth.cutoff"));
+    EXPECT_EQ(0, listener.m_notification_count);
+
+    EXPECT_EQ(2U, state.dispatch_pending());
+    EXPECT_EQ(2, listener.m_notification_count);
+
+    // Nothing left to deliver
+    EXPECT_EQ(0U, state.dispatch_pending());
+    EXPECT_EQ(2, listener.m_notification_count);
+
+    state.set("synth.drive", 1.0);
+    EXPECT_EQ(1U, state.dispatch_pending());
+    EXPECT_EQ("synth.drive", listener.m_last_path);
+    EXPECT_DOUBLE_EQ(1.0, listener.m_last_value_double);
+}
+
+TEST(StateTests, DeferredNotificationsHonourNoneStrategyAndModeSwitch) {
+    State state;
+    state.create("gain", 0.5f);
+
+    TestParameterListener listener;
+    state.add_listener(&listener);
+    const int after_create = listener.m_notification_count;
+
+    TestParameterListener silent_source;
+    silent_source.m_strategy = NotifyStrategies::None;
+
+    state.set_notification_mode(State::NotificationMode::Deferred);
+    state.set("gain", 0.1f, &silent_source);
+    EXPECT_EQ(0U, state.dispatch_pending());
+
+    // Switching back to Immediate flushes what is pending
+    state.set("gain", 0.2f);
+    state.set_notification_mode(State::NotificationMode::Immediate);
+    EXPECT_EQ(after_create + 1, listener.m_notification_count);
+
+    state.set("gain", 0.3f);
+    EXPECT_EQ(after_create + 2, listener.m_notification_count);
+}
+
+TEST(StateTests, DeferredNotificationsSkipClearedParameters) {
+    State state;
+    state.create("fx.mix", 0.5f);
+    state.create("main.level", 1.0f);
+
+    TestParameterListener listener;
+    state.add_listener(&listener);
+    state.set_notification_mode(State::NotificationMode::Deferred);
+
+    state.set("fx.mix", 0.7f);
+    state.set("main.level", 0.8f);
+    state.get_group("fx")->clear();
+
+    const int before = listener.m_notification_count;
+    EXPECT_EQ(1U, state.dispatch_pending());
+    EXPECT_EQ(before + 1, listener.m_notification_count);
+    EXPECT_EQ("main.level", listener.m_last_path);
+
+    // A parameter created later reuses the freed bit without inheriting it
+    state.create("fx.width", 1.0f);
+    EXPECT_EQ(0U, state.dispatch_pending());
+}
+
+TEST(StateTests, DeferredNotificationsFromConcurrentWriters) {
+    State state;
+    for (int i = 0; i < 200; ++i) { state.create("p" + std::to_string(i), 0.0); }
+
+    TestParameterListener listener;
+    state.add_listener(&listener);
+    state.set_notification_mode(State::NotificationMode::Deferred);
+    const int before = listener.m_notification_count;
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.emplace_back([&, t] {
+            state.ensure_thread_registered();
+            for (int round = 0; round < 200; ++round) {
+                for (int i = t; i < 200; i += 2) {
+                    state.set_in_root("p" + std::to_string(i), static_cast<double>(round));
+                }
+            }
+        });
+    }
+    std::thread consumer([&] {
+        while (!stop.load()) { state.dispatch_pending(); }
+    });
+    for (auto& writer : writers) { writer.join(); }
+    stop = true;
+    consumer.join();
+    state.dispatch_pending();
+
+    // Every parameter was delivered at least once, never more than once per write
+    EXPECT_GE(listener.m_notification_count - before, 200);
+    EXPECT_LE(listener.m_notification_count - before, 200 * 200);
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_DOUBLE_EQ(199.0, state.get<double>("p" + std::to_string(i)));
+    }
+}
@@ -2,7 +2,11 @@
 #include <tanh/core/Numbers.h>
 
 #include <nlohmann/json.hpp>
+#include <span>
+#include <string>
 
+#include "TestHelpers.h"
+#include "tanh/state/BinarySnapshot.h"
 #include "tanh/state/Exceptions.h"
 #include "tanh/state/State.h"
 
@@ -617,3 +621,86 @@ TEST(StateTests, GetGroupStateDumpPrefixBoundary) {
     EXPECT_EQ(1u, json.size());
     EXPECT_EQ("engine0.volume", json[0]["key"].get<std::string>());
 }
+
+// =============================================================================
+// Binary snapshot tests
+// =============================================================================
+
+TEST(StateTests, BinarySnapshotRoundTrip) {
+    State state;
+    state.create("synth.f", 3.14f);
+    state.create("synth.d", std::numbers::e);
+    state.create("synth.i", -42);
+    state.create("synth.b", true);
+    state.create("synth.s", std::string("hello"));
+    state.create("synth.empty", std::string(""));
+
+    const auto blob = state.to_binary();
+    EXPECT_EQ(0u, blob.size() % 8);
+
+    state.set("synth.f", 0.0f);
+    state.set("synth.d", 0.0);
+    state.set("synth.i", 0);
+    state.set("synth.b", false);
+    state.set("synth.s", std::string("changed"));
+    state.set("synth.empty", std::string("x"));
+
+    state.from_binary(blob);
+
+    EXPECT_FLOAT_EQ(3.14f, state.get<float>("synth.f"));
+    EXPECT_DOUBLE_EQ(std::numbers::e, state.get<double>("synth.d"));
+    EXPECT_EQ(-42, state.get<int>("synth.i"));
+    EXPECT_TRUE(state.get<bool>("synth.b"));
+    EXPECT_EQ("hello", state.get<std::string>("synth.s", true));
+    EXPECT_EQ("", state.get<std::string>("synth.empty", true));
+}
+
+TEST(StateTests, BinarySnapshotAppliesByIdAndNotifies) {
+    State source;
+    source.create("a", 1.0f);
+    source.create("b", 2.0f);
+
+    // Same IDs, different paths: the snapshot is keyed by ID only
+    State target;
+    target.create("renamed_a", 0.0f);
+    target.create("renamed_b", 0.0f);
+
+    TestParameterListener listener;
+    target.add_listener(&listener);
+
+    target.from_binary(source.to_binary());
+
+    EXPECT_FLOAT_EQ(1.0f, target.get<float>("renamed_a"));
+    EXPECT_FLOAT_EQ(2.0f, target.get<float>("renamed_b"));
+    EXPECT_EQ(2, listener.m_notification_count);
+    EXPECT_EQ("renamed_b", listener.m_last_path);
+}
+
+TEST(StateTests, BinarySnapshotRejectsMalformedInput) {
+    State state;
+    state.create("x", 1.0f);
+    auto blob = state.to_binary();
+
+    EXPECT_THROW(state.from_binary(std::span(blob).first(20)), SnapshotFormatException);
+    EXPECT_THROW(state.from_binary(std::span(blob).first(blob.size() - 8)),
+                 SnapshotFormatException);
+
+    auto bad_magic = blob;
+    bad_magic[0] = std::byte{'X'};
+    EXPECT_THROW(state.from_binary(bad_magic), SnapshotFormatException);
+
+    auto bad_version = blob;
+    bad_version[8] = std::byte{99};
+    EXPECT_THROW(state.from_binary(bad_version), SnapshotFormatException);
+
+    // Unknown IDs throw before anything is written
+    State other;
+    other.create("y", 0.0f);
+    ParameterDefinition def;
+    def.m_type = ParameterType::Float;
+    def.m_id = 1234;
+    other.create("z", def);
+    state.create("w", 7.0f);
+    EXPECT_THROW(other.from_binary(state.to_binary()), StateKeyNotFoundException);
+    EXPECT_FLOAT_EQ(0.0f, other.get<float>("y"));
+}
@@ -0,0 +1,78 @@
+// thl_log_decode — print binary log segments as text.
+//
+//   thl_log_decode [--plain | --logfmt] [--prefix NAME] <directory | segment.tlb>...
+//
+// A directory expands to its segments for the prefix (default "thl"),
+// oldest first.  Output defaults to logfmt, matching the text file sink.
+
+#include <tanh/core/BinaryLog.h>
+#include <tanh/core/Logger.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+void print_usage() {
+    std::fprintf(stderr,
+                 "usage: thl_log_decode [--plain | --logfmt] [--prefix NAME] "
+                 "<directory | segment.tlb>...\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    bool plain = false;
+    std::string prefix = "thl";
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--plain") {
+            plain = true;
+        } else if (arg == "--logfmt") {
+            plain = false;
+        } else if (arg == "--prefix" && i + 1 < argc) {
+            prefix = argv[++i];
+        } else if (arg == "-h" || arg == "--help") {
+            print_usage();
+            return 0;
+        } else {
+            inputs.emplace_back(arg);
+        }
+    }
+    if (inputs.empty()) {
+        print_usage();
+        return 2;
+    }
+
+    std::vector<std::string> segments;
+    for (const auto& input : inputs) {
+        if (std::filesystem::is_directory(input)) {
+            const auto found = thl::Logger::list_binary_log_segments(input, prefix);
+            segments.insert(segments.end(), found.begin(), found.end());
+        } else {
+            segments.push_back(input);
+        }
+    }
+
+    int status = 0;
+    for (const auto& segment : segments) {
+        try {
+            for (const auto& record : thl::Logger::read_binary_log(segment)) {
+                const std::string line = plain ? thl::Logger::format_plain(record)
+                                               : thl::Logger::format_logfmt(record);
+                std::fwrite(line.data(), 1, line.size(), stdout);
+                std::fputc('\n', stdout);
+            }
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "thl_log_decode: %s\n", e.what());
+            status = 1;
+        }
+    }
+    return status;
+}